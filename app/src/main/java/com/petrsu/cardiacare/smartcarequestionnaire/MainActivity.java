@@ -14,15 +14,9 @@ import android.widget.Button;
 import com.google.android.gms.appindexing.Action;
 import com.google.android.gms.appindexing.AppIndex;
 import com.google.android.gms.common.api.GoogleApiClient;
-import com.google.gson.Gson;
 import com.petrsu.cardiacare.smartcare.*;
 
-import java.io.BufferedReader;
-import java.io.FileInputStream;
-import java.io.FileOutputStream;
-import java.io.IOException;
-import java.io.InputStreamReader;
-import java.io.OutputStreamWriter;
+import java.io.File;
 import java.util.LinkedList;
 
 public class MainActivity extends AppCompatActivity {
@@ -45,13 +39,18 @@ public class MainActivity extends AppCompatActivity {
      */
 
 
-    static protected long nodeDescriptor;
+    static protected volatile long nodeDescriptor;
     SmartCareLibrary smart;
+    long questionnaireTask = -1;
+    // The task uses the node until its last callback, so the node is
+    // disconnected when the activity is destroyed and the task is finished
+    boolean isTaskFinished = false;
+    boolean isActivityDestroyed = false;
     // Native code part end
     static protected Questionnaire questionnaire;
     Toolbar mToolbar;
     AccountStorage storage;
-    String filename = "questionnaire.json";
+    String snapshotFilename = "questionnaire.snapshot";
 
     @Override
     protected void onCreate(Bundle savedInstanceState) {
@@ -60,14 +59,50 @@ public class MainActivity extends AppCompatActivity {
          * SS init
          *****************************/
         smart = new SmartCareLibrary();
-        nodeDescriptor = smart.connectSmartSpace("X", "78.46.130.194", 10010);
         setRegisteredActivity();
         // ATTENTION: This was auto-generated to implement the App Indexing API.
         // See https://g.co/AppIndexing/AndroidStudio for more information.
         client = new GoogleApiClient.Builder(this).addApi(AppIndex.API).build();
 
-        questionnaire = smart.getQuestionnaire(nodeDescriptor);
-        printQuestionnaire(questionnaire);
+        // Connection and loading are done on the native thread, UI is not blocked
+        questionnaireTask = smart.connectSmartSpaceAsync("X", "78.46.130.194", 10010, new QuestionnaireCallback() {
+            @Override
+            public void onConnected(long node) {
+                nodeDescriptor = node;
+            }
+
+            @Override
+            public void onQuestion(Question question) {
+                Log.i(TAG, "Question is loaded: " + question.getDescription());
+            }
+
+            @Override
+            public void onQuestionnaire(final Questionnaire loaded) {
+                runOnUiThread(new Runnable() {
+                    @Override
+                    public void run() {
+                        questionnaire = loaded;
+                        printQuestionnaire(questionnaire);
+                    }
+                });
+                onTaskFinished();
+            }
+
+            @Override
+            public void onError(String message) {
+                Log.e(TAG, message);
+                onTaskFinished();
+            }
+
+            @Override
+            public void onCancelled() {
+                Log.i(TAG, "Loading of the questionnaire is cancelled");
+                onTaskFinished();
+            }
+        });
+        if (questionnaireTask == -1) {
+            onTaskFinished();
+        }
 /*
         Button loadFromSS = (Button)findViewById(R.id.buttonSSLoad);
         loadFromSS.setOnClickListener(new View.OnClickListener() {
@@ -78,14 +113,14 @@ public class MainActivity extends AppCompatActivity {
             }
         });
 */
+        // Loaded questionnaire is saved to the binary snapshot without requests to the smart space
         Button saveToJson = (Button)findViewById(R.id.buttonSJson);
         saveToJson.setOnClickListener(new View.OnClickListener() {
             @Override
             public void onClick(View v) {
-                Gson json = new Gson();
-                String jsonStr = json.toJson(questionnaire);
-                System.out.println(jsonStr);
-                writeData(jsonStr);
+                if (smart.saveQuestionnaireSnapshot(nodeDescriptor, getSnapshotPath()) != 0) {
+                    Log.e(TAG, "Can't save the questionnaire snapshot");
+                }
             }
         });
 
@@ -93,11 +128,13 @@ public class MainActivity extends AppCompatActivity {
         loadFromJson.setOnClickListener(new View.OnClickListener() {
             @Override
             public void onClick(View v) {
-                String jasonFromFile = readSavedData();
-                    Gson json = new Gson();
-                    Questionnaire qst = json.fromJson(jasonFromFile,Questionnaire.class);
-                    questionnaire = qst;
-                    printQuestionnaire(questionnaire);
+                Questionnaire qst = smart.loadQuestionnaireSnapshot(getSnapshotPath());
+                if (qst == null) {
+                    Log.e(TAG, "There is no questionnaire snapshot");
+                    return;
+                }
+                questionnaire = qst;
+                printQuestionnaire(questionnaire);
             }
         });
 
@@ -138,35 +175,8 @@ public class MainActivity extends AppCompatActivity {
 
     }
 
-    public void writeData ( String data ){
-        try {
-            FileOutputStream fOut = openFileOutput (filename , MODE_PRIVATE );
-            OutputStreamWriter osw = new OutputStreamWriter(fOut);
-            osw.write(data);
-            osw.flush();
-            osw.close();
-        } catch (Exception e){
-            e.printStackTrace();
-        }
-    }
-
-    public String readSavedData(){
-        StringBuffer datax = new StringBuffer("");
-        try {
-            FileInputStream fIn = openFileInput(filename);
-            InputStreamReader isr = new InputStreamReader(fIn);
-            BufferedReader buffreader = new BufferedReader(isr);
-
-            String readString = buffreader.readLine();
-            while ( readString != null ) {
-                datax.append(readString);
-                readString = buffreader.readLine();
-            }
-            isr.close();
-        } catch ( IOException ioe) {
-            ioe.printStackTrace();
-        }
-        return datax.toString();
+    public String getSnapshotPath() {
+        return new File(getFilesDir(), snapshotFilename).getPath();
     }
 
     public void printQuestionnaire(Questionnaire questionnaire){
@@ -237,7 +247,29 @@ public class MainActivity extends AppCompatActivity {
         moveTaskToBack(true);
         super.onDestroy();
 
-        smart.disconnectSmartSpace(nodeDescriptor);
+        // The running task calls onCancelled later, the node is disconnected there
+        smart.cancelTask(questionnaireTask);
+        synchronized (this) {
+            isActivityDestroyed = true;
+            if (isTaskFinished) {
+                disconnectAndExit();
+            }
+        }
+    }
+
+    // Called by the last callback of the task on the native thread
+    synchronized void onTaskFinished() {
+        isTaskFinished = true;
+        if (isActivityDestroyed) {
+            disconnectAndExit();
+        }
+    }
+
+    void disconnectAndExit() {
+        // Descriptor is 0 if the task could not connect
+        if (nodeDescriptor != 0) {
+            smart.disconnectSmartSpace(nodeDescriptor);
+        }
         System.exit(0);
     }
 
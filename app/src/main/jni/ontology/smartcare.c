@@ -1,476 +1,1440 @@
 #include "smartcare.h"
 
+#include "entity_internal.h"
+
+
+/* Classes and properties, they are not created at runtime. */
+static sslog_property_t SMARTCARE_PROPERTIES[] = {
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasStationarEquipment", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#takeDrugTime", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasPatientMap", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#responseToAlarm", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#isPatientDrugAddicted", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#responseFileUri", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#leftBipolar", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#useEquipmentTime", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#username", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#isOnline", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#freePatientCapacity", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#equipParameter", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDrugToSave", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsSubResponse", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#patientWeight", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsFile", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#readyToHelp", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#img", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#passAuth", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hospitalName", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDoctor", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#carNumber", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#itemText", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#sendAlarm", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDrugToMedicine", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#speciallity", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#adviceText", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDrugToTake", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasMedicalRecordsCard", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasAccess", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#drugName", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containECGSurveys", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#dichotomousItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#multipleItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#sendAdvice", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasResponseItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#rightBipolar", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDocument", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#isPatientMedicineAddicted", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyDate", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#age", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#alarmStatus", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#drugAnnotation", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#patientBloodType", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#itemScore", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#pharmName", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasFeedback", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasPersLocation", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#patientRhFactor", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#surveyEcgInfo", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containUSHSurveys", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#singleItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasAmbLocation", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#diseaseDescription", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasDrugToSale", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsText", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyResult", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#patientHeight", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#workHospital", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#alarmTime", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasHospLocation", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#phone", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#subAnswer", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#rangingItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#code", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#respondedTo", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#description", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasAnswer", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasPharmLocation", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyDataLink", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#isPatientSmoke", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasPatientMetrics", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#dosage", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#linkedWithItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyType", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#documentNumberFull", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#long", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#firstQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#anweredTo", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#isPatientAlcoholAddicted", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyDescription", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#documentType", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#lat", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#surname", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasResponse", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#documentReleaseDate", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#personInformation", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#authRequestStatus", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#responseText", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#password", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#mbox", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasPortableEquipment", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#nextQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#workAmbulance", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#name", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#adviceTime", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#diseaseType", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#serveyUshInfo", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containDiseases", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+};
+
+static sslog_class_t SMARTCARE_CLASSES[] = {
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#RangingScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Questionnaire"),
+    SSLOG_ONTOLOGY_CLASS("http://www.w3.org/2002/07/owl#Thing"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Alarm"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseText"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Location"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Dichotomous"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Choise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#PatientMetrics"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Feedback"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Pharmacy"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#GuttmanScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseFile"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Response"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Document"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Bed"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Medic"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#USHServey"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Caring"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Phone"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Ambulance"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ClosedAnswer"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseItem"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Patient"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Person"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#AuthRequest"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Photo"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Doctor"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Nurse"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#LikertScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Audio"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ContinuousScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#File"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Advice"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Text"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#MedicalRecordsCard"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Answer"),
+    SSLOG_ONTOLOGY_CLASS("http://www.w3.org/2002/07/owl#Nothing"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#MultipleChoise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Item"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Hospital"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Servey"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Profile"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Number"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Video"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Disease"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ECGServey"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#OpenAnswer"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#PatientMap"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Question"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Equipment"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Drug"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#SingleChoise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Validated"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Email"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#BipolarQuestion"),
+};
+
+static sslog_entity_t *const SMARTCARE_ENTITIES[] = {
+    &SMARTCARE_PROPERTIES[0].entity,
+    &SMARTCARE_PROPERTIES[1].entity,
+    &SMARTCARE_PROPERTIES[2].entity,
+    &SMARTCARE_PROPERTIES[3].entity,
+    &SMARTCARE_PROPERTIES[4].entity,
+    &SMARTCARE_PROPERTIES[5].entity,
+    &SMARTCARE_PROPERTIES[6].entity,
+    &SMARTCARE_PROPERTIES[7].entity,
+    &SMARTCARE_PROPERTIES[8].entity,
+    &SMARTCARE_PROPERTIES[9].entity,
+    &SMARTCARE_PROPERTIES[10].entity,
+    &SMARTCARE_PROPERTIES[11].entity,
+    &SMARTCARE_PROPERTIES[12].entity,
+    &SMARTCARE_PROPERTIES[13].entity,
+    &SMARTCARE_PROPERTIES[14].entity,
+    &SMARTCARE_PROPERTIES[15].entity,
+    &SMARTCARE_PROPERTIES[16].entity,
+    &SMARTCARE_PROPERTIES[17].entity,
+    &SMARTCARE_PROPERTIES[18].entity,
+    &SMARTCARE_PROPERTIES[19].entity,
+    &SMARTCARE_PROPERTIES[20].entity,
+    &SMARTCARE_PROPERTIES[21].entity,
+    &SMARTCARE_PROPERTIES[22].entity,
+    &SMARTCARE_PROPERTIES[23].entity,
+    &SMARTCARE_PROPERTIES[24].entity,
+    &SMARTCARE_PROPERTIES[25].entity,
+    &SMARTCARE_PROPERTIES[26].entity,
+    &SMARTCARE_PROPERTIES[27].entity,
+    &SMARTCARE_PROPERTIES[28].entity,
+    &SMARTCARE_PROPERTIES[29].entity,
+    &SMARTCARE_PROPERTIES[30].entity,
+    &SMARTCARE_PROPERTIES[31].entity,
+    &SMARTCARE_PROPERTIES[32].entity,
+    &SMARTCARE_PROPERTIES[33].entity,
+    &SMARTCARE_PROPERTIES[34].entity,
+    &SMARTCARE_PROPERTIES[35].entity,
+    &SMARTCARE_PROPERTIES[36].entity,
+    &SMARTCARE_PROPERTIES[37].entity,
+    &SMARTCARE_PROPERTIES[38].entity,
+    &SMARTCARE_PROPERTIES[39].entity,
+    &SMARTCARE_PROPERTIES[40].entity,
+    &SMARTCARE_PROPERTIES[41].entity,
+    &SMARTCARE_PROPERTIES[42].entity,
+    &SMARTCARE_PROPERTIES[43].entity,
+    &SMARTCARE_PROPERTIES[44].entity,
+    &SMARTCARE_PROPERTIES[45].entity,
+    &SMARTCARE_PROPERTIES[46].entity,
+    &SMARTCARE_PROPERTIES[47].entity,
+    &SMARTCARE_PROPERTIES[48].entity,
+    &SMARTCARE_PROPERTIES[49].entity,
+    &SMARTCARE_PROPERTIES[50].entity,
+    &SMARTCARE_PROPERTIES[51].entity,
+    &SMARTCARE_PROPERTIES[52].entity,
+    &SMARTCARE_PROPERTIES[53].entity,
+    &SMARTCARE_PROPERTIES[54].entity,
+    &SMARTCARE_PROPERTIES[55].entity,
+    &SMARTCARE_PROPERTIES[56].entity,
+    &SMARTCARE_PROPERTIES[57].entity,
+    &SMARTCARE_PROPERTIES[58].entity,
+    &SMARTCARE_PROPERTIES[59].entity,
+    &SMARTCARE_PROPERTIES[60].entity,
+    &SMARTCARE_PROPERTIES[61].entity,
+    &SMARTCARE_PROPERTIES[62].entity,
+    &SMARTCARE_PROPERTIES[63].entity,
+    &SMARTCARE_PROPERTIES[64].entity,
+    &SMARTCARE_PROPERTIES[65].entity,
+    &SMARTCARE_PROPERTIES[66].entity,
+    &SMARTCARE_PROPERTIES[67].entity,
+    &SMARTCARE_PROPERTIES[68].entity,
+    &SMARTCARE_PROPERTIES[69].entity,
+    &SMARTCARE_PROPERTIES[70].entity,
+    &SMARTCARE_PROPERTIES[71].entity,
+    &SMARTCARE_PROPERTIES[72].entity,
+    &SMARTCARE_PROPERTIES[73].entity,
+    &SMARTCARE_PROPERTIES[74].entity,
+    &SMARTCARE_PROPERTIES[75].entity,
+    &SMARTCARE_PROPERTIES[76].entity,
+    &SMARTCARE_PROPERTIES[77].entity,
+    &SMARTCARE_PROPERTIES[78].entity,
+    &SMARTCARE_PROPERTIES[79].entity,
+    &SMARTCARE_PROPERTIES[80].entity,
+    &SMARTCARE_PROPERTIES[81].entity,
+    &SMARTCARE_PROPERTIES[82].entity,
+    &SMARTCARE_PROPERTIES[83].entity,
+    &SMARTCARE_PROPERTIES[84].entity,
+    &SMARTCARE_PROPERTIES[85].entity,
+    &SMARTCARE_PROPERTIES[86].entity,
+    &SMARTCARE_PROPERTIES[87].entity,
+    &SMARTCARE_PROPERTIES[88].entity,
+    &SMARTCARE_PROPERTIES[89].entity,
+    &SMARTCARE_PROPERTIES[90].entity,
+    &SMARTCARE_PROPERTIES[91].entity,
+    &SMARTCARE_PROPERTIES[92].entity,
+    &SMARTCARE_PROPERTIES[93].entity,
+    &SMARTCARE_PROPERTIES[94].entity,
+    &SMARTCARE_PROPERTIES[95].entity,
+    &SMARTCARE_PROPERTIES[96].entity,
+    &SMARTCARE_PROPERTIES[97].entity,
+    &SMARTCARE_PROPERTIES[98].entity,
+    &SMARTCARE_PROPERTIES[99].entity,
+    &SMARTCARE_CLASSES[0].entity,
+    &SMARTCARE_CLASSES[1].entity,
+    &SMARTCARE_CLASSES[2].entity,
+    &SMARTCARE_CLASSES[3].entity,
+    &SMARTCARE_CLASSES[4].entity,
+    &SMARTCARE_CLASSES[5].entity,
+    &SMARTCARE_CLASSES[6].entity,
+    &SMARTCARE_CLASSES[7].entity,
+    &SMARTCARE_CLASSES[8].entity,
+    &SMARTCARE_CLASSES[9].entity,
+    &SMARTCARE_CLASSES[10].entity,
+    &SMARTCARE_CLASSES[11].entity,
+    &SMARTCARE_CLASSES[12].entity,
+    &SMARTCARE_CLASSES[13].entity,
+    &SMARTCARE_CLASSES[14].entity,
+    &SMARTCARE_CLASSES[15].entity,
+    &SMARTCARE_CLASSES[16].entity,
+    &SMARTCARE_CLASSES[17].entity,
+    &SMARTCARE_CLASSES[18].entity,
+    &SMARTCARE_CLASSES[19].entity,
+    &SMARTCARE_CLASSES[20].entity,
+    &SMARTCARE_CLASSES[21].entity,
+    &SMARTCARE_CLASSES[22].entity,
+    &SMARTCARE_CLASSES[23].entity,
+    &SMARTCARE_CLASSES[24].entity,
+    &SMARTCARE_CLASSES[25].entity,
+    &SMARTCARE_CLASSES[26].entity,
+    &SMARTCARE_CLASSES[27].entity,
+    &SMARTCARE_CLASSES[28].entity,
+    &SMARTCARE_CLASSES[29].entity,
+    &SMARTCARE_CLASSES[30].entity,
+    &SMARTCARE_CLASSES[31].entity,
+    &SMARTCARE_CLASSES[32].entity,
+    &SMARTCARE_CLASSES[33].entity,
+    &SMARTCARE_CLASSES[34].entity,
+    &SMARTCARE_CLASSES[35].entity,
+    &SMARTCARE_CLASSES[36].entity,
+    &SMARTCARE_CLASSES[37].entity,
+    &SMARTCARE_CLASSES[38].entity,
+    &SMARTCARE_CLASSES[39].entity,
+    &SMARTCARE_CLASSES[40].entity,
+    &SMARTCARE_CLASSES[41].entity,
+    &SMARTCARE_CLASSES[42].entity,
+    &SMARTCARE_CLASSES[43].entity,
+    &SMARTCARE_CLASSES[44].entity,
+    &SMARTCARE_CLASSES[45].entity,
+    &SMARTCARE_CLASSES[46].entity,
+    &SMARTCARE_CLASSES[47].entity,
+    &SMARTCARE_CLASSES[48].entity,
+    &SMARTCARE_CLASSES[49].entity,
+    &SMARTCARE_CLASSES[50].entity,
+    &SMARTCARE_CLASSES[51].entity,
+    &SMARTCARE_CLASSES[52].entity,
+    &SMARTCARE_CLASSES[53].entity,
+    &SMARTCARE_CLASSES[54].entity,
+    &SMARTCARE_CLASSES[55].entity,
+};
+
+
+/* Perfect hash of URIs (see sslog_ontology_t). This and the following tables
+ * are made by smartcare/src/main/jni/ontology/gen_ontology.py from the tables
+ * above, check them with "gen_ontology.py --check". */
+static const uint32_t SMARTCARE_HASH_SEEDS[39] = {
+    3, 2, 1, 2, 1, 4, 2, 24,
+    12, 12, 1, 6, 26, 23, 6, 1,
+    1, 2, 9, 22, 5, 13, 12, 26,
+    6, 49, 3, 14, 9, 8, 5, 58,
+    19, 3, 5, 2, 91, 7, 1,
+};
+
+static const int16_t SMARTCARE_HASH_SLOTS[195] = {
+    0, 111, 138, -1, 27, -1, 81, 30, 20, -1, 84, 76,
+    80, 95, 2, 104, -1, 77, -1, 45, -1, 71, 8, 108,
+    97, -1, 54, -1, 15, 55, 143, 17, 117, 148, 51, 85,
+    126, 128, -1, 26, -1, 116, 120, 58, 96, 19, 65, 11,
+    123, 94, 3, 43, 47, 107, 42, 152, 36, -1, 48, 63,
+    -1, -1, 32, 140, 62, 46, 64, -1, 151, -1, 82, -1,
+    -1, -1, 132, 142, 41, 60, 83, -1, 137, 38, 113, 135,
+    21, 23, -1, 154, 67, 91, 78, 53, 122, 39, 70, 98,
+    -1, 14, 22, 109, 133, -1, 29, 105, 121, 93, 90, -1,
+    125, -1, 100, 155, 50, 12, 57, 106, 52, 40, 16, 129,
+    -1, 37, 68, 92, 79, 127, 10, 5, -1, -1, 7, -1,
+    72, 124, 102, 134, 44, 18, 110, 131, 136, 88, 119, 115,
+    112, 35, 73, 59, 86, 103, -1, 75, -1, 118, 4, 6,
+    56, 34, 114, 1, 69, 74, -1, -1, -1, 153, 150, 146,
+    13, 145, -1, 144, 87, 99, 25, 49, 149, 33, 130, 89,
+    147, 31, -1, 66, -1, 24, 101, 141, 139, 61, 9, -1,
+    -1, 28, -1,
+};
+
+
+/* Segment image with rdf:type triples of classes and properties (little-endian). */
+static const uint32_t SMARTCARE_SCHEMA[3560] = {
+    0x4f4c5353, 0x47455347, 0x00000002, 0x0000009f, 0x0000009c, 0x00001aaf,
+    0x00000050, 0x000002cc, 0x00000000, 0x00000c8c, 0x00000efc, 0x0000116c,
+    0x000013ec, 0x0000166c, 0x00001cf0, 0x000018f0, 0x00000010, 0x00000138,
+    0x0000379f, 0x171f4bf1, 0x00000000, 0x00000026, 0x0000004b, 0x00000074,
+    0x0000009a, 0x000000bf, 0x000000ea, 0x0000010d, 0x0000013c, 0x00000162,
+    0x00000188, 0x000001b4, 0x000001e3, 0x0000020e, 0x00000235, 0x0000025b,
+    0x00000283, 0x000002a7, 0x000002d0, 0x000002f5, 0x0000031e, 0x00000346,
+    0x0000036a, 0x00000396, 0x000003be, 0x000003e2, 0x0000040d, 0x00000435,
+    0x0000045a, 0x0000048c, 0x000004ba, 0x000004e0, 0x00000505, 0x0000052f,
+    0x00000556, 0x00000580, 0x000005ae, 0x000005d4, 0x000005fc, 0x00000621,
+    0x00000646, 0x0000066d, 0x00000695, 0x000006c2, 0x000006ee, 0x00000716,
+    0x00000742, 0x0000076e, 0x0000079a, 0x000007c0, 0x000007ec, 0x00000810,
+    0x00000839, 0x00000862, 0x00000887, 0x000008b1, 0x000008db, 0x000008fe,
+    0x00000929, 0x00000952, 0x0000097b, 0x000009ac, 0x000009d5, 0x000009f9,
+    0x00000a28, 0x00000a59, 0x00000a8a, 0x00000ab6, 0x00000ae9, 0x00000b15,
+    0x00000b40, 0x00000b6f, 0x00000ba1, 0x00000bcc, 0x00000bfe, 0x00000c31,
+    0x00000c5d, 0x00000c83, 0x00000cb1, 0x00000cd9, 0x00000d07, 0x00000d34,
+    0x00000d67, 0x00000d90, 0x00000dbe, 0x00000de7, 0x00000e10, 0x00000e3b,
+    0x00000e6c, 0x00000e99, 0x00000ec6, 0x00000ef3, 0x00000f1e, 0x00000f4d,
+    0x00000f82, 0x00000faf, 0x00000fe0, 0x0000100f, 0x0000103f, 0x00001073,
+    0x0000109e, 0x000010c9, 0x000010f8, 0x0000112d, 0x00001159, 0x0000117c,
+    0x000011a4, 0x000011dc, 0x00001211, 0x0000124a, 0x00001278, 0x000012a1,
+    0x000012c9, 0x000012ec, 0x00001317, 0x00001345, 0x00001369, 0x0000138d,
+    0x000013b9, 0x000013dd, 0x00001409, 0x00001431, 0x00001459, 0x00001489,
+    0x000014b6, 0x000014e5, 0x00001512, 0x00001543, 0x0000156c, 0x00001591,
+    0x000015bc, 0x000015e7, 0x00001612, 0x00001641, 0x0000166d, 0x0000169c,
+    0x000016c8, 0x000016f2, 0x0000171b, 0x00001749, 0x00001773, 0x000017a4,
+    0x000017d0, 0x000017fa, 0x00001827, 0x00001851, 0x0000187c, 0x000018a5,
+    0x000018cc, 0x000018f9, 0x00001925, 0x00001955, 0x0000197d, 0x000019aa,
+    0x000019d6, 0x00001a0a, 0x00001a3a, 0x00001a65, 0x00001a8b, 0x00000000,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000001, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000002, 0x0000009b, 0x0000009c, 0x00000101, 0x00000003,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000004, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000005, 0x0000009b, 0x0000009c, 0x00000101, 0x00000006,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000007, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000008, 0x0000009b, 0x0000009c, 0x00000101, 0x00000009,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000000a, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000000b, 0x0000009b, 0x0000009c, 0x00000101, 0x0000000c,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000000d, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000000e, 0x0000009b, 0x0000009c, 0x00000101, 0x0000000f,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000010, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000011, 0x0000009b, 0x0000009c, 0x00000101, 0x00000012,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000013, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000014, 0x0000009b, 0x0000009c, 0x00000101, 0x00000015,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000016, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000017, 0x0000009b, 0x0000009c, 0x00000101, 0x00000018,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000019, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000001a, 0x0000009b, 0x0000009c, 0x00000101, 0x0000001b,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000001c, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000001d, 0x0000009b, 0x0000009c, 0x00000101, 0x0000001e,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000001f, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000020, 0x0000009b, 0x0000009c, 0x00000101, 0x00000021,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000022, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000023, 0x0000009b, 0x0000009c, 0x00000101, 0x00000024,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000025, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000026, 0x0000009b, 0x0000009c, 0x00000101, 0x00000027,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000028, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000029, 0x0000009b, 0x0000009c, 0x00000101, 0x0000002a,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000002b, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000002c, 0x0000009b, 0x0000009c, 0x00000101, 0x0000002d,
+    0x0000009b, 0x0000009c, 0x00000101, 0x0000002e, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000002f, 0x0000009b, 0x0000009c, 0x00000101, 0x00000030,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000031, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000032, 0x0000009b, 0x0000009c, 0x00000101, 0x00000033,
+    0x0000009b, 0x0000009c, 0x00000101, 0x00000034, 0x0000009b, 0x0000009c,
+    0x00000101, 0x00000035, 0x0000009b, 0x0000009c, 0x00000101, 0x00000036,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000037, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000038, 0x0000009b, 0x0000009a, 0x00000101, 0x00000039,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000003a, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000003b, 0x0000009b, 0x0000009a, 0x00000101, 0x0000003c,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000003d, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000003e, 0x0000009b, 0x0000009a, 0x00000101, 0x0000003f,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000040, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000041, 0x0000009b, 0x0000009a, 0x00000101, 0x00000042,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000043, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000044, 0x0000009b, 0x0000009a, 0x00000101, 0x00000045,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000046, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000047, 0x0000009b, 0x0000009a, 0x00000101, 0x00000048,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000049, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000004a, 0x0000009b, 0x0000009a, 0x00000101, 0x0000004b,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000004c, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000004d, 0x0000009b, 0x0000009a, 0x00000101, 0x0000004e,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000004f, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000050, 0x0000009b, 0x0000009a, 0x00000101, 0x00000051,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000052, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000053, 0x0000009b, 0x0000009a, 0x00000101, 0x00000054,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000055, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000056, 0x0000009b, 0x0000009a, 0x00000101, 0x00000057,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000058, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000059, 0x0000009b, 0x0000009a, 0x00000101, 0x0000005a,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000005b, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000005c, 0x0000009b, 0x0000009a, 0x00000101, 0x0000005d,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000005e, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000005f, 0x0000009b, 0x0000009a, 0x00000101, 0x00000060,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000061, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000062, 0x0000009b, 0x0000009a, 0x00000101, 0x00000063,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000064, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000065, 0x0000009b, 0x0000009a, 0x00000101, 0x00000066,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000067, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000068, 0x0000009b, 0x0000009a, 0x00000101, 0x00000069,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000006a, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000006b, 0x0000009b, 0x0000009a, 0x00000101, 0x0000006c,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000006d, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000006e, 0x0000009b, 0x0000009a, 0x00000101, 0x0000006f,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000070, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000071, 0x0000009b, 0x0000009a, 0x00000101, 0x00000072,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000073, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000074, 0x0000009b, 0x0000009a, 0x00000101, 0x00000075,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000076, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000077, 0x0000009b, 0x0000009a, 0x00000101, 0x00000078,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000079, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000007a, 0x0000009b, 0x0000009a, 0x00000101, 0x0000007b,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000007c, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000007d, 0x0000009b, 0x0000009a, 0x00000101, 0x0000007e,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000007f, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000080, 0x0000009b, 0x0000009a, 0x00000101, 0x00000081,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000082, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000083, 0x0000009b, 0x0000009a, 0x00000101, 0x00000084,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000085, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000086, 0x0000009b, 0x0000009a, 0x00000101, 0x00000087,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000088, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000089, 0x0000009b, 0x0000009a, 0x00000101, 0x0000008a,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000008b, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000008c, 0x0000009b, 0x0000009a, 0x00000101, 0x0000008d,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000008e, 0x0000009b, 0x0000009a,
+    0x00000101, 0x0000008f, 0x0000009b, 0x0000009a, 0x00000101, 0x00000090,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000091, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000092, 0x0000009b, 0x0000009a, 0x00000101, 0x00000093,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000094, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000095, 0x0000009b, 0x0000009a, 0x00000101, 0x00000096,
+    0x0000009b, 0x0000009a, 0x00000101, 0x00000097, 0x0000009b, 0x0000009a,
+    0x00000101, 0x00000098, 0x0000009b, 0x0000009a, 0x00000101, 0x00000099,
+    0x0000009b, 0x0000009a, 0x00000101, 0x0000009d, 0x0000009b, 0x0000009c,
+    0x00000101, 0x0000009e, 0x0000009b, 0x0000009c, 0x00000101, 0x00000000,
+    0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,
+    0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+    0x0000000d, 0x0000000e, 0x0000000f, 0x00000010, 0x00000011, 0x00000012,
+    0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017, 0x00000018,
+    0x00000019, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e,
+    0x0000001f, 0x00000020, 0x00000021, 0x00000022, 0x00000023, 0x00000024,
+    0x00000025, 0x00000026, 0x00000027, 0x00000028, 0x00000029, 0x0000002a,
+    0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+    0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036,
+    0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+    0x0000003d, 0x0000003e, 0x0000003f, 0x00000040, 0x00000041, 0x00000042,
+    0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048,
+    0x00000049, 0x0000004a, 0x0000004b, 0x0000004c, 0x0000004d, 0x0000004e,
+    0x0000004f, 0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054,
+    0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005a,
+    0x0000005b, 0x0000005c, 0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+    0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066,
+    0x00000067, 0x00000068, 0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+    0x0000006d, 0x0000006e, 0x0000006f, 0x00000070, 0x00000071, 0x00000072,
+    0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078,
+    0x00000079, 0x0000007a, 0x0000007b, 0x0000007c, 0x0000007d, 0x0000007e,
+    0x0000007f, 0x00000080, 0x00000081, 0x00000082, 0x00000083, 0x00000084,
+    0x00000085, 0x00000086, 0x00000087, 0x00000088, 0x00000089, 0x0000008a,
+    0x0000008b, 0x0000008c, 0x0000008d, 0x0000008e, 0x0000008f, 0x00000090,
+    0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096,
+    0x00000097, 0x00000098, 0x00000099, 0x0000009a, 0x0000009b, 0x00000036,
+    0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+    0x0000003d, 0x0000003e, 0x0000003f, 0x00000040, 0x00000041, 0x00000042,
+    0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048,
+    0x00000049, 0x0000004a, 0x0000004b, 0x0000004c, 0x0000004d, 0x0000004e,
+    0x0000004f, 0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054,
+    0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005a,
+    0x0000005b, 0x0000005c, 0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+    0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066,
+    0x00000067, 0x00000068, 0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+    0x0000006d, 0x0000006e, 0x0000006f, 0x00000070, 0x00000071, 0x00000072,
+    0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078,
+    0x00000079, 0x0000007a, 0x0000007b, 0x0000007c, 0x0000007d, 0x0000007e,
+    0x0000007f, 0x00000080, 0x00000081, 0x00000082, 0x00000083, 0x00000084,
+    0x00000085, 0x00000086, 0x00000087, 0x00000088, 0x00000089, 0x0000008a,
+    0x0000008b, 0x0000008c, 0x0000008d, 0x0000008e, 0x0000008f, 0x00000090,
+    0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096,
+    0x00000097, 0x00000098, 0x00000099, 0x00000000, 0x00000001, 0x00000002,
+    0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007, 0x00000008,
+    0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e,
+    0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013, 0x00000014,
+    0x00000015, 0x00000016, 0x00000017, 0x00000018, 0x00000019, 0x0000001a,
+    0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f, 0x00000020,
+    0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025, 0x00000026,
+    0x00000027, 0x00000028, 0x00000029, 0x0000002a, 0x0000002b, 0x0000002c,
+    0x0000002d, 0x0000002e, 0x0000002f, 0x00000030, 0x00000031, 0x00000032,
+    0x00000033, 0x00000034, 0x00000035, 0x0000009a, 0x0000009b, 0x00000000,
+    0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006,
+    0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c,
+    0x0000000d, 0x0000000e, 0x0000000f, 0x00000010, 0x00000011, 0x00000012,
+    0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017, 0x00000018,
+    0x00000019, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e,
+    0x0000001f, 0x00000020, 0x00000021, 0x00000022, 0x00000023, 0x00000024,
+    0x00000025, 0x00000026, 0x00000027, 0x00000028, 0x00000029, 0x0000002a,
+    0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030,
+    0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036,
+    0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000003b, 0x0000003c,
+    0x0000003d, 0x0000003e, 0x0000003f, 0x00000040, 0x00000041, 0x00000042,
+    0x00000043, 0x00000044, 0x00000045, 0x00000046, 0x00000047, 0x00000048,
+    0x00000049, 0x0000004a, 0x0000004b, 0x0000004c, 0x0000004d, 0x0000004e,
+    0x0000004f, 0x00000050, 0x00000051, 0x00000052, 0x00000053, 0x00000054,
+    0x00000055, 0x00000056, 0x00000057, 0x00000058, 0x00000059, 0x0000005a,
+    0x0000005b, 0x0000005c, 0x0000005d, 0x0000005e, 0x0000005f, 0x00000060,
+    0x00000061, 0x00000062, 0x00000063, 0x00000064, 0x00000065, 0x00000066,
+    0x00000067, 0x00000068, 0x00000069, 0x0000006a, 0x0000006b, 0x0000006c,
+    0x0000006d, 0x0000006e, 0x0000006f, 0x00000070, 0x00000071, 0x00000072,
+    0x00000073, 0x00000074, 0x00000075, 0x00000076, 0x00000077, 0x00000078,
+    0x00000079, 0x0000007a, 0x0000007b, 0x0000007c, 0x0000007d, 0x0000007e,
+    0x0000007f, 0x00000080, 0x00000081, 0x00000082, 0x00000083, 0x00000084,
+    0x00000085, 0x00000086, 0x00000087, 0x00000088, 0x00000089, 0x0000008a,
+    0x0000008b, 0x0000008c, 0x0000008d, 0x0000008e, 0x0000008f, 0x00000090,
+    0x00000091, 0x00000092, 0x00000093, 0x00000094, 0x00000095, 0x00000096,
+    0x00000097, 0x00000098, 0x00000099, 0x0000009a, 0x0000009a, 0x0000009a,
+    0x0000009a, 0x0000009b, 0x0000009c, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x0000009c, 0x0000009c, 0x0000009c,
+    0x0000009c, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000064, 0x00000064, 0x0000009c, 0x0000009c, 0x0000009c, 0x00000000,
+    0x200e0288, 0x00000300, 0x80100124, 0x002a0c01, 0x20404040, 0x0c80ac82,
+    0x00010084, 0x00020043, 0x00488000, 0x00000000, 0x000a8020, 0x00008100,
+    0xd0000080, 0x2e00c000, 0x02403840, 0x40440080, 0x10214222, 0x042a0088,
+    0x30110804, 0x84080930, 0x80c20812, 0x920100a8, 0x00a10002, 0x04085d94,
+    0x34008028, 0x310400e5, 0x01000062, 0x08800024, 0x006800c0, 0x2200a400,
+    0x22300140, 0x02041908, 0x45a200ae, 0x80028481, 0x2900a410, 0x02383504,
+    0x07059436, 0x4b001320, 0xaa0000c0, 0x241246a8, 0x0000a481, 0x95a01809,
+    0xf200e206, 0x06300018, 0xa0073152, 0x16420341, 0x9029d803, 0x000c9091,
+    0x00400802, 0x000a1008, 0x00020000, 0x000488a0, 0x00240104, 0x01008004,
+    0x223050c0, 0x00046200, 0x0d029c46, 0x00002000, 0x00825908, 0x00000040,
+    0x00011091, 0xa128aa90, 0x408a2000, 0x20100090, 0x00010d01, 0x08244404,
+    0x060020a0, 0x90040000, 0x00046048, 0x2001c280, 0x00860400, 0x20449901,
+    0x000ba220, 0x85104425, 0x00115084, 0xc3289800, 0x00880680, 0x02a89320,
+    0x08046301, 0x01224e00, 0x08082804, 0x014049b0, 0x10101180, 0x41074000,
+    0x00123143, 0x428044e0, 0x52400100, 0x00080804, 0x2203200a, 0x30c01781,
+    0x0000a104, 0x000d2420, 0xa11020b1, 0x14028090, 0xe0b54900, 0x04430300,
+    0x00101042, 0x00402a03, 0x05100400, 0x10044021, 0x10500483, 0x60811010,
+    0x00208d20, 0x01800081, 0x00000024, 0x10100400, 0x40460d05, 0x04c00c00,
+    0x02000550, 0x00046202, 0x42009040, 0x02302024, 0x03ae0959, 0x01200111,
+    0x023805e0, 0x071a4420, 0x02f26088, 0x0940e042, 0x298a81ac, 0x2082000a,
+    0x84010031, 0x713b851c, 0x0ca64a36, 0x2a164000, 0x0591854f, 0x29804092,
+    0x1a600106, 0x0c200807, 0x40800004, 0x00021020, 0x82204002, 0x00002224,
+    0x00022145, 0x40680a00, 0x48001000, 0x28100811, 0x848a0048, 0x22880250,
+    0x80008007, 0x81000422, 0x80001804, 0x32000011, 0x00097800, 0x00008200,
+    0x08800262, 0x10040420, 0x02400412, 0x40408880, 0xc0100020, 0x04e40a00,
+    0x80055b17, 0x1a1a0a00, 0x00403820, 0x0100e008, 0x0c020600, 0x65044000,
+    0x00106400, 0x00bc0080, 0x00481022, 0x80a18103, 0x25ab0922, 0x010021c1,
+    0x04070700, 0x01480326, 0x30004410, 0x00102d42, 0x58290882, 0x280b2402,
+    0x28060000, 0x72040310, 0x42640026, 0x01218320, 0x105548a0, 0x208082a4,
+    0x022200c6, 0x23268821, 0x820a190d, 0x00048040, 0x3800201c, 0x320158e8,
+    0x001e0403, 0x000800a0, 0x00c41a00, 0x0208000a, 0x00300002, 0x001cd094,
+    0x01002340, 0x002090c8, 0x02000410, 0x6c08c008, 0x08381020, 0x00808003,
+    0x100a1990, 0x60082220, 0x60001444, 0x3a803100, 0x08100046, 0x90462266,
+    0xe1302002, 0x406416a7, 0x06802004, 0x00660342, 0x18028208, 0x20059210,
+    0x101000a7, 0x04000860, 0x40200000, 0x08400002, 0x00012009, 0x08641958,
+    0x018240e0, 0x01400270, 0x1a842c98, 0x60404104, 0x18115400, 0x143d0080,
+    0x80002882, 0x4008b080, 0xc0144380, 0x288a2040, 0x0808a000, 0x0801c821,
+    0x00040824, 0x6c082814, 0x20420460, 0x000a0402, 0x203c0200, 0x08202340,
+    0x05a05800, 0x01842004, 0x2c024911, 0x60080000, 0x00c02000, 0x0060144c,
+    0x0c040000, 0x20098830, 0x70054a18, 0x02611210, 0x10202120, 0x3042a000,
+    0x9094254a, 0x608b84c1, 0x00068042, 0x48942408, 0x0040a30a, 0x1450a888,
+    0x0808ba25, 0x81021195, 0x80140000, 0x016140c0, 0xa5320009, 0x7e10404e,
+    0x2040b483, 0x4811012a, 0x0661c060, 0x4ac4aa42, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x41236572,
+    0x63697664, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x616c4123, 0x68006d72, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x6d412365, 0x616c7562, 0x0065636e, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x41236572, 0x6577736e,
+    0x74680072, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x64754123, 0x68006f69, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x75412365,
+    0x65526874, 0x73657571, 0x74680074, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x64654223, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x6f706942, 0x5172616c, 0x74736575, 0x006e6f69, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x43236572, 0x6e697261, 0x74680067, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6f684323, 0x00657369,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x43236572, 0x65736f6c, 0x736e4164, 0x00726577, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x43236572, 0x69746e6f, 0x756f756e, 0x61635373, 0x6800656c, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x69442365, 0x746f6863, 0x756f6d6f, 0x74680073, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x73694423,
+    0x65736165, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x74636f44, 0x6800726f, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x6f442365, 0x656d7563, 0x6800746e, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x72442365, 0x68006775,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x43452365, 0x72655347, 0x00796576, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x45236572,
+    0x6c69616d, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x69757145, 0x6e656d70, 0x74680074,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x65654623, 0x63616264, 0x7468006b, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6c694623,
+    0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x74754723, 0x6e616d74, 0x6c616353, 0x74680065,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x736f4823, 0x61746970, 0x7468006c, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x65744923,
+    0x7468006d, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x6b694c23, 0x53747265, 0x656c6163, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x61636f4c, 0x6e6f6974, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x6964654d,
+    0x74680063, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x64654d23, 0x6c616369, 0x6f636552, 0x43736472,
+    0x00647261, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x4d236572, 0x69746c75, 0x43656c70, 0x73696f68,
+    0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x6d754e23, 0x00726562, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x4e236572,
+    0x65737275, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x6e65704f, 0x77736e41, 0x68007265,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x61502365, 0x6e656974, 0x74680074, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x74615023,
+    0x746e6569, 0x0070614d, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572,
+    0x67726f2e, 0x616d732f, 0x61637472, 0x50236572, 0x65697461, 0x654d746e,
+    0x63697274, 0x74680073, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x72655023, 0x006e6f73, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x50236572, 0x6d726168, 0x00796361, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x50236572, 0x656e6f68,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x746f6850, 0x7468006f, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6f725023,
+    0x656c6966, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x73657551, 0x6e6f6974, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x73657551, 0x6e6f6974, 0x7269616e, 0x74680065, 0x2f3a7074,
+    0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163,
+    0x6e615223, 0x676e6967, 0x6c616353, 0x74680065, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x73655223,
+    0x736e6f70, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x73655223, 0x736e6f70, 0x6c694665,
+    0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x73655223, 0x736e6f70, 0x65744965, 0x7468006d,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x73655223, 0x736e6f70, 0x78655465, 0x74680074, 0x2f3a7074,
+    0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163,
+    0x72655323, 0x00796576, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572,
+    0x67726f2e, 0x616d732f, 0x61637472, 0x53236572, 0x6c676e69, 0x6f684365,
+    0x00657369, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x54236572, 0x00747865, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x55236572,
+    0x65534853, 0x79657672, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x696c6156, 0x65746164,
+    0x74680064, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x64695623, 0x68006f65, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x64612365,
+    0x65636976, 0x74786554, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x69766461, 0x69546563,
+    0x6800656d, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x67612365, 0x74680065, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x616c6123,
+    0x74536d72, 0x73757461, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x72616c61, 0x6d69546d,
+    0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x776e6123, 0x64657265, 0x68006f54, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x75612365, 0x65526874, 0x73657571, 0x61745374, 0x00737574, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x63236572, 0x754e7261, 0x7265626d, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x65646f63,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x746e6f63, 0x446e6961, 0x61657369, 0x00736573,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x63236572, 0x61746e6f, 0x43456e69, 0x72755347, 0x73796576,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x746e6f63, 0x556e6961, 0x75534853, 0x79657672,
+    0x74680073, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x6e6f6323, 0x6e696174, 0x6c694673, 0x74680065,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x6e6f6323, 0x6e696174, 0x62755373, 0x70736552, 0x65736e6f,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x746e6f63, 0x736e6961, 0x74786554, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x63736564, 0x74706972, 0x006e6f69, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x64236572,
+    0x6f686369, 0x6f6d6f74, 0x74497375, 0x68006d65, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x69642365,
+    0x73616573, 0x73654465, 0x70697263, 0x6e6f6974, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x65736964, 0x54657361, 0x00657079, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x64236572, 0x6d75636f,
+    0x4e746e65, 0x65626d75, 0x6c754672, 0x7468006c, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x636f6423,
+    0x6e656d75, 0x6c655274, 0x65736165, 0x65746144, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x75636f64, 0x746e656d, 0x65707954, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x61736f64,
+    0x68006567, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x72642365, 0x6e416775, 0x61746f6e, 0x6e6f6974,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x67757264, 0x656d614e, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x69757165, 0x72615070, 0x74656d61, 0x68007265, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x69662365,
+    0x51747372, 0x74736575, 0x006e6f69, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x66236572, 0x50656572,
+    0x65697461, 0x6143746e, 0x69636170, 0x68007974, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x61682365,
+    0x63634173, 0x00737365, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572,
+    0x67726f2e, 0x616d732f, 0x61637472, 0x68236572, 0x6d417361, 0x636f4c62,
+    0x6f697461, 0x7468006e, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x73616823, 0x77736e41, 0x68007265,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x61682365, 0x636f4473, 0x00726f74, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x68236572,
+    0x6f447361, 0x656d7563, 0x6800746e, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x61682365, 0x75724473,
+    0x4d6f5467, 0x63696465, 0x00656e69, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x68236572, 0x72447361,
+    0x6f546775, 0x656c6153, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x44736168, 0x54677572,
+    0x7661536f, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x73616823, 0x67757244, 0x61546f54,
+    0x6800656b, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x61682365, 0x65654673, 0x63616264, 0x7468006b,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x73616823, 0x70736f48, 0x61636f4c, 0x6e6f6974, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x4d736168, 0x63696465, 0x65526c61, 0x64726f63, 0x72614373,
+    0x74680064, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x73616823, 0x69746150, 0x4d746e65, 0x68007061,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x61682365, 0x74615073, 0x746e6569, 0x7274654d, 0x00736369,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x68236572, 0x65507361, 0x6f4c7372, 0x69746163, 0x68006e6f,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x61682365, 0x61685073, 0x6f4c6d72, 0x69746163, 0x68006e6f,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x61682365, 0x726f5073, 0x6c626174, 0x75714565, 0x656d7069,
+    0x6800746e, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x61682365, 0x65755173, 0x6f697473, 0x7468006e,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x73616823, 0x70736552, 0x65736e6f, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x52736168, 0x6f707365, 0x4965736e, 0x006d6574, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x68236572,
+    0x74537361, 0x6f697461, 0x4572616e, 0x70697571, 0x746e656d, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x70736f68, 0x6c617469, 0x656d614e, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x00676d69, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x69236572, 0x6c6e4f73, 0x00656e69, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x69236572, 0x74615073, 0x746e6569, 0x6f636c41, 0x416c6f68, 0x63696464,
+    0x00646574, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x69236572, 0x74615073, 0x746e6569, 0x67757244,
+    0x69646441, 0x64657463, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x61507369, 0x6e656974,
+    0x64654d74, 0x6e696369, 0x64644165, 0x65746369, 0x74680064, 0x2f3a7074,
+    0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163,
+    0x50736923, 0x65697461, 0x6d53746e, 0x00656b6f, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x69236572,
+    0x536d6574, 0x65726f63, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x6d657469, 0x74786554,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x0074616c, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x6c236572, 0x42746665,
+    0x6c6f7069, 0x68007261, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375,
+    0x2f67726f, 0x72616d73, 0x72616374, 0x696c2365, 0x64656b6e, 0x68746957,
+    0x6d657449, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x676e6f6c, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x786f626d, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x746c756d, 0x656c7069, 0x6d657449,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x656d616e, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x7478656e,
+    0x73657551, 0x6e6f6974, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x73736170, 0x68747541,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x73736170, 0x64726f77, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x69746170, 0x42746e65, 0x646f6f6c, 0x65707954, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x69746170, 0x48746e65, 0x68676965, 0x74680074, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x74617023,
+    0x746e6569, 0x61466852, 0x726f7463, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x69746170,
+    0x57746e65, 0x68676965, 0x74680074, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x72657023, 0x496e6f73,
+    0x726f666e, 0x6974616d, 0x68006e6f, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x68702365, 0x4e6d7261,
+    0x00656d61, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x70236572, 0x656e6f68, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x676e6172, 0x49676e69, 0x006d6574, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x72236572, 0x79646165,
+    0x65486f54, 0x6800706c, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375,
+    0x2f67726f, 0x72616d73, 0x72616374, 0x65722365, 0x6e6f7073, 0x54646564,
+    0x7468006f, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x73657223, 0x736e6f70, 0x6c694665, 0x69725565,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x70736572, 0x65736e6f, 0x74786554, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x70736572, 0x65736e6f, 0x6c416f54, 0x006d7261, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x72236572, 0x74686769, 0x6f706942, 0x0072616c, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x73236572,
+    0x41646e65, 0x63697664, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6e657323, 0x616c4164,
+    0x68006d72, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x65732365, 0x79657672, 0x61746144, 0x6b6e694c,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x76726573, 0x61447965, 0x68006574, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x65732365, 0x79657672, 0x63736544, 0x74706972, 0x006e6f69, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x73236572, 0x65767265, 0x73655279, 0x00746c75, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x73236572,
+    0x65767265, 0x70795479, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x72657323, 0x55796576,
+    0x6e496873, 0x68006f66, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375,
+    0x2f67726f, 0x72616d73, 0x72616374, 0x69732365, 0x656c676e, 0x6d657449,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x63657073, 0x6c6c6169, 0x00797469, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x73236572, 0x6e416275, 0x72657773, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x6e727573,
+    0x00656d61, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x73236572, 0x65767275, 0x67634579, 0x6f666e49,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x656b6174, 0x67757244, 0x656d6954, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x45657375, 0x70697571, 0x746e656d, 0x656d6954, 0x74746800,
+    0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261,
+    0x23657261, 0x72657375, 0x656d616e, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x6b726f77,
+    0x75626d41, 0x636e616c, 0x74680065, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x726f7723, 0x736f486b,
+    0x61746970, 0x7468006c, 0x2f3a7074, 0x7777772f, 0x2e33772e, 0x2f67726f,
+    0x39393931, 0x2f32302f, 0x722d3232, 0x732d6664, 0x61746e79, 0x736e2d78,
+    0x6f725023, 0x74726570, 0x74680079, 0x2f3a7074, 0x7777772f, 0x2e33772e,
+    0x2f67726f, 0x39393931, 0x2f32302f, 0x722d3232, 0x732d6664, 0x61746e79,
+    0x736e2d78, 0x70797423, 0x74680065, 0x2f3a7074, 0x7777772f, 0x2e33772e,
+    0x2f67726f, 0x30303032, 0x2f31302f, 0x2d666472, 0x65686373, 0x4323616d,
+    0x7373616c, 0x74746800, 0x2f2f3a70, 0x2e777777, 0x6f2e3377, 0x322f6772,
+    0x2f323030, 0x6f2f3730, 0x4e236c77, 0x6968746f, 0x6800676e, 0x3a707474,
+    0x77772f2f, 0x33772e77, 0x67726f2e, 0x3030322f, 0x37302f32, 0x6c776f2f,
+    0x69685423, 0x0000676e,
+};
+
+
+const sslog_ontology_t SMARTCARE_ONTOLOGY = {
+    "smartcare",
+    SMARTCARE_ENTITIES, 156,
+    SMARTCARE_HASH_SEEDS, 39,
+    SMARTCARE_HASH_SLOTS, 195,
+    SMARTCARE_SCHEMA, sizeof(SMARTCARE_SCHEMA)
+};
 
 
 #if INCLUDE_CLASS_RANGINGSCALE
-sslog_class_t *CLASS_RANGINGSCALE;
+sslog_class_t *CLASS_RANGINGSCALE = &SMARTCARE_CLASSES[0];
 #endif
 #if INCLUDE_CLASS_QUESTIONNAIRE
-sslog_class_t *CLASS_QUESTIONNAIRE;
+sslog_class_t *CLASS_QUESTIONNAIRE = &SMARTCARE_CLASSES[1];
 #endif
 #if INCLUDE_CLASS_THING
-sslog_class_t *CLASS_THING;
+sslog_class_t *CLASS_THING = &SMARTCARE_CLASSES[2];
 #endif
 #if INCLUDE_CLASS_ALARM
-sslog_class_t *CLASS_ALARM;
+sslog_class_t *CLASS_ALARM = &SMARTCARE_CLASSES[3];
 #endif
 #if INCLUDE_CLASS_RESPONSETEXT
-sslog_class_t *CLASS_RESPONSETEXT;
+sslog_class_t *CLASS_RESPONSETEXT = &SMARTCARE_CLASSES[4];
 #endif
 #if INCLUDE_CLASS_LOCATION
-sslog_class_t *CLASS_LOCATION;
+sslog_class_t *CLASS_LOCATION = &SMARTCARE_CLASSES[5];
 #endif
 #if INCLUDE_CLASS_DICHOTOMOUS
-sslog_class_t *CLASS_DICHOTOMOUS;
+sslog_class_t *CLASS_DICHOTOMOUS = &SMARTCARE_CLASSES[6];
 #endif
 #if INCLUDE_CLASS_CHOISE
-sslog_class_t *CLASS_CHOISE;
+sslog_class_t *CLASS_CHOISE = &SMARTCARE_CLASSES[7];
 #endif
 #if INCLUDE_CLASS_PATIENTMETRICS
-sslog_class_t *CLASS_PATIENTMETRICS;
+sslog_class_t *CLASS_PATIENTMETRICS = &SMARTCARE_CLASSES[8];
 #endif
 #if INCLUDE_CLASS_FEEDBACK
-sslog_class_t *CLASS_FEEDBACK;
+sslog_class_t *CLASS_FEEDBACK = &SMARTCARE_CLASSES[9];
 #endif
 #if INCLUDE_CLASS_PHARMACY
-sslog_class_t *CLASS_PHARMACY;
+sslog_class_t *CLASS_PHARMACY = &SMARTCARE_CLASSES[10];
 #endif
 #if INCLUDE_CLASS_GUTTMANSCALE
-sslog_class_t *CLASS_GUTTMANSCALE;
+sslog_class_t *CLASS_GUTTMANSCALE = &SMARTCARE_CLASSES[11];
 #endif
 #if INCLUDE_CLASS_RESPONSEFILE
-sslog_class_t *CLASS_RESPONSEFILE;
+sslog_class_t *CLASS_RESPONSEFILE = &SMARTCARE_CLASSES[12];
 #endif
 #if INCLUDE_CLASS_RESPONSE
-sslog_class_t *CLASS_RESPONSE;
+sslog_class_t *CLASS_RESPONSE = &SMARTCARE_CLASSES[13];
 #endif
 #if INCLUDE_CLASS_DOCUMENT
-sslog_class_t *CLASS_DOCUMENT;
+sslog_class_t *CLASS_DOCUMENT = &SMARTCARE_CLASSES[14];
 #endif
 #if INCLUDE_CLASS_BED
-sslog_class_t *CLASS_BED;
+sslog_class_t *CLASS_BED = &SMARTCARE_CLASSES[15];
 #endif
 #if INCLUDE_CLASS_MEDIC
-sslog_class_t *CLASS_MEDIC;
+sslog_class_t *CLASS_MEDIC = &SMARTCARE_CLASSES[16];
 #endif
 #if INCLUDE_CLASS_USHSERVEY
-sslog_class_t *CLASS_USHSERVEY;
+sslog_class_t *CLASS_USHSERVEY = &SMARTCARE_CLASSES[17];
 #endif
 #if INCLUDE_CLASS_CARING
-sslog_class_t *CLASS_CARING;
+sslog_class_t *CLASS_CARING = &SMARTCARE_CLASSES[18];
 #endif
 #if INCLUDE_CLASS_PHONE
-sslog_class_t *CLASS_PHONE;
+sslog_class_t *CLASS_PHONE = &SMARTCARE_CLASSES[19];
 #endif
 #if INCLUDE_CLASS_AMBULANCE
-sslog_class_t *CLASS_AMBULANCE;
+sslog_class_t *CLASS_AMBULANCE = &SMARTCARE_CLASSES[20];
 #endif
 #if INCLUDE_CLASS_CLOSEDANSWER
-sslog_class_t *CLASS_CLOSEDANSWER;
+sslog_class_t *CLASS_CLOSEDANSWER = &SMARTCARE_CLASSES[21];
 #endif
 #if INCLUDE_CLASS_RESPONSEITEM
-sslog_class_t *CLASS_RESPONSEITEM;
+sslog_class_t *CLASS_RESPONSEITEM = &SMARTCARE_CLASSES[22];
 #endif
 #if INCLUDE_CLASS_PATIENT
-sslog_class_t *CLASS_PATIENT;
+sslog_class_t *CLASS_PATIENT = &SMARTCARE_CLASSES[23];
 #endif
 #if INCLUDE_CLASS_PERSON
-sslog_class_t *CLASS_PERSON;
+sslog_class_t *CLASS_PERSON = &SMARTCARE_CLASSES[24];
 #endif
 #if INCLUDE_CLASS_AUTHREQUEST
-sslog_class_t *CLASS_AUTHREQUEST;
+sslog_class_t *CLASS_AUTHREQUEST = &SMARTCARE_CLASSES[25];
 #endif
 #if INCLUDE_CLASS_PHOTO
-sslog_class_t *CLASS_PHOTO;
+sslog_class_t *CLASS_PHOTO = &SMARTCARE_CLASSES[26];
 #endif
 #if INCLUDE_CLASS_DOCTOR
-sslog_class_t *CLASS_DOCTOR;
+sslog_class_t *CLASS_DOCTOR = &SMARTCARE_CLASSES[27];
 #endif
 #if INCLUDE_CLASS_NURSE
-sslog_class_t *CLASS_NURSE;
+sslog_class_t *CLASS_NURSE = &SMARTCARE_CLASSES[28];
 #endif
 #if INCLUDE_CLASS_LIKERTSCALE
-sslog_class_t *CLASS_LIKERTSCALE;
+sslog_class_t *CLASS_LIKERTSCALE = &SMARTCARE_CLASSES[29];
 #endif
 #if INCLUDE_CLASS_AUDIO
-sslog_class_t *CLASS_AUDIO;
+sslog_class_t *CLASS_AUDIO = &SMARTCARE_CLASSES[30];
 #endif
 #if INCLUDE_CLASS_CONTINUOUSSCALE
-sslog_class_t *CLASS_CONTINUOUSSCALE;
+sslog_class_t *CLASS_CONTINUOUSSCALE = &SMARTCARE_CLASSES[31];
 #endif
 #if INCLUDE_CLASS_FILE
-sslog_class_t *CLASS_FILE;
+sslog_class_t *CLASS_FILE = &SMARTCARE_CLASSES[32];
 #endif
 #if INCLUDE_CLASS_ADVICE
-sslog_class_t *CLASS_ADVICE;
+sslog_class_t *CLASS_ADVICE = &SMARTCARE_CLASSES[33];
 #endif
 #if INCLUDE_CLASS_TEXT
-sslog_class_t *CLASS_TEXT;
+sslog_class_t *CLASS_TEXT = &SMARTCARE_CLASSES[34];
 #endif
 #if INCLUDE_CLASS_MEDICALRECORDSCARD
-sslog_class_t *CLASS_MEDICALRECORDSCARD;
+sslog_class_t *CLASS_MEDICALRECORDSCARD = &SMARTCARE_CLASSES[35];
 #endif
 #if INCLUDE_CLASS_ANSWER
-sslog_class_t *CLASS_ANSWER;
+sslog_class_t *CLASS_ANSWER = &SMARTCARE_CLASSES[36];
 #endif
 #if INCLUDE_CLASS_NOTHING
-sslog_class_t *CLASS_NOTHING;
+sslog_class_t *CLASS_NOTHING = &SMARTCARE_CLASSES[37];
 #endif
 #if INCLUDE_CLASS_MULTIPLECHOISE
-sslog_class_t *CLASS_MULTIPLECHOISE;
+sslog_class_t *CLASS_MULTIPLECHOISE = &SMARTCARE_CLASSES[38];
 #endif
 #if INCLUDE_CLASS_ITEM
-sslog_class_t *CLASS_ITEM;
+sslog_class_t *CLASS_ITEM = &SMARTCARE_CLASSES[39];
 #endif
 #if INCLUDE_CLASS_HOSPITAL
-sslog_class_t *CLASS_HOSPITAL;
+sslog_class_t *CLASS_HOSPITAL = &SMARTCARE_CLASSES[40];
 #endif
 #if INCLUDE_CLASS_SERVEY
-sslog_class_t *CLASS_SERVEY;
+sslog_class_t *CLASS_SERVEY = &SMARTCARE_CLASSES[41];
 #endif
 #if INCLUDE_CLASS_PROFILE
-sslog_class_t *CLASS_PROFILE;
+sslog_class_t *CLASS_PROFILE = &SMARTCARE_CLASSES[42];
 #endif
 #if INCLUDE_CLASS_NUMBER
-sslog_class_t *CLASS_NUMBER;
+sslog_class_t *CLASS_NUMBER = &SMARTCARE_CLASSES[43];
 #endif
 #if INCLUDE_CLASS_VIDEO
-sslog_class_t *CLASS_VIDEO;
+sslog_class_t *CLASS_VIDEO = &SMARTCARE_CLASSES[44];
 #endif
 #if INCLUDE_CLASS_DISEASE
-sslog_class_t *CLASS_DISEASE;
+sslog_class_t *CLASS_DISEASE = &SMARTCARE_CLASSES[45];
 #endif
 #if INCLUDE_CLASS_ECGSERVEY
-sslog_class_t *CLASS_ECGSERVEY;
+sslog_class_t *CLASS_ECGSERVEY = &SMARTCARE_CLASSES[46];
 #endif
 #if INCLUDE_CLASS_OPENANSWER
-sslog_class_t *CLASS_OPENANSWER;
+sslog_class_t *CLASS_OPENANSWER = &SMARTCARE_CLASSES[47];
 #endif
 #if INCLUDE_CLASS_PATIENTMAP
-sslog_class_t *CLASS_PATIENTMAP;
+sslog_class_t *CLASS_PATIENTMAP = &SMARTCARE_CLASSES[48];
 #endif
 #if INCLUDE_CLASS_QUESTION
-sslog_class_t *CLASS_QUESTION;
+sslog_class_t *CLASS_QUESTION = &SMARTCARE_CLASSES[49];
 #endif
 #if INCLUDE_CLASS_EQUIPMENT
-sslog_class_t *CLASS_EQUIPMENT;
+sslog_class_t *CLASS_EQUIPMENT = &SMARTCARE_CLASSES[50];
 #endif
 #if INCLUDE_CLASS_DRUG
-sslog_class_t *CLASS_DRUG;
+sslog_class_t *CLASS_DRUG = &SMARTCARE_CLASSES[51];
 #endif
 #if INCLUDE_CLASS_SINGLECHOISE
-sslog_class_t *CLASS_SINGLECHOISE;
+sslog_class_t *CLASS_SINGLECHOISE = &SMARTCARE_CLASSES[52];
 #endif
 #if INCLUDE_CLASS_VALIDATED
-sslog_class_t *CLASS_VALIDATED;
+sslog_class_t *CLASS_VALIDATED = &SMARTCARE_CLASSES[53];
 #endif
 #if INCLUDE_CLASS_EMAIL
-sslog_class_t *CLASS_EMAIL;
+sslog_class_t *CLASS_EMAIL = &SMARTCARE_CLASSES[54];
 #endif
 #if INCLUDE_CLASS_BIPOLARQUESTION
-sslog_class_t *CLASS_BIPOLARQUESTION;
+sslog_class_t *CLASS_BIPOLARQUESTION = &SMARTCARE_CLASSES[55];
 #endif
 
 
 #if INCLUDE_PROPERTY_HASSTATIONAREQUIPMENT
-sslog_property_t *PROPERTY_HASSTATIONAREQUIPMENT;
+sslog_property_t *PROPERTY_HASSTATIONAREQUIPMENT = &SMARTCARE_PROPERTIES[0];
 #endif
 #if INCLUDE_PROPERTY_TAKEDRUGTIME
-sslog_property_t *PROPERTY_TAKEDRUGTIME;
+sslog_property_t *PROPERTY_TAKEDRUGTIME = &SMARTCARE_PROPERTIES[1];
 #endif
 #if INCLUDE_PROPERTY_HASPATIENTMAP
-sslog_property_t *PROPERTY_HASPATIENTMAP;
+sslog_property_t *PROPERTY_HASPATIENTMAP = &SMARTCARE_PROPERTIES[2];
 #endif
 #if INCLUDE_PROPERTY_RESPONSETOALARM
-sslog_property_t *PROPERTY_RESPONSETOALARM;
+sslog_property_t *PROPERTY_RESPONSETOALARM = &SMARTCARE_PROPERTIES[3];
 #endif
 #if INCLUDE_PROPERTY_ISPATIENTDRUGADDICTED
-sslog_property_t *PROPERTY_ISPATIENTDRUGADDICTED;
+sslog_property_t *PROPERTY_ISPATIENTDRUGADDICTED = &SMARTCARE_PROPERTIES[4];
 #endif
 #if INCLUDE_PROPERTY_RESPONSEFILEURI
-sslog_property_t *PROPERTY_RESPONSEFILEURI;
+sslog_property_t *PROPERTY_RESPONSEFILEURI = &SMARTCARE_PROPERTIES[5];
 #endif
 #if INCLUDE_PROPERTY_LEFTBIPOLAR
-sslog_property_t *PROPERTY_LEFTBIPOLAR;
+sslog_property_t *PROPERTY_LEFTBIPOLAR = &SMARTCARE_PROPERTIES[6];
 #endif
 #if INCLUDE_PROPERTY_USEEQUIPMENTTIME
-sslog_property_t *PROPERTY_USEEQUIPMENTTIME;
+sslog_property_t *PROPERTY_USEEQUIPMENTTIME = &SMARTCARE_PROPERTIES[7];
 #endif
 #if INCLUDE_PROPERTY_USERNAME
-sslog_property_t *PROPERTY_USERNAME;
+sslog_property_t *PROPERTY_USERNAME = &SMARTCARE_PROPERTIES[8];
 #endif
 #if INCLUDE_PROPERTY_ISONLINE
-sslog_property_t *PROPERTY_ISONLINE;
+sslog_property_t *PROPERTY_ISONLINE = &SMARTCARE_PROPERTIES[9];
 #endif
 #if INCLUDE_PROPERTY_FREEPATIENTCAPACITY
-sslog_property_t *PROPERTY_FREEPATIENTCAPACITY;
+sslog_property_t *PROPERTY_FREEPATIENTCAPACITY = &SMARTCARE_PROPERTIES[10];
 #endif
 #if INCLUDE_PROPERTY_EQUIPPARAMETER
-sslog_property_t *PROPERTY_EQUIPPARAMETER;
+sslog_property_t *PROPERTY_EQUIPPARAMETER = &SMARTCARE_PROPERTIES[11];
 #endif
 #if INCLUDE_PROPERTY_HASDRUGTOSAVE
-sslog_property_t *PROPERTY_HASDRUGTOSAVE;
+sslog_property_t *PROPERTY_HASDRUGTOSAVE = &SMARTCARE_PROPERTIES[12];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSSUBRESPONSE
-sslog_property_t *PROPERTY_CONTAINSSUBRESPONSE;
+sslog_property_t *PROPERTY_CONTAINSSUBRESPONSE = &SMARTCARE_PROPERTIES[13];
 #endif
 #if INCLUDE_PROPERTY_PATIENTWEIGHT
-sslog_property_t *PROPERTY_PATIENTWEIGHT;
+sslog_property_t *PROPERTY_PATIENTWEIGHT = &SMARTCARE_PROPERTIES[14];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSFILE
-sslog_property_t *PROPERTY_CONTAINSFILE;
+sslog_property_t *PROPERTY_CONTAINSFILE = &SMARTCARE_PROPERTIES[15];
 #endif
 #if INCLUDE_PROPERTY_READYTOHELP
-sslog_property_t *PROPERTY_READYTOHELP;
+sslog_property_t *PROPERTY_READYTOHELP = &SMARTCARE_PROPERTIES[16];
 #endif
 #if INCLUDE_PROPERTY_IMG
-sslog_property_t *PROPERTY_IMG;
+sslog_property_t *PROPERTY_IMG = &SMARTCARE_PROPERTIES[17];
 #endif
 #if INCLUDE_PROPERTY_PASSAUTH
-sslog_property_t *PROPERTY_PASSAUTH;
+sslog_property_t *PROPERTY_PASSAUTH = &SMARTCARE_PROPERTIES[18];
 #endif
 #if INCLUDE_PROPERTY_HOSPITALNAME
-sslog_property_t *PROPERTY_HOSPITALNAME;
+sslog_property_t *PROPERTY_HOSPITALNAME = &SMARTCARE_PROPERTIES[19];
 #endif
 #if INCLUDE_PROPERTY_HASDOCTOR
-sslog_property_t *PROPERTY_HASDOCTOR;
+sslog_property_t *PROPERTY_HASDOCTOR = &SMARTCARE_PROPERTIES[20];
 #endif
 #if INCLUDE_PROPERTY_CARNUMBER
-sslog_property_t *PROPERTY_CARNUMBER;
+sslog_property_t *PROPERTY_CARNUMBER = &SMARTCARE_PROPERTIES[21];
 #endif
 #if INCLUDE_PROPERTY_ITEMTEXT
-sslog_property_t *PROPERTY_ITEMTEXT;
+sslog_property_t *PROPERTY_ITEMTEXT = &SMARTCARE_PROPERTIES[22];
 #endif
 #if INCLUDE_PROPERTY_SENDALARM
-sslog_property_t *PROPERTY_SENDALARM;
+sslog_property_t *PROPERTY_SENDALARM = &SMARTCARE_PROPERTIES[23];
 #endif
 #if INCLUDE_PROPERTY_HASDRUGTOMEDICINE
-sslog_property_t *PROPERTY_HASDRUGTOMEDICINE;
+sslog_property_t *PROPERTY_HASDRUGTOMEDICINE = &SMARTCARE_PROPERTIES[24];
 #endif
 #if INCLUDE_PROPERTY_SPECIALLITY
-sslog_property_t *PROPERTY_SPECIALLITY;
+sslog_property_t *PROPERTY_SPECIALLITY = &SMARTCARE_PROPERTIES[25];
 #endif
 #if INCLUDE_PROPERTY_HASQUESTION
-sslog_property_t *PROPERTY_HASQUESTION;
+sslog_property_t *PROPERTY_HASQUESTION = &SMARTCARE_PROPERTIES[26];
 #endif
 #if INCLUDE_PROPERTY_ADVICETEXT
-sslog_property_t *PROPERTY_ADVICETEXT;
+sslog_property_t *PROPERTY_ADVICETEXT = &SMARTCARE_PROPERTIES[27];
 #endif
 #if INCLUDE_PROPERTY_HASDRUGTOTAKE
-sslog_property_t *PROPERTY_HASDRUGTOTAKE;
+sslog_property_t *PROPERTY_HASDRUGTOTAKE = &SMARTCARE_PROPERTIES[28];
 #endif
 #if INCLUDE_PROPERTY_HASMEDICALRECORDSCARD
-sslog_property_t *PROPERTY_HASMEDICALRECORDSCARD;
+sslog_property_t *PROPERTY_HASMEDICALRECORDSCARD = &SMARTCARE_PROPERTIES[29];
 #endif
 #if INCLUDE_PROPERTY_HASACCESS
-sslog_property_t *PROPERTY_HASACCESS;
+sslog_property_t *PROPERTY_HASACCESS = &SMARTCARE_PROPERTIES[30];
 #endif
 #if INCLUDE_PROPERTY_DRUGNAME
-sslog_property_t *PROPERTY_DRUGNAME;
+sslog_property_t *PROPERTY_DRUGNAME = &SMARTCARE_PROPERTIES[31];
 #endif
 #if INCLUDE_PROPERTY_CONTAINECGSURVEYS
-sslog_property_t *PROPERTY_CONTAINECGSURVEYS;
+sslog_property_t *PROPERTY_CONTAINECGSURVEYS = &SMARTCARE_PROPERTIES[32];
 #endif
 #if INCLUDE_PROPERTY_DICHOTOMOUSITEM
-sslog_property_t *PROPERTY_DICHOTOMOUSITEM;
+sslog_property_t *PROPERTY_DICHOTOMOUSITEM = &SMARTCARE_PROPERTIES[33];
 #endif
 #if INCLUDE_PROPERTY_MULTIPLEITEM
-sslog_property_t *PROPERTY_MULTIPLEITEM;
+sslog_property_t *PROPERTY_MULTIPLEITEM = &SMARTCARE_PROPERTIES[34];
 #endif
 #if INCLUDE_PROPERTY_SENDADVICE
-sslog_property_t *PROPERTY_SENDADVICE;
+sslog_property_t *PROPERTY_SENDADVICE = &SMARTCARE_PROPERTIES[35];
 #endif
 #if INCLUDE_PROPERTY_HASRESPONSEITEM
-sslog_property_t *PROPERTY_HASRESPONSEITEM;
+sslog_property_t *PROPERTY_HASRESPONSEITEM = &SMARTCARE_PROPERTIES[36];
 #endif
 #if INCLUDE_PROPERTY_RIGHTBIPOLAR
-sslog_property_t *PROPERTY_RIGHTBIPOLAR;
+sslog_property_t *PROPERTY_RIGHTBIPOLAR = &SMARTCARE_PROPERTIES[37];
 #endif
 #if INCLUDE_PROPERTY_HASDOCUMENT
-sslog_property_t *PROPERTY_HASDOCUMENT;
+sslog_property_t *PROPERTY_HASDOCUMENT = &SMARTCARE_PROPERTIES[38];
 #endif
 #if INCLUDE_PROPERTY_ISPATIENTMEDICINEADDICTED
-sslog_property_t *PROPERTY_ISPATIENTMEDICINEADDICTED;
+sslog_property_t *PROPERTY_ISPATIENTMEDICINEADDICTED = &SMARTCARE_PROPERTIES[39];
 #endif
 #if INCLUDE_PROPERTY_SERVEYDATE
-sslog_property_t *PROPERTY_SERVEYDATE;
+sslog_property_t *PROPERTY_SERVEYDATE = &SMARTCARE_PROPERTIES[40];
 #endif
 #if INCLUDE_PROPERTY_AGE
-sslog_property_t *PROPERTY_AGE;
+sslog_property_t *PROPERTY_AGE = &SMARTCARE_PROPERTIES[41];
 #endif
 #if INCLUDE_PROPERTY_ALARMSTATUS
-sslog_property_t *PROPERTY_ALARMSTATUS;
+sslog_property_t *PROPERTY_ALARMSTATUS = &SMARTCARE_PROPERTIES[42];
 #endif
 #if INCLUDE_PROPERTY_DRUGANNOTATION
-sslog_property_t *PROPERTY_DRUGANNOTATION;
+sslog_property_t *PROPERTY_DRUGANNOTATION = &SMARTCARE_PROPERTIES[43];
 #endif
 #if INCLUDE_PROPERTY_PATIENTBLOODTYPE
-sslog_property_t *PROPERTY_PATIENTBLOODTYPE;
+sslog_property_t *PROPERTY_PATIENTBLOODTYPE = &SMARTCARE_PROPERTIES[44];
 #endif
 #if INCLUDE_PROPERTY_ITEMSCORE
-sslog_property_t *PROPERTY_ITEMSCORE;
+sslog_property_t *PROPERTY_ITEMSCORE = &SMARTCARE_PROPERTIES[45];
 #endif
 #if INCLUDE_PROPERTY_PHARMNAME
-sslog_property_t *PROPERTY_PHARMNAME;
+sslog_property_t *PROPERTY_PHARMNAME = &SMARTCARE_PROPERTIES[46];
 #endif
 #if INCLUDE_PROPERTY_HASFEEDBACK
-sslog_property_t *PROPERTY_HASFEEDBACK;
+sslog_property_t *PROPERTY_HASFEEDBACK = &SMARTCARE_PROPERTIES[47];
 #endif
 #if INCLUDE_PROPERTY_HASPERSLOCATION
-sslog_property_t *PROPERTY_HASPERSLOCATION;
+sslog_property_t *PROPERTY_HASPERSLOCATION = &SMARTCARE_PROPERTIES[48];
 #endif
 #if INCLUDE_PROPERTY_PATIENTRHFACTOR
-sslog_property_t *PROPERTY_PATIENTRHFACTOR;
+sslog_property_t *PROPERTY_PATIENTRHFACTOR = &SMARTCARE_PROPERTIES[49];
 #endif
 #if INCLUDE_PROPERTY_SURVEYECGINFO
-sslog_property_t *PROPERTY_SURVEYECGINFO;
+sslog_property_t *PROPERTY_SURVEYECGINFO = &SMARTCARE_PROPERTIES[50];
 #endif
 #if INCLUDE_PROPERTY_CONTAINUSHSURVEYS
-sslog_property_t *PROPERTY_CONTAINUSHSURVEYS;
+sslog_property_t *PROPERTY_CONTAINUSHSURVEYS = &SMARTCARE_PROPERTIES[51];
 #endif
 #if INCLUDE_PROPERTY_SINGLEITEM
-sslog_property_t *PROPERTY_SINGLEITEM;
+sslog_property_t *PROPERTY_SINGLEITEM = &SMARTCARE_PROPERTIES[52];
 #endif
 #if INCLUDE_PROPERTY_HASAMBLOCATION
-sslog_property_t *PROPERTY_HASAMBLOCATION;
+sslog_property_t *PROPERTY_HASAMBLOCATION = &SMARTCARE_PROPERTIES[53];
 #endif
 #if INCLUDE_PROPERTY_DISEASEDESCRIPTION
-sslog_property_t *PROPERTY_DISEASEDESCRIPTION;
+sslog_property_t *PROPERTY_DISEASEDESCRIPTION = &SMARTCARE_PROPERTIES[54];
 #endif
 #if INCLUDE_PROPERTY_HASDRUGTOSALE
-sslog_property_t *PROPERTY_HASDRUGTOSALE;
+sslog_property_t *PROPERTY_HASDRUGTOSALE = &SMARTCARE_PROPERTIES[55];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSTEXT
-sslog_property_t *PROPERTY_CONTAINSTEXT;
+sslog_property_t *PROPERTY_CONTAINSTEXT = &SMARTCARE_PROPERTIES[56];
 #endif
 #if INCLUDE_PROPERTY_SERVEYRESULT
-sslog_property_t *PROPERTY_SERVEYRESULT;
+sslog_property_t *PROPERTY_SERVEYRESULT = &SMARTCARE_PROPERTIES[57];
 #endif
 #if INCLUDE_PROPERTY_PATIENTHEIGHT
-sslog_property_t *PROPERTY_PATIENTHEIGHT;
+sslog_property_t *PROPERTY_PATIENTHEIGHT = &SMARTCARE_PROPERTIES[58];
 #endif
 #if INCLUDE_PROPERTY_WORKHOSPITAL
-sslog_property_t *PROPERTY_WORKHOSPITAL;
+sslog_property_t *PROPERTY_WORKHOSPITAL = &SMARTCARE_PROPERTIES[59];
 #endif
 #if INCLUDE_PROPERTY_ALARMTIME
-sslog_property_t *PROPERTY_ALARMTIME;
+sslog_property_t *PROPERTY_ALARMTIME = &SMARTCARE_PROPERTIES[60];
 #endif
 #if INCLUDE_PROPERTY_HASHOSPLOCATION
-sslog_property_t *PROPERTY_HASHOSPLOCATION;
+sslog_property_t *PROPERTY_HASHOSPLOCATION = &SMARTCARE_PROPERTIES[61];
 #endif
 #if INCLUDE_PROPERTY_PHONE
-sslog_property_t *PROPERTY_PHONE;
+sslog_property_t *PROPERTY_PHONE = &SMARTCARE_PROPERTIES[62];
 #endif
 #if INCLUDE_PROPERTY_SUBANSWER
-sslog_property_t *PROPERTY_SUBANSWER;
+sslog_property_t *PROPERTY_SUBANSWER = &SMARTCARE_PROPERTIES[63];
 #endif
 #if INCLUDE_PROPERTY_RANGINGITEM
-sslog_property_t *PROPERTY_RANGINGITEM;
+sslog_property_t *PROPERTY_RANGINGITEM = &SMARTCARE_PROPERTIES[64];
 #endif
 #if INCLUDE_PROPERTY_CODE
-sslog_property_t *PROPERTY_CODE;
+sslog_property_t *PROPERTY_CODE = &SMARTCARE_PROPERTIES[65];
 #endif
 #if INCLUDE_PROPERTY_RESPONDEDTO
-sslog_property_t *PROPERTY_RESPONDEDTO;
+sslog_property_t *PROPERTY_RESPONDEDTO = &SMARTCARE_PROPERTIES[66];
 #endif
 #if INCLUDE_PROPERTY_DESCRIPTION
-sslog_property_t *PROPERTY_DESCRIPTION;
+sslog_property_t *PROPERTY_DESCRIPTION = &SMARTCARE_PROPERTIES[67];
 #endif
 #if INCLUDE_PROPERTY_HASANSWER
-sslog_property_t *PROPERTY_HASANSWER;
+sslog_property_t *PROPERTY_HASANSWER = &SMARTCARE_PROPERTIES[68];
 #endif
 #if INCLUDE_PROPERTY_HASPHARMLOCATION
-sslog_property_t *PROPERTY_HASPHARMLOCATION;
+sslog_property_t *PROPERTY_HASPHARMLOCATION = &SMARTCARE_PROPERTIES[69];
 #endif
 #if INCLUDE_PROPERTY_SERVEYDATALINK
-sslog_property_t *PROPERTY_SERVEYDATALINK;
+sslog_property_t *PROPERTY_SERVEYDATALINK = &SMARTCARE_PROPERTIES[70];
 #endif
 #if INCLUDE_PROPERTY_ISPATIENTSMOKE
-sslog_property_t *PROPERTY_ISPATIENTSMOKE;
+sslog_property_t *PROPERTY_ISPATIENTSMOKE = &SMARTCARE_PROPERTIES[71];
 #endif
 #if INCLUDE_PROPERTY_HASPATIENTMETRICS
-sslog_property_t *PROPERTY_HASPATIENTMETRICS;
+sslog_property_t *PROPERTY_HASPATIENTMETRICS = &SMARTCARE_PROPERTIES[72];
 #endif
 #if INCLUDE_PROPERTY_DOSAGE
-sslog_property_t *PROPERTY_DOSAGE;
+sslog_property_t *PROPERTY_DOSAGE = &SMARTCARE_PROPERTIES[73];
 #endif
 #if INCLUDE_PROPERTY_LINKEDWITHITEM
-sslog_property_t *PROPERTY_LINKEDWITHITEM;
+sslog_property_t *PROPERTY_LINKEDWITHITEM = &SMARTCARE_PROPERTIES[74];
 #endif
 #if INCLUDE_PROPERTY_SERVEYTYPE
-sslog_property_t *PROPERTY_SERVEYTYPE;
+sslog_property_t *PROPERTY_SERVEYTYPE = &SMARTCARE_PROPERTIES[75];
 #endif
 #if INCLUDE_PROPERTY_DOCUMENTNUMBERFULL
-sslog_property_t *PROPERTY_DOCUMENTNUMBERFULL;
+sslog_property_t *PROPERTY_DOCUMENTNUMBERFULL = &SMARTCARE_PROPERTIES[76];
 #endif
 #if INCLUDE_PROPERTY_LONG
-sslog_property_t *PROPERTY_LONG;
+sslog_property_t *PROPERTY_LONG = &SMARTCARE_PROPERTIES[77];
 #endif
 #if INCLUDE_PROPERTY_FIRSTQUESTION
-sslog_property_t *PROPERTY_FIRSTQUESTION;
+sslog_property_t *PROPERTY_FIRSTQUESTION = &SMARTCARE_PROPERTIES[78];
 #endif
 #if INCLUDE_PROPERTY_ANWEREDTO
-sslog_property_t *PROPERTY_ANWEREDTO;
+sslog_property_t *PROPERTY_ANWEREDTO = &SMARTCARE_PROPERTIES[79];
 #endif
 #if INCLUDE_PROPERTY_ISPATIENTALCOHOLADDICTED
-sslog_property_t *PROPERTY_ISPATIENTALCOHOLADDICTED;
+sslog_property_t *PROPERTY_ISPATIENTALCOHOLADDICTED = &SMARTCARE_PROPERTIES[80];
 #endif
 #if INCLUDE_PROPERTY_SERVEYDESCRIPTION
-sslog_property_t *PROPERTY_SERVEYDESCRIPTION;
+sslog_property_t *PROPERTY_SERVEYDESCRIPTION = &SMARTCARE_PROPERTIES[81];
 #endif
 #if INCLUDE_PROPERTY_DOCUMENTTYPE
-sslog_property_t *PROPERTY_DOCUMENTTYPE;
+sslog_property_t *PROPERTY_DOCUMENTTYPE = &SMARTCARE_PROPERTIES[82];
 #endif
 #if INCLUDE_PROPERTY_LAT
-sslog_property_t *PROPERTY_LAT;
+sslog_property_t *PROPERTY_LAT = &SMARTCARE_PROPERTIES[83];
 #endif
 #if INCLUDE_PROPERTY_SURNAME
-sslog_property_t *PROPERTY_SURNAME;
+sslog_property_t *PROPERTY_SURNAME = &SMARTCARE_PROPERTIES[84];
 #endif
 #if INCLUDE_PROPERTY_HASRESPONSE
-sslog_property_t *PROPERTY_HASRESPONSE;
+sslog_property_t *PROPERTY_HASRESPONSE = &SMARTCARE_PROPERTIES[85];
 #endif
 #if INCLUDE_PROPERTY_DOCUMENTRELEASEDATE
-sslog_property_t *PROPERTY_DOCUMENTRELEASEDATE;
+sslog_property_t *PROPERTY_DOCUMENTRELEASEDATE = &SMARTCARE_PROPERTIES[86];
 #endif
 #if INCLUDE_PROPERTY_PERSONINFORMATION
-sslog_property_t *PROPERTY_PERSONINFORMATION;
+sslog_property_t *PROPERTY_PERSONINFORMATION = &SMARTCARE_PROPERTIES[87];
 #endif
 #if INCLUDE_PROPERTY_AUTHREQUESTSTATUS
-sslog_property_t *PROPERTY_AUTHREQUESTSTATUS;
+sslog_property_t *PROPERTY_AUTHREQUESTSTATUS = &SMARTCARE_PROPERTIES[88];
 #endif
 #if INCLUDE_PROPERTY_RESPONSETEXT
-sslog_property_t *PROPERTY_RESPONSETEXT;
+sslog_property_t *PROPERTY_RESPONSETEXT = &SMARTCARE_PROPERTIES[89];
 #endif
 #if INCLUDE_PROPERTY_PASSWORD
-sslog_property_t *PROPERTY_PASSWORD;
+sslog_property_t *PROPERTY_PASSWORD = &SMARTCARE_PROPERTIES[90];
 #endif
 #if INCLUDE_PROPERTY_MBOX
-sslog_property_t *PROPERTY_MBOX;
+sslog_property_t *PROPERTY_MBOX = &SMARTCARE_PROPERTIES[91];
 #endif
 #if INCLUDE_PROPERTY_HASPORTABLEEQUIPMENT
-sslog_property_t *PROPERTY_HASPORTABLEEQUIPMENT;
+sslog_property_t *PROPERTY_HASPORTABLEEQUIPMENT = &SMARTCARE_PROPERTIES[92];
 #endif
 #if INCLUDE_PROPERTY_NEXTQUESTION
-sslog_property_t *PROPERTY_NEXTQUESTION;
+sslog_property_t *PROPERTY_NEXTQUESTION = &SMARTCARE_PROPERTIES[93];
 #endif
 #if INCLUDE_PROPERTY_WORKAMBULANCE
-sslog_property_t *PROPERTY_WORKAMBULANCE;
+sslog_property_t *PROPERTY_WORKAMBULANCE = &SMARTCARE_PROPERTIES[94];
 #endif
 #if INCLUDE_PROPERTY_NAME
-sslog_property_t *PROPERTY_NAME;
+sslog_property_t *PROPERTY_NAME = &SMARTCARE_PROPERTIES[95];
 #endif
 #if INCLUDE_PROPERTY_ADVICETIME
-sslog_property_t *PROPERTY_ADVICETIME;
+sslog_property_t *PROPERTY_ADVICETIME = &SMARTCARE_PROPERTIES[96];
 #endif
 #if INCLUDE_PROPERTY_DISEASETYPE
-sslog_property_t *PROPERTY_DISEASETYPE;
+sslog_property_t *PROPERTY_DISEASETYPE = &SMARTCARE_PROPERTIES[97];
 #endif
 #if INCLUDE_PROPERTY_SERVEYUSHINFO
-sslog_property_t *PROPERTY_SERVEYUSHINFO;
+sslog_property_t *PROPERTY_SERVEYUSHINFO = &SMARTCARE_PROPERTIES[98];
 #endif
 #if INCLUDE_PROPERTY_CONTAINDISEASES
-sslog_property_t *PROPERTY_CONTAINDISEASES;
+sslog_property_t *PROPERTY_CONTAINDISEASES = &SMARTCARE_PROPERTIES[99];
 #endif
 
 
@@ -478,484 +1442,13 @@ sslog_property_t *PROPERTY_CONTAINDISEASES;
 /**
  * @brief Register ontology.
  *
- * It creates all structures, such as classes and properties. Use it firs in your propgramm.
+ * Classes and properties are static, it attaches them and schema triples
+ * to the store of the default session. Use it first in your program.
  */
 void register_ontology()
-{    
-#if INCLUDE_PROPERTY_HASSTATIONAREQUIPMENT
-PROPERTY_HASSTATIONAREQUIPMENT =  sslog_new_property("http://oss.fruct.org/smartcare#hasStationarEquipment", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_TAKEDRUGTIME
-PROPERTY_TAKEDRUGTIME =  sslog_new_property("http://oss.fruct.org/smartcare#takeDrugTime", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASPATIENTMAP
-PROPERTY_HASPATIENTMAP =  sslog_new_property("http://oss.fruct.org/smartcare#hasPatientMap", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RESPONSETOALARM
-PROPERTY_RESPONSETOALARM =  sslog_new_property("http://oss.fruct.org/smartcare#responseToAlarm", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ISPATIENTDRUGADDICTED
-PROPERTY_ISPATIENTDRUGADDICTED =  sslog_new_property("http://oss.fruct.org/smartcare#isPatientDrugAddicted", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_RESPONSEFILEURI
-PROPERTY_RESPONSEFILEURI =  sslog_new_property("http://oss.fruct.org/smartcare#responseFileUri", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_LEFTBIPOLAR
-PROPERTY_LEFTBIPOLAR =  sslog_new_property("http://oss.fruct.org/smartcare#leftBipolar", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_USEEQUIPMENTTIME
-PROPERTY_USEEQUIPMENTTIME =  sslog_new_property("http://oss.fruct.org/smartcare#useEquipmentTime", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_USERNAME
-PROPERTY_USERNAME =  sslog_new_property("http://oss.fruct.org/smartcare#username", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ISONLINE
-PROPERTY_ISONLINE =  sslog_new_property("http://oss.fruct.org/smartcare#isOnline", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_FREEPATIENTCAPACITY
-PROPERTY_FREEPATIENTCAPACITY =  sslog_new_property("http://oss.fruct.org/smartcare#freePatientCapacity", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_EQUIPPARAMETER
-PROPERTY_EQUIPPARAMETER =  sslog_new_property("http://oss.fruct.org/smartcare#equipParameter", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASDRUGTOSAVE
-PROPERTY_HASDRUGTOSAVE =  sslog_new_property("http://oss.fruct.org/smartcare#hasDrugToSave", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSSUBRESPONSE
-PROPERTY_CONTAINSSUBRESPONSE =  sslog_new_property("http://oss.fruct.org/smartcare#containsSubResponse", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_PATIENTWEIGHT
-PROPERTY_PATIENTWEIGHT =  sslog_new_property("http://oss.fruct.org/smartcare#patientWeight", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSFILE
-PROPERTY_CONTAINSFILE =  sslog_new_property("http://oss.fruct.org/smartcare#containsFile", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_READYTOHELP
-PROPERTY_READYTOHELP =  sslog_new_property("http://oss.fruct.org/smartcare#readyToHelp", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_IMG
-PROPERTY_IMG =  sslog_new_property("http://oss.fruct.org/smartcare#img", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PASSAUTH
-PROPERTY_PASSAUTH =  sslog_new_property("http://oss.fruct.org/smartcare#passAuth", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HOSPITALNAME
-PROPERTY_HOSPITALNAME =  sslog_new_property("http://oss.fruct.org/smartcare#hospitalName", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASDOCTOR
-PROPERTY_HASDOCTOR =  sslog_new_property("http://oss.fruct.org/smartcare#hasDoctor", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CARNUMBER
-PROPERTY_CARNUMBER =  sslog_new_property("http://oss.fruct.org/smartcare#carNumber", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ITEMTEXT
-PROPERTY_ITEMTEXT =  sslog_new_property("http://oss.fruct.org/smartcare#itemText", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SENDALARM
-PROPERTY_SENDALARM =  sslog_new_property("http://oss.fruct.org/smartcare#sendAlarm", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASDRUGTOMEDICINE
-PROPERTY_HASDRUGTOMEDICINE =  sslog_new_property("http://oss.fruct.org/smartcare#hasDrugToMedicine", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SPECIALLITY
-PROPERTY_SPECIALLITY =  sslog_new_property("http://oss.fruct.org/smartcare#speciallity", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASQUESTION
-PROPERTY_HASQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#hasQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ADVICETEXT
-PROPERTY_ADVICETEXT =  sslog_new_property("http://oss.fruct.org/smartcare#adviceText", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASDRUGTOTAKE
-PROPERTY_HASDRUGTOTAKE =  sslog_new_property("http://oss.fruct.org/smartcare#hasDrugToTake", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASMEDICALRECORDSCARD
-PROPERTY_HASMEDICALRECORDSCARD =  sslog_new_property("http://oss.fruct.org/smartcare#hasMedicalRecordsCard", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASACCESS
-PROPERTY_HASACCESS =  sslog_new_property("http://oss.fruct.org/smartcare#hasAccess", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DRUGNAME
-PROPERTY_DRUGNAME =  sslog_new_property("http://oss.fruct.org/smartcare#drugName", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CONTAINECGSURVEYS
-PROPERTY_CONTAINECGSURVEYS =  sslog_new_property("http://oss.fruct.org/smartcare#containECGSurveys", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DICHOTOMOUSITEM
-PROPERTY_DICHOTOMOUSITEM =  sslog_new_property("http://oss.fruct.org/smartcare#dichotomousItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_MULTIPLEITEM
-PROPERTY_MULTIPLEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#multipleItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SENDADVICE
-PROPERTY_SENDADVICE =  sslog_new_property("http://oss.fruct.org/smartcare#sendAdvice", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASRESPONSEITEM
-PROPERTY_HASRESPONSEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#hasResponseItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RIGHTBIPOLAR
-PROPERTY_RIGHTBIPOLAR =  sslog_new_property("http://oss.fruct.org/smartcare#rightBipolar", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASDOCUMENT
-PROPERTY_HASDOCUMENT =  sslog_new_property("http://oss.fruct.org/smartcare#hasDocument", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ISPATIENTMEDICINEADDICTED
-PROPERTY_ISPATIENTMEDICINEADDICTED =  sslog_new_property("http://oss.fruct.org/smartcare#isPatientMedicineAddicted", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SERVEYDATE
-PROPERTY_SERVEYDATE =  sslog_new_property("http://oss.fruct.org/smartcare#serveyDate", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_AGE
-PROPERTY_AGE =  sslog_new_property("http://oss.fruct.org/smartcare#age", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ALARMSTATUS
-PROPERTY_ALARMSTATUS =  sslog_new_property("http://oss.fruct.org/smartcare#alarmStatus", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_DRUGANNOTATION
-PROPERTY_DRUGANNOTATION =  sslog_new_property("http://oss.fruct.org/smartcare#drugAnnotation", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PATIENTBLOODTYPE
-PROPERTY_PATIENTBLOODTYPE =  sslog_new_property("http://oss.fruct.org/smartcare#patientBloodType", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ITEMSCORE
-PROPERTY_ITEMSCORE =  sslog_new_property("http://oss.fruct.org/smartcare#itemScore", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PHARMNAME
-PROPERTY_PHARMNAME =  sslog_new_property("http://oss.fruct.org/smartcare#pharmName", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASFEEDBACK
-PROPERTY_HASFEEDBACK =  sslog_new_property("http://oss.fruct.org/smartcare#hasFeedback", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASPERSLOCATION
-PROPERTY_HASPERSLOCATION =  sslog_new_property("http://oss.fruct.org/smartcare#hasPersLocation", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_PATIENTRHFACTOR
-PROPERTY_PATIENTRHFACTOR =  sslog_new_property("http://oss.fruct.org/smartcare#patientRhFactor", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SURVEYECGINFO
-PROPERTY_SURVEYECGINFO =  sslog_new_property("http://oss.fruct.org/smartcare#surveyEcgInfo", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CONTAINUSHSURVEYS
-PROPERTY_CONTAINUSHSURVEYS =  sslog_new_property("http://oss.fruct.org/smartcare#containUSHSurveys", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SINGLEITEM
-PROPERTY_SINGLEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#singleItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASAMBLOCATION
-PROPERTY_HASAMBLOCATION =  sslog_new_property("http://oss.fruct.org/smartcare#hasAmbLocation", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DISEASEDESCRIPTION
-PROPERTY_DISEASEDESCRIPTION =  sslog_new_property("http://oss.fruct.org/smartcare#diseaseDescription", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASDRUGTOSALE
-PROPERTY_HASDRUGTOSALE =  sslog_new_property("http://oss.fruct.org/smartcare#hasDrugToSale", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSTEXT
-PROPERTY_CONTAINSTEXT =  sslog_new_property("http://oss.fruct.org/smartcare#containsText", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SERVEYRESULT
-PROPERTY_SERVEYRESULT =  sslog_new_property("http://oss.fruct.org/smartcare#serveyResult", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PATIENTHEIGHT
-PROPERTY_PATIENTHEIGHT =  sslog_new_property("http://oss.fruct.org/smartcare#patientHeight", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_WORKHOSPITAL
-PROPERTY_WORKHOSPITAL =  sslog_new_property("http://oss.fruct.org/smartcare#workHospital", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ALARMTIME
-PROPERTY_ALARMTIME =  sslog_new_property("http://oss.fruct.org/smartcare#alarmTime", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASHOSPLOCATION
-PROPERTY_HASHOSPLOCATION =  sslog_new_property("http://oss.fruct.org/smartcare#hasHospLocation", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_PHONE
-PROPERTY_PHONE =  sslog_new_property("http://oss.fruct.org/smartcare#phone", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SUBANSWER
-PROPERTY_SUBANSWER =  sslog_new_property("http://oss.fruct.org/smartcare#subAnswer", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RANGINGITEM
-PROPERTY_RANGINGITEM =  sslog_new_property("http://oss.fruct.org/smartcare#rangingItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CODE
-PROPERTY_CODE =  sslog_new_property("http://oss.fruct.org/smartcare#code", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_RESPONDEDTO
-PROPERTY_RESPONDEDTO =  sslog_new_property("http://oss.fruct.org/smartcare#respondedTo", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DESCRIPTION
-PROPERTY_DESCRIPTION =  sslog_new_property("http://oss.fruct.org/smartcare#description", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASANSWER
-PROPERTY_HASANSWER =  sslog_new_property("http://oss.fruct.org/smartcare#hasAnswer", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASPHARMLOCATION
-PROPERTY_HASPHARMLOCATION =  sslog_new_property("http://oss.fruct.org/smartcare#hasPharmLocation", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SERVEYDATALINK
-PROPERTY_SERVEYDATALINK =  sslog_new_property("http://oss.fruct.org/smartcare#serveyDataLink", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ISPATIENTSMOKE
-PROPERTY_ISPATIENTSMOKE =  sslog_new_property("http://oss.fruct.org/smartcare#isPatientSmoke", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASPATIENTMETRICS
-PROPERTY_HASPATIENTMETRICS =  sslog_new_property("http://oss.fruct.org/smartcare#hasPatientMetrics", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DOSAGE
-PROPERTY_DOSAGE =  sslog_new_property("http://oss.fruct.org/smartcare#dosage", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_LINKEDWITHITEM
-PROPERTY_LINKEDWITHITEM =  sslog_new_property("http://oss.fruct.org/smartcare#linkedWithItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SERVEYTYPE
-PROPERTY_SERVEYTYPE =  sslog_new_property("http://oss.fruct.org/smartcare#serveyType", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_DOCUMENTNUMBERFULL
-PROPERTY_DOCUMENTNUMBERFULL =  sslog_new_property("http://oss.fruct.org/smartcare#documentNumberFull", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_LONG
-PROPERTY_LONG =  sslog_new_property("http://oss.fruct.org/smartcare#long", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_FIRSTQUESTION
-PROPERTY_FIRSTQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#firstQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ANWEREDTO
-PROPERTY_ANWEREDTO =  sslog_new_property("http://oss.fruct.org/smartcare#anweredTo", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ISPATIENTALCOHOLADDICTED
-PROPERTY_ISPATIENTALCOHOLADDICTED =  sslog_new_property("http://oss.fruct.org/smartcare#isPatientAlcoholAddicted", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SERVEYDESCRIPTION
-PROPERTY_SERVEYDESCRIPTION =  sslog_new_property("http://oss.fruct.org/smartcare#serveyDescription", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_DOCUMENTTYPE
-PROPERTY_DOCUMENTTYPE =  sslog_new_property("http://oss.fruct.org/smartcare#documentType", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_LAT
-PROPERTY_LAT =  sslog_new_property("http://oss.fruct.org/smartcare#lat", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SURNAME
-PROPERTY_SURNAME =  sslog_new_property("http://oss.fruct.org/smartcare#surname", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASRESPONSE
-PROPERTY_HASRESPONSE =  sslog_new_property("http://oss.fruct.org/smartcare#hasResponse", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DOCUMENTRELEASEDATE
-PROPERTY_DOCUMENTRELEASEDATE =  sslog_new_property("http://oss.fruct.org/smartcare#documentReleaseDate", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PERSONINFORMATION
-PROPERTY_PERSONINFORMATION =  sslog_new_property("http://oss.fruct.org/smartcare#personInformation", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_AUTHREQUESTSTATUS
-PROPERTY_AUTHREQUESTSTATUS =  sslog_new_property("http://oss.fruct.org/smartcare#authRequestStatus", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_RESPONSETEXT
-PROPERTY_RESPONSETEXT =  sslog_new_property("http://oss.fruct.org/smartcare#responseText", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_PASSWORD
-PROPERTY_PASSWORD =  sslog_new_property("http://oss.fruct.org/smartcare#password", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_MBOX
-PROPERTY_MBOX =  sslog_new_property("http://oss.fruct.org/smartcare#mbox", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_HASPORTABLEEQUIPMENT
-PROPERTY_HASPORTABLEEQUIPMENT =  sslog_new_property("http://oss.fruct.org/smartcare#hasPortableEquipment", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_NEXTQUESTION
-PROPERTY_NEXTQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#nextQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_WORKAMBULANCE
-PROPERTY_WORKAMBULANCE =  sslog_new_property("http://oss.fruct.org/smartcare#workAmbulance", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_NAME
-PROPERTY_NAME =  sslog_new_property("http://oss.fruct.org/smartcare#name", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_ADVICETIME
-PROPERTY_ADVICETIME =  sslog_new_property("http://oss.fruct.org/smartcare#adviceTime", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_DISEASETYPE
-PROPERTY_DISEASETYPE =  sslog_new_property("http://oss.fruct.org/smartcare#diseaseType", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SERVEYUSHINFO
-PROPERTY_SERVEYUSHINFO =  sslog_new_property("http://oss.fruct.org/smartcare#serveyUshInfo", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CONTAINDISEASES
-PROPERTY_CONTAINDISEASES =  sslog_new_property("http://oss.fruct.org/smartcare#containDiseases", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-
-
-
-#if INCLUDE_CLASS_RANGINGSCALE
-CLASS_RANGINGSCALE = sslog_new_class("http://oss.fruct.org/smartcare#RangingScale");
-#endif
-#if INCLUDE_CLASS_QUESTIONNAIRE
-CLASS_QUESTIONNAIRE = sslog_new_class("http://oss.fruct.org/smartcare#Questionnaire");
-#endif
-#if INCLUDE_CLASS_THING
-CLASS_THING = sslog_new_class("http://www.w3.org/2002/07/owl#Thing");
-#endif
-#if INCLUDE_CLASS_ALARM
-CLASS_ALARM = sslog_new_class("http://oss.fruct.org/smartcare#Alarm");
-#endif
-#if INCLUDE_CLASS_RESPONSETEXT
-CLASS_RESPONSETEXT = sslog_new_class("http://oss.fruct.org/smartcare#ResponseText");
-#endif
-#if INCLUDE_CLASS_LOCATION
-CLASS_LOCATION = sslog_new_class("http://oss.fruct.org/smartcare#Location");
-#endif
-#if INCLUDE_CLASS_DICHOTOMOUS
-CLASS_DICHOTOMOUS = sslog_new_class("http://oss.fruct.org/smartcare#Dichotomous");
-#endif
-#if INCLUDE_CLASS_CHOISE
-CLASS_CHOISE = sslog_new_class("http://oss.fruct.org/smartcare#Choise");
-#endif
-#if INCLUDE_CLASS_PATIENTMETRICS
-CLASS_PATIENTMETRICS = sslog_new_class("http://oss.fruct.org/smartcare#PatientMetrics");
-#endif
-#if INCLUDE_CLASS_FEEDBACK
-CLASS_FEEDBACK = sslog_new_class("http://oss.fruct.org/smartcare#Feedback");
-#endif
-#if INCLUDE_CLASS_PHARMACY
-CLASS_PHARMACY = sslog_new_class("http://oss.fruct.org/smartcare#Pharmacy");
-#endif
-#if INCLUDE_CLASS_GUTTMANSCALE
-CLASS_GUTTMANSCALE = sslog_new_class("http://oss.fruct.org/smartcare#GuttmanScale");
-#endif
-#if INCLUDE_CLASS_RESPONSEFILE
-CLASS_RESPONSEFILE = sslog_new_class("http://oss.fruct.org/smartcare#ResponseFile");
-#endif
-#if INCLUDE_CLASS_RESPONSE
-CLASS_RESPONSE = sslog_new_class("http://oss.fruct.org/smartcare#Response");
-#endif
-#if INCLUDE_CLASS_DOCUMENT
-CLASS_DOCUMENT = sslog_new_class("http://oss.fruct.org/smartcare#Document");
-#endif
-#if INCLUDE_CLASS_BED
-CLASS_BED = sslog_new_class("http://oss.fruct.org/smartcare#Bed");
-#endif
-#if INCLUDE_CLASS_MEDIC
-CLASS_MEDIC = sslog_new_class("http://oss.fruct.org/smartcare#Medic");
-#endif
-#if INCLUDE_CLASS_USHSERVEY
-CLASS_USHSERVEY = sslog_new_class("http://oss.fruct.org/smartcare#USHServey");
-#endif
-#if INCLUDE_CLASS_CARING
-CLASS_CARING = sslog_new_class("http://oss.fruct.org/smartcare#Caring");
-#endif
-#if INCLUDE_CLASS_PHONE
-CLASS_PHONE = sslog_new_class("http://oss.fruct.org/smartcare#Phone");
-#endif
-#if INCLUDE_CLASS_AMBULANCE
-CLASS_AMBULANCE = sslog_new_class("http://oss.fruct.org/smartcare#Ambulance");
-#endif
-#if INCLUDE_CLASS_CLOSEDANSWER
-CLASS_CLOSEDANSWER = sslog_new_class("http://oss.fruct.org/smartcare#ClosedAnswer");
-#endif
-#if INCLUDE_CLASS_RESPONSEITEM
-CLASS_RESPONSEITEM = sslog_new_class("http://oss.fruct.org/smartcare#ResponseItem");
-#endif
-#if INCLUDE_CLASS_PATIENT
-CLASS_PATIENT = sslog_new_class("http://oss.fruct.org/smartcare#Patient");
-#endif
-#if INCLUDE_CLASS_PERSON
-CLASS_PERSON = sslog_new_class("http://oss.fruct.org/smartcare#Person");
-#endif
-#if INCLUDE_CLASS_AUTHREQUEST
-CLASS_AUTHREQUEST = sslog_new_class("http://oss.fruct.org/smartcare#AuthRequest");
-#endif
-#if INCLUDE_CLASS_PHOTO
-CLASS_PHOTO = sslog_new_class("http://oss.fruct.org/smartcare#Photo");
-#endif
-#if INCLUDE_CLASS_DOCTOR
-CLASS_DOCTOR = sslog_new_class("http://oss.fruct.org/smartcare#Doctor");
-#endif
-#if INCLUDE_CLASS_NURSE
-CLASS_NURSE = sslog_new_class("http://oss.fruct.org/smartcare#Nurse");
-#endif
-#if INCLUDE_CLASS_LIKERTSCALE
-CLASS_LIKERTSCALE = sslog_new_class("http://oss.fruct.org/smartcare#LikertScale");
-#endif
-#if INCLUDE_CLASS_AUDIO
-CLASS_AUDIO = sslog_new_class("http://oss.fruct.org/smartcare#Audio");
-#endif
-#if INCLUDE_CLASS_CONTINUOUSSCALE
-CLASS_CONTINUOUSSCALE = sslog_new_class("http://oss.fruct.org/smartcare#ContinuousScale");
-#endif
-#if INCLUDE_CLASS_FILE
-CLASS_FILE = sslog_new_class("http://oss.fruct.org/smartcare#File");
-#endif
-#if INCLUDE_CLASS_ADVICE
-CLASS_ADVICE = sslog_new_class("http://oss.fruct.org/smartcare#Advice");
-#endif
-#if INCLUDE_CLASS_TEXT
-CLASS_TEXT = sslog_new_class("http://oss.fruct.org/smartcare#Text");
-#endif
-#if INCLUDE_CLASS_MEDICALRECORDSCARD
-CLASS_MEDICALRECORDSCARD = sslog_new_class("http://oss.fruct.org/smartcare#MedicalRecordsCard");
-#endif
-#if INCLUDE_CLASS_ANSWER
-CLASS_ANSWER = sslog_new_class("http://oss.fruct.org/smartcare#Answer");
-#endif
-#if INCLUDE_CLASS_NOTHING
-CLASS_NOTHING = sslog_new_class("http://www.w3.org/2002/07/owl#Nothing");
-#endif
-#if INCLUDE_CLASS_MULTIPLECHOISE
-CLASS_MULTIPLECHOISE = sslog_new_class("http://oss.fruct.org/smartcare#MultipleChoise");
-#endif
-#if INCLUDE_CLASS_ITEM
-CLASS_ITEM = sslog_new_class("http://oss.fruct.org/smartcare#Item");
-#endif
-#if INCLUDE_CLASS_HOSPITAL
-CLASS_HOSPITAL = sslog_new_class("http://oss.fruct.org/smartcare#Hospital");
-#endif
-#if INCLUDE_CLASS_SERVEY
-CLASS_SERVEY = sslog_new_class("http://oss.fruct.org/smartcare#Servey");
-#endif
-#if INCLUDE_CLASS_PROFILE
-CLASS_PROFILE = sslog_new_class("http://oss.fruct.org/smartcare#Profile");
-#endif
-#if INCLUDE_CLASS_NUMBER
-CLASS_NUMBER = sslog_new_class("http://oss.fruct.org/smartcare#Number");
-#endif
-#if INCLUDE_CLASS_VIDEO
-CLASS_VIDEO = sslog_new_class("http://oss.fruct.org/smartcare#Video");
-#endif
-#if INCLUDE_CLASS_DISEASE
-CLASS_DISEASE = sslog_new_class("http://oss.fruct.org/smartcare#Disease");
-#endif
-#if INCLUDE_CLASS_ECGSERVEY
-CLASS_ECGSERVEY = sslog_new_class("http://oss.fruct.org/smartcare#ECGServey");
-#endif
-#if INCLUDE_CLASS_OPENANSWER
-CLASS_OPENANSWER = sslog_new_class("http://oss.fruct.org/smartcare#OpenAnswer");
-#endif
-#if INCLUDE_CLASS_PATIENTMAP
-CLASS_PATIENTMAP = sslog_new_class("http://oss.fruct.org/smartcare#PatientMap");
-#endif
-#if INCLUDE_CLASS_QUESTION
-CLASS_QUESTION = sslog_new_class("http://oss.fruct.org/smartcare#Question");
-#endif
-#if INCLUDE_CLASS_EQUIPMENT
-CLASS_EQUIPMENT = sslog_new_class("http://oss.fruct.org/smartcare#Equipment");
-#endif
-#if INCLUDE_CLASS_DRUG
-CLASS_DRUG = sslog_new_class("http://oss.fruct.org/smartcare#Drug");
-#endif
-#if INCLUDE_CLASS_SINGLECHOISE
-CLASS_SINGLECHOISE = sslog_new_class("http://oss.fruct.org/smartcare#SingleChoise");
-#endif
-#if INCLUDE_CLASS_VALIDATED
-CLASS_VALIDATED = sslog_new_class("http://oss.fruct.org/smartcare#Validated");
-#endif
-#if INCLUDE_CLASS_EMAIL
-CLASS_EMAIL = sslog_new_class("http://oss.fruct.org/smartcare#Email");
-#endif
-#if INCLUDE_CLASS_BIPOLARQUESTION
-CLASS_BIPOLARQUESTION = sslog_new_class("http://oss.fruct.org/smartcare#BipolarQuestion");
-#endif
-
-
-
+{
+    sslog_session_register_ontology(NULL, &SMARTCARE_ONTOLOGY);
 }
 
 
+
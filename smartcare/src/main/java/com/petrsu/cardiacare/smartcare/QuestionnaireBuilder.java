@@ -0,0 +1,67 @@
+package com.petrsu.cardiacare.smartcare;
+
+import java.util.LinkedList;
+
+/**
+ * Builds the questionnaire from QuestionnaireData in one pass.
+ * Data can be added by parts: questions without parent records
+ * are added to the last built questionnaire.
+ */
+public class QuestionnaireBuilder {
+    private Questionnaire questionnaire;
+    private LinkedList<Questionnaire> questionnaires = new LinkedList<Questionnaire>();
+
+    // Добавление записей, возвращает построенные вопросы
+    public LinkedList<Question> add(QuestionnaireData data) {
+        LinkedList<Question> questions = new LinkedList<Question>();
+        Object[] objects = new Object[data.getCount()];
+
+        for (int i = 0; i < objects.length; i++) {
+            int parent = data.getParent(i);
+
+            switch (data.getKind(i)) {
+                case QuestionnaireData.QUESTIONNAIRE:
+                    questionnaire = new Questionnaire(data.getString(i, 0));
+                    objects[i] = questionnaire;
+                    questionnaires.addLast(questionnaire);
+                    break;
+
+                case QuestionnaireData.QUESTION:
+                    Question question = new Question(data.getString(i, 0), data.getString(i, 1));
+                    objects[i] = question;
+                    if (questionnaire != null) {
+                        questionnaire.addQuestion(question);
+                    }
+                    questions.addLast(question);
+                    break;
+
+                // Copies of answers and items share lists, so children can be added later
+                case QuestionnaireData.ANSWER:
+                    Answer answer = new Answer(data.getString(i, 0), data.getString(i, 1));
+                    objects[i] = answer;
+                    if (objects[parent] instanceof Question) {
+                        ((Question) objects[parent]).setAnswer(answer);
+                    } else {
+                        ((AnswerItem) objects[parent]).addSubAnswer(answer);
+                    }
+                    break;
+
+                case QuestionnaireData.ITEM:
+                    AnswerItem item = new AnswerItem(data.getString(i, 0), data.getString(i, 1), data.getString(i, 2));
+                    objects[i] = item;
+                    ((Answer) objects[parent]).addAnswerItem(item);
+                    break;
+            }
+        }
+        return questions;
+    }
+
+    public Questionnaire getQuestionnaire() {
+        return questionnaire;
+    }
+
+    // Все построенные опросники в порядке записей
+    public LinkedList<Questionnaire> getQuestionnaires() {
+        return questionnaires;
+    }
+}
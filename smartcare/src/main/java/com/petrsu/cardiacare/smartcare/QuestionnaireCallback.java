@@ -0,0 +1,21 @@
+package com.petrsu.cardiacare.smartcare;
+
+/**
+ * Receives results of the asynchronous loading of the questionnaire
+ * (see SmartCareLibrary.connectSmartSpaceAsync and getQuestionnaireAsync).
+ * Methods are called on the native worker thread, not on the UI thread.
+ */
+public interface QuestionnaireCallback {
+    // Узел подключен к ИП (только при connectSmartSpaceAsync)
+    void onConnected(long nodeDescriptor);
+
+    // Очередной вопрос загружен, вопросы передаются по порядку
+    void onQuestion(Question question);
+
+    // Вопросник загружен полностью
+    void onQuestionnaire(Questionnaire questionnaire);
+
+    void onError(String message);
+
+    void onCancelled();
+}
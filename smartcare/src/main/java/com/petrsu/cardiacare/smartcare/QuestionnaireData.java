@@ -0,0 +1,52 @@
+package com.petrsu.cardiacare.smartcare;
+
+import java.nio.charset.Charset;
+
+/**
+ * Flat representation of the questionnaire that is filled by the native code
+ * (see jni/src/marshal.h) and passed to Java with one call.
+ * Records are stored in the order of the tree, parent records are before their children.
+ */
+public class QuestionnaireData {
+    static final int QUESTIONNAIRE = 0;
+    static final int QUESTION = 1;
+    static final int ANSWER = 2;
+    static final int ITEM = 3;
+
+    // kind, parent and three strings as pairs (offset, length)
+    static final int RECORD_SIZE = 8;
+
+    private static final Charset UTF8 = Charset.forName("UTF-8");
+
+    private final byte[] strings;
+    private final int[] records;
+
+    public QuestionnaireData(byte[] strings, int[] records) {
+        this.strings = strings;
+        this.records = records;
+    }
+
+    // Количество записей
+    public int getCount() {
+        return records.length / RECORD_SIZE;
+    }
+
+    public int getKind(int record) {
+        return records[record * RECORD_SIZE];
+    }
+
+    // Индекс родительской записи, -1 - вопросник или вопрос текущего вопросника
+    public int getParent(int record) {
+        return records[record * RECORD_SIZE + 1];
+    }
+
+    public String getString(int record, int index) {
+        int position = record * RECORD_SIZE + 2 + index * 2;
+        int offset = records[position];
+
+        if (offset < 0) {
+            return null;
+        }
+        return new String(strings, offset, records[position + 1], UTF8);
+    }
+}
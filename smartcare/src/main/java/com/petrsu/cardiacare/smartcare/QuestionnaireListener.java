@@ -0,0 +1,21 @@
+package com.petrsu.cardiacare.smartcare;
+
+/**
+ * Receives changes of the subscribed questionnaire
+ * (see SmartCareLibrary.subscribeQuestionnaire).
+ * Methods are called on the native subscription thread, not on the UI thread,
+ * unsubscribeQuestionnaire must not be called from them.
+ */
+public interface QuestionnaireListener {
+    // Вопрос добавлен в вопросник
+    void onQuestionAdded(String questionUri);
+
+    // Вопрос удален из вопросника
+    void onQuestionRemoved(String questionUri);
+
+    // Изменен текст вопроса
+    void onQuestionTextChanged(String questionUri, String text);
+
+    // Изменен ответ, вариант ответа или подответ
+    void onItemChanged(String uri);
+}
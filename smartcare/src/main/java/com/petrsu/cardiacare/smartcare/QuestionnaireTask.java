@@ -0,0 +1,36 @@
+package com.petrsu.cardiacare.smartcare;
+
+/**
+ * Receives data of the asynchronous loading from the native worker thread,
+ * builds Java objects and passes them to the QuestionnaireCallback.
+ */
+class QuestionnaireTask {
+    private final QuestionnaireCallback callback;
+    private final QuestionnaireBuilder builder = new QuestionnaireBuilder();
+
+    QuestionnaireTask(QuestionnaireCallback callback) {
+        this.callback = callback;
+    }
+
+    void onConnected(long nodeDescriptor) {
+        callback.onConnected(nodeDescriptor);
+    }
+
+    void onData(QuestionnaireData data) {
+        for (Question question : builder.add(data)) {
+            callback.onQuestion(question);
+        }
+    }
+
+    void onFinished() {
+        callback.onQuestionnaire(builder.getQuestionnaire());
+    }
+
+    void onError(String message) {
+        callback.onError(message);
+    }
+
+    void onCancelled() {
+        callback.onCancelled();
+    }
+}
@@ -1,5 +1,7 @@
 package com.petrsu.cardiacare.smartcare;
 
+import java.util.LinkedList;
+
 /**
  * Created by Iuliia Zavialova on 13.05.16.
  */
@@ -8,10 +10,82 @@ public class SmartCareLibrary {
     static {
         System.loadLibrary("smartcare_native");
     }
+    // Node descriptor is a handle (-1 on error), several nodes can be connected at the same time.
+    // Handle is not valid after disconnectSmartSpace, running tasks and subscriptions
+    // keep the node until they are finished or unsubscribed.
     public native long connectSmartSpace(String name, String ip, int port);
 
     public native void disconnectSmartSpace(long nodeDescriptor);
 
-    public native Questionnaire getQuestionnaire(long nodeDescriptor);
+    // Questionnaire is passed from the native code with one call and built here
+    public Questionnaire getQuestionnaire(long nodeDescriptor) {
+        QuestionnaireData data = getQuestionnaireData(nodeDescriptor);
+        if (data == null) {
+            return null;
+        }
+        QuestionnaireBuilder builder = new QuestionnaireBuilder();
+        builder.add(data);
+        return builder.getQuestionnaire();
+    }
+
+    // Several questionnaires are fetched at the same time with additional connections
+    // (limit <= 0 - all questionnaires of the smartspace), null on error.
+    public LinkedList<Questionnaire> getQuestionnaires(long nodeDescriptor, int limit) {
+        QuestionnaireData data = getQuestionnairesData(nodeDescriptor, limit);
+        if (data == null) {
+            return null;
+        }
+        QuestionnaireBuilder builder = new QuestionnaireBuilder();
+        builder.add(data);
+        return builder.getQuestionnaires();
+    }
+
+    // Binary snapshot of the questionnaire for the offline start: the last questionnaire
+    // got with the node (getQuestionnaire or getQuestionnaireAsync) is written without
+    // requests to the smart space and it is loaded with one mmap (null - no snapshot).
+    public native int saveQuestionnaireSnapshot(long nodeDescriptor, String path);
+
+    public Questionnaire loadQuestionnaireSnapshot(String path) {
+        QuestionnaireData data = loadQuestionnaireSnapshotData(path);
+        if (data == null) {
+            return null;
+        }
+        QuestionnaireBuilder builder = new QuestionnaireBuilder();
+        builder.add(data);
+        return builder.getQuestionnaire();
+    }
+
+    // Asynchronous versions return a task descriptor (-1 on error),
+    // cancelTask must be called for each task, also after its completion (next calls do nothing).
+    public long connectSmartSpaceAsync(String name, String ip, int port, QuestionnaireCallback callback) {
+        return startConnectTask(name, ip, port, new QuestionnaireTask(callback));
+    }
+
+    public long getQuestionnaireAsync(long nodeDescriptor, QuestionnaireCallback callback) {
+        return startQuestionnaireTask(nodeDescriptor, new QuestionnaireTask(callback));
+    }
+
+    public native void cancelTask(long taskDescriptor);
+
+    // Live updates of the questionnaire: returns a subscription descriptor (-1 on error),
+    // unsubscribeQuestionnaire must be called for each subscription (next calls do nothing).
+    public native long subscribeQuestionnaire(long nodeDescriptor, String questionnaireUri, QuestionnaireListener listener);
+
+    public native void unsubscribeQuestionnaire(long subscriptionDescriptor);
+
+    // Feedback is inserted with all responses in one transaction (a few for large feedbacks),
+    // empty URIs are generated. Returns results of responses in their order
+    // (0 - inserted, -1 - error) or null if the feedback is not inserted.
+    public native int[] sendFeedback(long nodeDescriptor, Feedback feedback);
+
+    private native QuestionnaireData getQuestionnaireData(long nodeDescriptor);
+
+    private native QuestionnaireData getQuestionnairesData(long nodeDescriptor, int limit);
+
+    private native QuestionnaireData loadQuestionnaireSnapshotData(String path);
+
+    private native long startConnectTask(String name, String ip, int port, QuestionnaireTask task);
+
+    private native long startQuestionnaireTask(long nodeDescriptor, QuestionnaireTask task);
 
 }
@@ -32,12 +32,23 @@ src/globals.c \
 src/globals.h \
 src/jni_utils.c \
 src/jni_utils.h \
+src/tasks.c \
+src/tasks.h \
+src/marshal.c \
+src/marshal.h \
+src/answer_types.c \
+src/answer_types.h \
+src/feedback.c \
+src/feedback.h \
+src/handles.c \
+src/handles.h \
 ontology/smartcare.c \
 SmartSlog/triple.c \
 SmartSlog/session.c \
 SmartSlog/subscription_changes.c \
 SmartSlog/high_api.c \
 SmartSlog/entity.c \
+SmartSlog/ontology.c \
 SmartSlog/scew/error.c \
 SmartSlog/scew/str.c \
 SmartSlog/scew/writer.c \
@@ -60,6 +71,10 @@ SmartSlog/scew/parser.c \
 SmartSlog/scew/xerror.c \
 SmartSlog/scew/writer_buffer.c \
 SmartSlog/triplestore.c \
+SmartSlog/triplestore_filter.c \
+SmartSlog/triplestore_index.c \
+SmartSlog/triplestore_segment.c \
+SmartSlog/triplestore_select.c \
 SmartSlog/kpi_interface.c \
 SmartSlog/ckpi/sskp_errno.c \
 SmartSlog/ckpi/process_ssap_cnf.c \
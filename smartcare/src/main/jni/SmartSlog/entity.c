@@ -38,6 +38,8 @@
 
 #include "kpi_api.h"
 #include "triple_internal.h"
+#include "session_internal.h"
+#include "triplestore_internal.h"
 
 #include "utils/errors_internal.h"
 #include "utils/util_func.h"
@@ -56,6 +58,13 @@ sslog_class_t *sslog_new_class(const char *uri)
         return NULL;
     }
 
+    // Classes of the generated ontology are static.
+    sslog_class_t *static_class = sslog_entity_as_class(sslog_ontology_find(sslog_session_get_default()->store->ontology, uri));
+
+    if (static_class != NULL && static_class->entity.type == SSLOG_ENTITY_CLASS) {
+        return static_class;
+    }
+
     sslog_triple_t *triple = sslog_new_triple(uri, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_RDFS_CLASS,
                                               SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
 
@@ -93,6 +102,13 @@ sslog_property_t *sslog_new_property(const char *uri, sslog_property_type type)
         return NULL;
     }
 
+    // Properties of the generated ontology are static.
+    sslog_property_t *static_property = sslog_entity_as_property(sslog_ontology_find(sslog_session_get_default()->store->ontology, uri));
+
+    if (static_property != NULL && static_property->entity.type == SSLOG_ENTITY_PROPERTY) {
+        return static_property;
+    }
+
     // Create or get rdf:type triple for property and return linked entity, then it exists,
     // otherwise crete a new property and link it with individual.
     sslog_triple_t *triple = sslog_new_triple(uri, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_RDF_PROPERTY,
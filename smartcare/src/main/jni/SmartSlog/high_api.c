@@ -39,6 +39,7 @@
 #include "high_api_internal.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "session_internal.h"
 #include "triplestore.h"
@@ -65,6 +66,19 @@ static inline char *sslog_object_get_uri(void *object);
 static inline char *sslog_object_get_individual_uri(void *object);
 static inline void sslog_prepare_prop_value(sslog_property_t *property, void *value, char **prepared_value, sslog_rdf_type *type);
 static inline void sslog_prepare_prop_value_with_any(sslog_property_t *property, void *value, char **prepared_value, sslog_rdf_type *type);
+static list_t *sslog_query_property_triples(sslog_individual_t *individual, sslog_property_t *property, int max_triples_count);
+static bool sslog_populate_evicted(sslog_store_t *store, sslog_individual_t *individual);
+static void sslog_node_reset_evicted(sslog_node_t *node, list_t *individuals);
+static list_t *sslog_node_new_linked_templates(sslog_node_t *node, list_t *triples);
+static list_t *sslog_node_new_prefetch_templates(sslog_node_t *node, list_t *triples, list_t *properties,
+                                                 bool is_last_level, char ***visited, int *visited_count);
+static bool sslog_node_is_prefetch_property(list_t *properties, const char *predicate);
+static int sslog_compare_uris(const void *a, const void *b);
+static int sslog_compare_triples_subjects(const void *a, const void *b);
+static uint64_t sslog_node_sync_hash(const sslog_triple_t *triple);
+static uint64_t sslog_node_sync_stored_hash(sslog_node_t *node, const char *subject, list_t *properties);
+static bool sslog_node_sync_is_versioned(sslog_triple_t **triples, int triples_count, const char *version);
+static int sslog_node_sync_patch(sslog_node_t *node, const char *subject, list_t *triples);
 
 
 /****************************** Implementations ******************************/
@@ -252,7 +266,14 @@ sslog_triple_t * sslog_class_to_triple(sslog_class_t *ont_class)
         return NULL;
     }
 
-    return sslog_class_as_entity(ont_class)->linked_triple;
+    sslog_triple_t *triple = sslog_class_as_entity(ont_class)->linked_triple;
+
+    // Classes of the generated ontology are not linked, their triples are in the store segment.
+    if (triple == NULL) {
+        triple = sslog_store_get_rdftype(sslog_session_get_default()->store, ont_class->entity.uri);
+    }
+
+    return triple;
 }
 
 
@@ -263,7 +284,13 @@ sslog_triple_t * sslog_property_to_triple(sslog_property_t *property)
         return NULL;
     }
 
-    return sslog_property_as_entity(property)->linked_triple;
+    sslog_triple_t *triple = sslog_property_as_entity(property)->linked_triple;
+
+    if (triple == NULL) {
+        triple = sslog_store_get_rdftype(sslog_session_get_default()->store, property->entity.uri);
+    }
+
+    return triple;
 }
 /*****************************************************************************/
 
@@ -283,10 +310,7 @@ const void *sslog_get_property(sslog_individual_t *individual, sslog_property_t
 
     sslog_error_reset(NULL);
 
-    list_t *query_triples = sslog_store_query_triples_by_data(
-                sslog_session_get_default()->store,
-                individual->entity.uri, property->entity.uri, SSLOG_TRIPLE_ANY,
-				SSLOG_RDF_TYPE_URI, (sslog_rdf_type)property->type, 1);
+    list_t *query_triples = sslog_query_property_triples(individual, property, 1);
 
     if (list_is_null_or_empty(query_triples) == true) {
         list_free(query_triples);
@@ -337,10 +361,7 @@ list_t *sslog_get_properties(sslog_individual_t *individual, sslog_property_t *p
         return NULL;
     }
 
-    list_t *query_triples = sslog_store_query_triples_by_data(
-                sslog_session_get_default()->store,
-                individual->entity.uri, property->entity.uri, SSLOG_TRIPLE_ANY,
-				SSLOG_RDF_TYPE_URI, (sslog_rdf_type) property->type, -1);
+    list_t *query_triples = sslog_query_property_triples(individual, property, -1);
 
     if (list_is_empty(query_triples) == 1) {
         SSLOG_DEBUG_FUNC("No values for property '%s'", sslog_entity_get_uri(property));
@@ -570,6 +591,28 @@ int sslog_remove_individual(sslog_individual_t *individual)
 
     return sslog_error_set(NULL, result, NULL);
 }
+
+
+int sslog_remove_individuals(list_t *individuals)
+{
+    if (individuals == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "individuals");
+    }
+
+    int result = sslog_store_remove_individuals(sslog_session_get_default()->store, individuals);
+
+    return sslog_error_set(NULL, result, NULL);
+}
+
+
+unsigned long sslog_individual_get_generation(sslog_individual_t *individual)
+{
+    if (individual == NULL) {
+        return 0;
+    }
+
+    return sslog_store_get_generation(sslog_session_get_default()->store, individual->entity.uri);
+}
 /*****************************************************************************/
 
 
@@ -908,7 +951,7 @@ list_t* sslog_node_get_individuals_by_class(sslog_node_t *node, sslog_class_t *o
         return list_new();
     }
 
-    result = sslog_insert_triples(result_triple);
+    sslog_store_add_triples(node->session->store, result_triple);
 
     //TODO: make more elegante: get individudals from triples.
     list_t *stored_triples = sslog_store_query_triples(node->session->store, result_triple);
@@ -944,52 +987,71 @@ int sslog_node_populate(sslog_node_t *node, sslog_individual_t *individual)
         return sslog_error_set(&node->last_error, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "individul");
     }
 
-    sslog_triple_t *query_triple = sslog_new_triple_detached(individual->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
-                                                             SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
+    list_t *individuals = list_new();
+    list_add_data(individuals, individual);
 
-    list_t *result_triples = NULL;
-    int result = sslog_kpi_query_triple(node->kpi, query_triple, &result_triples);
+    int result = sslog_node_populate_many(node, individuals);
 
-    sslog_free_triple(query_triple);
+    list_free_with_nodes(individuals, NULL);
 
-    if (result != SSLOG_ERROR_NO) {
-        return sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
+    return result;
+}
+
+
+int sslog_node_populate_many(sslog_node_t *node, list_t *individuals)
+{
+    if (node == NULL) {
+         return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "node");
     }
 
-    if (list_is_null_or_empty(result_triples) == 1) {
-        SSLOG_DEBUG_FUNC("No triples in smart space for individual (%s).", individual->entity.uri)
-        list_free_with_nodes(result_triples, NULL);
-        return sslog_error_reset(&node->last_error);
+    if (individuals == NULL) {
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "individuals");
     }
 
-    list_t *linked_triples = list_new();
+    // One query with templates for all individuals.
+    list_t *query_triples = list_new();
 
     list_head_t *list_walker = NULL;
-    list_for_each (list_walker, &result_triples->links) {
+    list_for_each (list_walker, &individuals->links) {
         list_t *entry = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) entry->data;
+        sslog_individual_t *individual = (sslog_individual_t *) entry->data;
 
-        if (sslog_triple_is_property_value(triple) == false) {
-            SSLOG_DEBUG_FUNC("Triple is not property value: %s - %s - %s (%d)",
-                             triple->subject, triple->predicate, triple->object, triple->object_type);
+        if (individual == NULL) {
             continue;
         }
 
-        sslog_property_t *property = sslog_store_get_property(node->session->store, triple->predicate);
+        list_add_data(query_triples, sslog_new_triple_detached(individual->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                               SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+    }
 
-        if (property == NULL) {
-            continue;
-        }
+    if (list_is_empty(query_triples) == true) {
+        list_free_with_nodes(query_triples, NULL);
+        return sslog_error_reset(&node->last_error);
+    }
 
-        if (sslog_property_is_object(property) == true) {
-            query_triple = sslog_new_triple_detached(triple->object, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_ANY,
-                                                     SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
-            list_add_data(linked_triples, query_triple);
-        }
+    list_t *result_triples = NULL;
+    int result = sslog_kpi_query_triples(node->kpi, query_triples, &result_triples);
+
+    list_free_with_nodes(query_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+
+    if (result != SSLOG_ERROR_NO) {
+        return sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
     }
 
+    if (list_is_null_or_empty(result_triples) == 1) {
+        SSLOG_DEBUG_FUNC("No triples in smart space for individuals.");
+        list_free_with_nodes(result_triples, NULL);
+        sslog_node_reset_evicted(node, individuals);
+        return sslog_error_reset(&node->last_error);
+    }
+
+    // Second query with rdf:type templates for all new linked individuals.
+    list_t *linked_triples = sslog_node_new_linked_templates(node, result_triples);
     list_t *result_linked_triples = NULL;
-    result = sslog_kpi_query_triples(node->kpi, linked_triples, &result_linked_triples);
+
+    if (list_is_empty(linked_triples) == false) {
+        result = sslog_kpi_query_triples(node->kpi, linked_triples, &result_linked_triples);
+    }
 
     list_free_with_nodes(linked_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
 
@@ -1007,6 +1069,195 @@ int sslog_node_populate(sslog_node_t *node, sslog_individual_t *individual)
     list_free_with_nodes(result_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
     list_free_with_nodes(result_linked_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
 
+    sslog_node_reset_evicted(node, individuals);
+
+    return sslog_error_reset(&node->last_error);
+}
+
+
+int sslog_node_prefetch(sslog_node_t *node, sslog_individual_t *root, list_t *properties, int max_depth)
+{
+    if (node == NULL) {
+         return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "node");
+    }
+
+    if (root == NULL) {
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "root");
+    }
+
+    // URIs of fetched individuals (sorted copies), each individual is queried once.
+    int visited_count = 1;
+    char **visited = (char **) malloc(sizeof(char *));
+
+    if (visited == NULL || (visited[0] = strdup(root->entity.uri)) == NULL) {
+        free(visited);
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    list_t *query_triples = list_new();
+    list_add_data(query_triples, sslog_new_triple_detached(root->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                           SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+
+    int result = SSLOG_ERROR_NO;
+
+    // One query per level: templates of the level are made from the triples of the previous one.
+    for (int depth = 1; query_triples != NULL && list_is_empty(query_triples) == false; ++depth) {
+        list_t *result_triples = NULL;
+        result = sslog_kpi_query_triples(node->kpi, query_triples, &result_triples);
+
+        list_free_with_nodes(query_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+        query_triples = NULL;
+
+        if (result != SSLOG_ERROR_NO) {
+            result = sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
+            break;
+        }
+
+        if (list_is_null_or_empty(result_triples) == 1) {
+            list_free_with_nodes(result_triples, NULL);
+            break;
+        }
+
+        sslog_store_add_triples(node->session->store, result_triples);
+
+        query_triples = sslog_node_new_prefetch_templates(node, result_triples, properties,
+                                                          (max_depth >= 0 && depth > max_depth),
+                                                          &visited, &visited_count);
+
+        list_free_with_nodes(result_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+
+        if (query_triples == NULL) {
+            result = sslog_error_set(&node->last_error, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        }
+    }
+
+    for (int i = 0; i < visited_count; ++i) {
+        free(visited[i]);
+    }
+
+    free(visited);
+
+    if (result != SSLOG_ERROR_NO) {
+        return result;
+    }
+
+    return sslog_error_reset(&node->last_error);
+}
+
+
+int sslog_node_sync(sslog_node_t *node, const char *query, list_t *properties, sslog_property_t *version,
+                    int *changed_count)
+{
+    if (node == NULL) {
+         return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "node");
+    }
+
+    if (sslog_is_str_null_empty(query) == true || properties == NULL) {
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_INCORRECT_ARGUMENT,
+                               SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "query or properties");
+    }
+
+    if (changed_count != NULL) {
+        *changed_count = 0;
+    }
+
+    list_t *fingerprint_triples = NULL;
+    int result = sslog_kpi_sparql_construct(node->kpi, query, &fingerprint_triples);
+
+    if (result != SSLOG_ERROR_NO) {
+        return sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
+    }
+
+    int triples_count = (fingerprint_triples == NULL) ? 0 : list_count(fingerprint_triples);
+    sslog_triple_t **triples = (sslog_triple_t **) malloc((triples_count + 1) * sizeof(sslog_triple_t *));
+
+    if (triples == NULL) {
+        sslog_free_triples(fingerprint_triples);
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    // Triples are grouped by subjects.
+    int index = 0;
+    list_head_t *list_walker = NULL;
+
+    if (fingerprint_triples != NULL) {
+        list_for_each (list_walker, &fingerprint_triples->links) {
+            list_t *entry = list_entry(list_walker, list_t, links);
+            triples[index++] = (sslog_triple_t *) entry->data;
+        }
+    }
+
+    qsort(triples, triples_count, sizeof(sslog_triple_t *), sslog_compare_triples_subjects);
+
+    // Changes of data properties are not seen without versions, the subgraph must be got again.
+    if (version != NULL && sslog_node_sync_is_versioned(triples, triples_count, sslog_entity_get_uri(version)) == false) {
+        free(triples);
+        sslog_free_triples(fingerprint_triples);
+        return sslog_error_set(&node->last_error, SSLOG_ERROR_NOT_FOUND, SSLOG_ERROR_TEXT_NOT_FOUND "versions of the subgraph");
+    }
+
+    list_t *changed_templates = list_new();
+
+    for (int first = 0; first < triples_count; ) {
+        uint64_t fingerprint = 0;
+        int last = first;
+
+        // Sum of hashes does not depend on the order of triples.
+        for (; last < triples_count && strcmp(triples[last]->subject, triples[first]->subject) == 0; ++last) {
+            fingerprint += sslog_node_sync_hash(triples[last]);
+        }
+
+        if (fingerprint != sslog_node_sync_stored_hash(node, triples[first]->subject, properties)) {
+            list_add_data(changed_templates, sslog_new_triple_detached(triples[first]->subject, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                                       SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+        }
+
+        first = last;
+    }
+
+    free(triples);
+    sslog_free_triples(fingerprint_triples);
+
+    int count = list_count(changed_templates);
+    list_t *changed_triples = NULL;
+
+    if (count > 0) {
+        result = sslog_kpi_query_triples(node->kpi, changed_templates, &changed_triples);
+    }
+
+    if (result != SSLOG_ERROR_NO) {
+        list_free_with_nodes(changed_templates, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+        return sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
+    }
+
+    list_for_each (list_walker, &changed_templates->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple_template = (sslog_triple_t *) entry->data;
+
+        result = sslog_node_sync_patch(node, triple_template->subject, changed_triples);
+
+        if (result != SSLOG_ERROR_NO) {
+            break;
+        }
+    }
+
+    list_free_with_nodes(changed_templates, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+
+    if (changed_triples != NULL) {
+        sslog_store_add_triples(node->session->store, changed_triples);
+        list_free_with_nodes(changed_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+    }
+
+    // Local store is patched without the KPI, its errors are not described by sslog_kpi_get_error_text.
+    if (result != SSLOG_ERROR_NO) {
+        return sslog_error_set(&node->last_error, result, (result == SSLOG_ERROR_OUT_OF_MEMORY)
+                               ? SSLOG_ERROR_TEXT_OUT_OF_MEMORY : SSLOG_ERROR_TEXT_UNKNOWN "local store is not patched");
+    }
+
+    if (changed_count != NULL) {
+        *changed_count = count;
+    }
+
     return sslog_error_reset(&node->last_error);
 }
 
@@ -1021,7 +1272,7 @@ int sslog_node_insert_individual(sslog_node_t *node, sslog_individual_t *individ
         return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "individul");
     }
 
-    list_t *triples = sslog_store_get_individual_triples(sslog_session_get_default()->store, individual, true);
+    list_t *triples = sslog_store_get_individual_triples(node->session->store, individual, true);
 
     if (triples == NULL) {
         SSLOG_DEBUG_FUNC("Error while getting individual triples.");
@@ -1074,7 +1325,7 @@ int sslog_node_remove_individual(sslog_node_t *node, sslog_individual_t *individ
 
         list_del_and_free_nodes_with_data(local_triples, rdftype, NULL);
 
-        sslog_remove_triples(local_triples);
+        sslog_store_remove_triples(node->session->store, local_triples);
         list_free_with_nodes(local_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
 
         sslog_error_reset(&node->last_error);
@@ -1110,7 +1361,7 @@ int sslog_node_remove_individual_with_local(sslog_node_t *node, sslog_individual
     int result = sslog_kpi_remove_triples(node->kpi, triple_templates);
 
     if (result == SSLOG_ERROR_NO) {
-        sslog_remove_triple(triple_template);
+        sslog_store_remove_triples(node->session->store, triple_templates);
         sslog_free_triples(triple_templates);
 
         return sslog_error_reset(&node->last_error);
@@ -1124,6 +1375,464 @@ int sslog_node_remove_individual_with_local(sslog_node_t *node, sslog_individual
 
 /****************************** Implementations ******************************/
 /****************************** Static functions *****************************/
+
+/**
+ * @brief Queries stored triples with values of the property of the individual.
+ * If there are no values and the individual was evicted from the local store,
+ * then it is got again with the default node of the thread (see sslog_node_set_default).
+ * @param individual. Individual.
+ * @param property. Property.
+ * @param max_triples_count. Maximum number of triples, -1 - all triples.
+ * @return list with stored triples or NULL.
+ */
+static list_t *sslog_query_property_triples(sslog_individual_t *individual, sslog_property_t *property, int max_triples_count)
+{
+    sslog_store_t *store = sslog_session_get_default()->store;
+
+    list_t *query_triples = sslog_store_query_triples_by_data(store,
+                individual->entity.uri, property->entity.uri, SSLOG_TRIPLE_ANY,
+                SSLOG_RDF_TYPE_URI, (sslog_rdf_type) property->type, max_triples_count);
+
+    if (list_is_null_or_empty(query_triples) == false
+            || sslog_populate_evicted(store, individual) == false) {
+        return query_triples;
+    }
+
+    list_free_with_nodes(query_triples, NULL);
+
+    return sslog_store_query_triples_by_data(store,
+                individual->entity.uri, property->entity.uri, SSLOG_TRIPLE_ANY,
+                SSLOG_RDF_TYPE_URI, (sslog_rdf_type) property->type, max_triples_count);
+}
+
+
+/**
+ * @brief Gets properties of the evicted individual again.
+ * Default node of the thread is used, it must work with the given store.
+ * @param store. Local store of the default session.
+ * @param individual. Individual.
+ * @return true if properties are got again, false if the individual is not evicted or on errors.
+ */
+static bool sslog_populate_evicted(sslog_store_t *store, sslog_individual_t *individual)
+{
+    sslog_node_t *node = sslog_node_get_default();
+
+    if (node == NULL || sslog_node_get_store(node) != store
+            || sslog_store_is_evicted(store, individual->entity.uri) == false) {
+        return false;
+    }
+
+    SSLOG_DEBUG_FUNC("Individual (%s) is evicted, it is got again.", individual->entity.uri);
+
+    return (sslog_node_populate(node, individual) == SSLOG_ERROR_NO);
+}
+
+
+/**
+ * @brief Removes marks of eviction of populated individuals.
+ * @param node. Node with the session.
+ * @param individuals. Populated individuals (NULL items are skipped).
+ */
+static void sslog_node_reset_evicted(sslog_node_t *node, list_t *individuals)
+{
+    list_head_t *list_walker = NULL;
+    list_for_each (list_walker, &individuals->links) {
+        sslog_individual_t *individual = (sslog_individual_t *) list_entry(list_walker, list_t, links)->data;
+
+        if (individual != NULL) {
+            sslog_store_reset_evicted(node->session->store, individual->entity.uri);
+        }
+    }
+}
+
+
+/**
+ * @brief Creates templates to get rdf:type triples of linked individuals.
+ * Templates are created for objects of object properties, each URI is used once
+ * and individuals with rdf:type in the local store are skipped.
+ * @param node. Node with the session.
+ * @param triples. Triples of individuals.
+ * @return list with templates (can be empty).
+ */
+static list_t *sslog_node_new_linked_templates(sslog_node_t *node, list_t *triples)
+{
+    list_t *linked_triples = list_new();
+    int uris_count = 0;
+    const char **uris = (const char **) malloc(list_count(triples) * sizeof(char *) + 1);
+
+    if (uris == NULL) {
+        return linked_triples;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each (list_walker, &triples->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple = (sslog_triple_t *) entry->data;
+
+        if (sslog_triple_is_property_value(triple) == false) {
+            SSLOG_DEBUG_FUNC("Triple is not property value: %s - %s - %s (%d)",
+                             triple->subject, triple->predicate, triple->object, triple->object_type);
+            continue;
+        }
+
+        sslog_property_t *property = sslog_store_get_property(node->session->store, triple->predicate);
+
+        if (property == NULL || sslog_property_is_object(property) == false) {
+            continue;
+        }
+
+        uris[uris_count++] = triple->object;
+    }
+
+    qsort(uris, uris_count, sizeof(char *), sslog_compare_uris);
+
+    for (int i = 0; i < uris_count; ++i) {
+        if (i > 0 && strcmp(uris[i], uris[i - 1]) == 0) {
+            continue;
+        }
+
+        if (sslog_store_get_rdftype(node->session->store, uris[i]) != NULL) {
+            continue;
+        }
+
+        list_add_data(linked_triples, sslog_new_triple_detached(uris[i], SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_ANY,
+                                                                SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+    }
+
+    free(uris);
+
+    return linked_triples;
+}
+
+
+/**
+ * @brief Creates templates for the next level of prefetching.
+ * Objects of followed properties get templates for all triples (if they are not visited),
+ * objects of other object properties get templates for rdf:type triples
+ * (if there is no rdf:type in the local store), so all values can be got as individuals.
+ * New visited URIs are added to the sorted array of visited URIs.
+ * @param node. Node with the session.
+ * @param triples. Triples of the current level.
+ * @param properties. Followed properties, NULL - all object properties.
+ * @param is_last_level. If true, then no property is followed.
+ * @param visited. Sorted array with visited URIs.
+ * @param visited_count. Number of visited URIs.
+ * @return list with templates (can be empty) on success or NULL otherwise.
+ */
+static list_t *sslog_node_new_prefetch_templates(sslog_node_t *node, list_t *triples, list_t *properties,
+                                                 bool is_last_level, char ***visited, int *visited_count)
+{
+    int followed_count = 0;
+    int linked_count = 0;
+    int triples_count = list_count(triples);
+    const char **followed = (const char **) malloc(triples_count * sizeof(char *) + 1);
+    const char **linked = (const char **) malloc(triples_count * sizeof(char *) + 1);
+
+    if (followed == NULL || linked == NULL) {
+        free(followed);
+        free(linked);
+        return NULL;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each (list_walker, &triples->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple = (sslog_triple_t *) entry->data;
+
+        if (sslog_triple_is_property_value(triple) == false) {
+            continue;
+        }
+
+        sslog_property_t *property = sslog_store_get_property(node->session->store, triple->predicate);
+
+        if (property == NULL || sslog_property_is_object(property) == false) {
+            continue;
+        }
+
+        if (is_last_level == false && sslog_node_is_prefetch_property(properties, triple->predicate) == true) {
+            followed[followed_count++] = triple->object;
+        } else {
+            linked[linked_count++] = triple->object;
+        }
+    }
+
+    qsort(followed, followed_count, sizeof(char *), sslog_compare_uris);
+    qsort(linked, linked_count, sizeof(char *), sslog_compare_uris);
+
+    list_t *templates = list_new();
+    int new_count = 0;
+
+    // Unique not visited URIs are moved to the begin of the array.
+    for (int i = 0; i < followed_count; ++i) {
+        if (i > 0 && strcmp(followed[i], followed[i - 1]) == 0) {
+            continue;
+        }
+
+        if (bsearch(&followed[i], *visited, *visited_count, sizeof(char *), sslog_compare_uris) != NULL) {
+            continue;
+        }
+
+        followed[new_count++] = followed[i];
+        list_add_data(templates, sslog_new_triple_detached(followed[i], SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                           SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+    }
+
+    for (int i = 0; i < linked_count; ++i) {
+        if (i > 0 && strcmp(linked[i], linked[i - 1]) == 0) {
+            continue;
+        }
+
+        if (bsearch(&linked[i], followed, new_count, sizeof(char *), sslog_compare_uris) != NULL
+                || bsearch(&linked[i], *visited, *visited_count, sizeof(char *), sslog_compare_uris) != NULL
+                || sslog_store_get_rdftype(node->session->store, linked[i]) != NULL) {
+            continue;
+        }
+
+        list_add_data(templates, sslog_new_triple_detached(linked[i], SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_ANY,
+                                                           SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI));
+    }
+
+    char **new_visited = (new_count == 0) ? *visited
+                         : (char **) realloc(*visited, (*visited_count + new_count) * sizeof(char *));
+
+    if (new_visited == NULL) {
+        list_free_with_nodes(templates, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+        free(followed);
+        free(linked);
+        return NULL;
+    }
+
+    *visited = new_visited;
+
+    for (int i = 0; i < new_count; ++i) {
+        char *uri = strdup(followed[i]);
+
+        if (uri == NULL) {
+            list_free_with_nodes(templates, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+            templates = NULL;
+            break;
+        }
+
+        new_visited[(*visited_count)++] = uri;
+    }
+
+    qsort(new_visited, *visited_count, sizeof(char *), sslog_compare_uris);
+
+    free(followed);
+    free(linked);
+
+    return templates;
+}
+
+
+/**
+ * @brief Checks that values of the property are prefetched.
+ * @param properties. Followed properties, NULL - all properties.
+ * @param predicate. URI of the property.
+ * @return true if the property is followed or false otherwise.
+ */
+static bool sslog_node_is_prefetch_property(list_t *properties, const char *predicate)
+{
+    if (properties == NULL) {
+        return true;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each (list_walker, &properties->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_property_t *property = (sslog_property_t *) entry->data;
+
+        if (property != NULL && strcmp(property->entity.uri, predicate) == 0) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static int sslog_compare_uris(const void *a, const void *b)
+{
+    return strcmp(*(const char **) a, *(const char **) b);
+}
+
+
+static int sslog_compare_triples_subjects(const void *a, const void *b)
+{
+    return strcmp((*(sslog_triple_t * const *) a)->subject, (*(sslog_triple_t * const *) b)->subject);
+}
+
+
+/**
+ * @brief Gets the hash of the triple for fingerprints (subject is not hashed).
+ * @param triple. Triple to hash.
+ * @return hash of the triple.
+ */
+static uint64_t sslog_node_sync_hash(const sslog_triple_t *triple)
+{
+    // FNV-1a (64 bits) of the predicate, the object and its type.
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const unsigned char *c = (const unsigned char *) triple->predicate; *c != '\0'; ++c) {
+        hash = (hash ^ *c) * 1099511628211ULL;
+    }
+
+    hash = (hash ^ 0xff) * 1099511628211ULL;
+
+    for (const unsigned char *c = (const unsigned char *) triple->object; *c != '\0'; ++c) {
+        hash = (hash ^ *c) * 1099511628211ULL;
+    }
+
+    hash = (hash ^ (unsigned char) triple->object_type) * 1099511628211ULL;
+
+    // Hashes are summed, so bits are mixed (finalizer of MurmurHash3).
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+
+/**
+ * @brief Gets the fingerprint of the stored subject.
+ * @param node. Node with the store.
+ * @param subject. URI of the subject.
+ * @param properties. Properties of the fingerprint.
+ * @return sum of hashes of the stored triples with the properties (0 - no triples).
+ */
+static uint64_t sslog_node_sync_stored_hash(sslog_node_t *node, const char *subject, list_t *properties)
+{
+    list_t *stored_triples = sslog_store_query_triples_by_data(node->session->store, subject, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                               SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI, -1);
+    uint64_t fingerprint = 0;
+
+    if (stored_triples == NULL) {
+        return fingerprint;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each (list_walker, &stored_triples->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple = (sslog_triple_t *) entry->data;
+
+        if (properties != NULL && sslog_node_is_prefetch_property(properties, triple->predicate) == true) {
+            fingerprint += sslog_node_sync_hash(triple);
+        }
+    }
+
+    list_free_with_nodes(stored_triples, NULL);
+
+    return fingerprint;
+}
+
+
+/**
+ * @brief Checks that each individual of the fingerprint has the version.
+ * Subjects and linked individuals are checked, individuals without links
+ * and versions are absent in the fingerprint, so they are found by links.
+ * @param triples. Triples of the fingerprint sorted by subjects.
+ * @param triples_count. Number of triples.
+ * @param version. URI of the version property.
+ * @return true if all individuals have versions, false otherwise (also for the empty fingerprint).
+ */
+static bool sslog_node_sync_is_versioned(sslog_triple_t **triples, int triples_count, const char *version)
+{
+    if (triples_count == 0) {
+        return false;
+    }
+
+    // Subjects are sorted, so versioned subjects are sorted too.
+    const char **versioned = (const char **) malloc(triples_count * sizeof(char *));
+    int versioned_count = 0;
+
+    if (versioned == NULL) {
+        return false;
+    }
+
+    for (int i = 0; i < triples_count; ++i) {
+        if (strcmp(triples[i]->predicate, version) == 0
+                && (versioned_count == 0 || strcmp(versioned[versioned_count - 1], triples[i]->subject) != 0)) {
+            versioned[versioned_count++] = triples[i]->subject;
+        }
+    }
+
+    bool is_versioned = true;
+
+    for (int i = 0; i < triples_count && is_versioned == true; ++i) {
+        const char *subject = triples[i]->subject;
+        const char *object = triples[i]->object;
+
+        if (bsearch(&subject, versioned, versioned_count, sizeof(char *), sslog_compare_uris) == NULL
+                || (triples[i]->object_type == SSLOG_RDF_TYPE_URI
+                    && bsearch(&object, versioned, versioned_count, sizeof(char *), sslog_compare_uris) == NULL)) {
+            is_versioned = false;
+        }
+    }
+
+    free(versioned);
+
+    return is_versioned;
+}
+
+
+/**
+ * @brief Removes stored triples of the subject that are absent in the smart space.
+ * New triples are stored by the caller.
+ * @param node. Node with the store.
+ * @param subject. URI of the subject.
+ * @param triples. Triples of changed subjects from the smart space, can be NULL.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_node_sync_patch(sslog_node_t *node, const char *subject, list_t *triples)
+{
+    list_t *stored_triples = sslog_store_query_triples_by_data(node->session->store, subject, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                               SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI, -1);
+
+    if (stored_triples == NULL) {
+        return SSLOG_ERROR_NO;
+    }
+
+    list_t *removed_triples = list_new();
+    list_head_t *list_walker = NULL;
+
+    list_for_each (list_walker, &stored_triples->links) {
+        list_t *entry = list_entry(list_walker, list_t, links);
+        sslog_triple_t *stored_triple = (sslog_triple_t *) entry->data;
+        bool is_actual = false;
+
+        if (triples != NULL) {
+            list_head_t *triples_walker = NULL;
+            list_for_each (triples_walker, &triples->links) {
+                list_t *triple_entry = list_entry(triples_walker, list_t, links);
+
+                sslog_triple_t *triple = (sslog_triple_t *) triple_entry->data;
+
+                if (strcmp(stored_triple->subject, triple->subject) == 0
+                        && strcmp(stored_triple->predicate, triple->predicate) == 0
+                        && strcmp(stored_triple->object, triple->object) == 0
+                        && stored_triple->object_type == triple->object_type) {
+                    is_actual = true;
+                    break;
+                }
+            }
+        }
+
+        if (is_actual == false) {
+            list_add_data(removed_triples, sslog_triple_copy(stored_triple));
+        }
+    }
+
+    list_free_with_nodes(stored_triples, NULL);
+
+    int result = sslog_store_remove_triples(node->session->store, removed_triples);
+
+    list_free_with_nodes(removed_triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+
+    return result;
+}
+
+
 static inline char *sslog_object_get_uri(void *object)
 {
     sslog_entity_type *type = (sslog_entity_type *) object;
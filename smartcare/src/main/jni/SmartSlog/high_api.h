@@ -215,6 +215,8 @@ SSLOG_EXTERN sslog_triple_t * sslog_class_to_triple(sslog_class_t *ont_class);
  * if the property has an object-type, then an individual will be returned.
  * If the individual has several propertirs for given property when a first founded value
  * will be returned.
+ * Individual that was evicted from the local store is got again with the default node
+ * of the thread, if it is set (see #sslog_node_set_default).
  *
  * Function sets information about errors (#errors.h).
  *
@@ -230,6 +232,8 @@ SSLOG_EXTERN const void *sslog_get_property(sslog_individual_t *individual, sslo
  * @brief Gets all values for individual property.
  * If the property has an data-type, then the strings will be returned,
  * if the property has an object-type, then an individuals will be returned.
+ * Individual that was evicted from the local store is got again with the default node
+ * of the thread, if it is set (see #sslog_node_set_default).
  *
  * Returned list MUST be deleted without deleting datas (use #list_free_with_nodes).
  *
@@ -414,6 +418,32 @@ SSLOG_EXTERN sslog_individual_t *sslog_get_individual(const char *uri);
  * @return SSLOG_ERROR_NO on success or error code otherwise.
  */
 SSLOG_EXTERN int sslog_remove_individual(sslog_individual_t *individual);
+
+
+/**
+ * @brief Removes individuals from the local store in one pass.
+ * Use it instead of removing individuals one by one,
+ * triples that link removed individuals are found once.
+ * Individual structures CANNOT BE used any more.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param individuals. List with individuals to remove, list is not freed.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_remove_individuals(list_t *individuals);
+
+
+/**
+ * @brief Gets the generation of the individual in the local store.
+ * Generation is changed on each adding or removing of triples of the individual,
+ * so cached data of the individual are valid while the generation is the same.
+ * Generation can be changed without changes of the individual, it is never decreased.
+ *
+ * @param individual. Individual to check.
+ * @return generation of the individual, 0 if the individual is NULL.
+ */
+SSLOG_EXTERN unsigned long sslog_individual_get_generation(sslog_individual_t *individual);
 /** @} */ // End of Individual-local-whole group.
 /*****************************************************************************/
 
@@ -469,6 +499,69 @@ SSLOG_EXTERN list_t* sslog_node_get_individuals_by_class(sslog_node_t *node, ssl
 SSLOG_EXTERN int sslog_node_populate(sslog_node_t *node, sslog_individual_t *individual);
 
 
+/**
+ * @brief Gets all properties of many individuals with two requests.
+ * The function works as #sslog_node_populate for each individual,
+ * but triples of all individuals are queried from the smart space with one request
+ * and rdf:type triples of all linked individuals with another one.
+ * Linked individuals that are already in the local store are not queried.
+ * All triples will be stored locally.
+ *
+ * Function sets an information about errors (see #errors.h).
+ *
+ * @param[in] node. Node to work with the smart space.
+ * @param[in] individuals. List with individuals to populate, list is not freed.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_node_populate_many(sslog_node_t *node, list_t *individuals);
+
+
+/**
+ * @brief Gets the subgraph that is reachable from the individual.
+ * Individuals are got level by level (breadth-first): triples of all individuals
+ * of the level are queried from the smart space with one request, values of
+ * followed properties are individuals of the next level. Each individual is queried once,
+ * values of other object properties are got with rdf:type triples only.
+ * All triples will be stored locally, so linked individuals can be got
+ * with #sslog_get_property and #sslog_get_individual without requests.
+ *
+ * Function sets an information about errors (see #errors.h).
+ *
+ * @param[in] node. Node to work with the smart space.
+ * @param[in] root. Individual to start with.
+ * @param[in] properties. List with followed properties, NULL - all object properties.
+ * @param[in] max_depth. Maximum number of followed links from the root, negative value - no limits.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_node_prefetch(sslog_node_t *node, sslog_individual_t *root, list_t *properties, int max_depth);
+
+
+/**
+ * @brief Synchronizes the stored subgraph with the smart space by changes only.
+ * Fingerprint query (SPARQL CONSTRUCT) must return for each subject of the subgraph
+ * its triples with the given properties only (links, version triples).
+ * Fingerprint of each subject is compared with the hash of the stored triples
+ * with the same properties, subjects with other (or without) stored triples
+ * are got from the smart space completely with one request: new triples
+ * are stored and stored triples that are absent in the smart space are removed.
+ * Changes of other properties are found only by changes of version triples,
+ * so if the version is given each individual of the fingerprint (subjects and
+ * linked individuals) must have it, otherwise nothing is synchronized and
+ * SSLOG_ERROR_NOT_FOUND is returned: the subgraph must be got again.
+ *
+ * Function sets an information about errors (see #errors.h).
+ *
+ * @param[in] node. Node to work with the smart space.
+ * @param[in] query. Fingerprint query.
+ * @param[in] properties. List with properties of fingerprints (with the version).
+ * @param[in] version. Version property, NULL - versions are not required.
+ * @param[out] changed_count. Number of changed subjects, can be NULL.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_node_sync(sslog_node_t *node, const char *query, list_t *properties, sslog_property_t *version,
+                                 int *changed_count);
+
+
 /**
  * @brief Inserts the individual to the smart space.
  * The function gets triples that are represent an individual and properties and
@@ -40,6 +40,7 @@
 #include <stdlib.h>
 
 #include "triplestore.h"
+#include "triplestore_internal.h"
 #include "kpi_interface.h"
 #include "triple_internal.h"
 #include "entity_internal.h"
@@ -288,6 +289,7 @@ sslog_triple_t* sslog_new_triple_detached(const char *subject, const char *predi
    triple->object_type = object_type;
    int_triple->is_stored = false;
    int_triple->linked_entity = NULL;
+   int_triple->store_record = NULL;
 
    return triple;
 }
@@ -455,7 +457,7 @@ int sslog_node_remove_triple(sslog_node_t *node, sslog_triple_t *triple_template
 
     if (result == SSLOG_ERROR_NO) {
         sslog_error_reset(&node->last_error);
-        sslog_remove_triples(triples_templates);
+        sslog_store_remove_triples(node->session->store, triples_templates);
     } else {
         sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
     }
@@ -484,7 +486,7 @@ int sslog_node_remove_triples(sslog_node_t *node, list_t *triples_templates)
 
     if (result == SSLOG_ERROR_NO) {
         sslog_error_reset(&node->last_error);
-        sslog_remove_triples(triples_templates);
+        sslog_store_remove_triples(node->session->store, triples_templates);
     } else {
         sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
     }
@@ -750,6 +752,133 @@ int sslog_update_triple(sslog_triple_t *current_triple, sslog_triple_t *new_trip
 }
 
 
+sslog_sparql_result_t *sslog_session_select(sslog_session_t *session, list_t *patterns, int max_rows_count)
+{
+    if (patterns == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "patterns");
+        return NULL;
+    }
+
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_select(session->store, patterns, max_rows_count);
+}
+
+
+int sslog_session_save_store(sslog_session_t *session, const char *path)
+{
+    if (path == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "path");
+    }
+
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_save(session->store, path);
+}
+
+
+int sslog_session_load_store(sslog_session_t *session, const char *path)
+{
+    if (path == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "path");
+    }
+
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_load(session->store, path);
+}
+
+
+int sslog_session_freeze_store(sslog_session_t *session, list_t *triples_templates)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_freeze(session->store, triples_templates);
+}
+
+
+int sslog_session_begin_read(sslog_session_t *session)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_begin_read(session->store);
+}
+
+
+void sslog_session_end_read(sslog_session_t *session)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    sslog_store_end_read(session->store);
+}
+
+
+int sslog_session_register_ontology(sslog_session_t *session, const sslog_ontology_t *ontology)
+{
+    if (ontology == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "ontology");
+    }
+
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_set_ontology(session->store, ontology);
+}
+
+
+void sslog_session_set_store_limit(sslog_session_t *session, size_t max_bytes)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    sslog_store_set_memory_limit(session->store, max_bytes);
+}
+
+
+unsigned long sslog_session_get_evicted_count(sslog_session_t *session)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_get_evicted_count(session->store);
+}
+
+
+unsigned long sslog_session_get_store_version(sslog_session_t *session)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    return sslog_store_get_version(session->store);
+}
+
+
+void sslog_session_get_filter_stats(sslog_session_t *session, sslog_store_filter_stats_t *stats)
+{
+    if (session == NULL) {
+        session = sslog_session_get_default();
+    }
+
+    sslog_store_get_filter_stats(session->store, stats);
+}
+
+
 list_t *sslog_node_subscribe_triples(sslog_node_t *node, list_t *triples_templates)
 {
     if (node == NULL) {
@@ -850,7 +979,7 @@ sslog_sparql_result_t* sslog_node_sparql_enpoint_select(sslog_node_t *node, cons
 
     list_t *variable_triples = sslog_sparql_template_to_triples(triples_template);
 
-    sslog_store_sparql_results(sparql_result, variable_triples);
+    sslog_store_sparql_results(node->session->store, sparql_result, variable_triples);
 
     sslog_free_triples(variable_triples);
 
@@ -917,7 +1046,7 @@ sslog_sparql_result_t* sslog_node_sparql_select(sslog_node_t *node, const char *
     list_t *variable_triples = sslog_sparql_template_to_triples(triples_template);
 
 
-    sslog_store_sparql_results(sparql_result, variable_triples);
+    sslog_store_sparql_results(node->session->store, sparql_result, variable_triples);
 
     sslog_free_triples(variable_triples);
 
@@ -962,6 +1091,34 @@ list_t* sslog_node_sparql_construct(sslog_node_t *node, const char *query)
 
     return stored_triples;
 }
+
+
+list_t* sslog_node_sparql_construct_triples(sslog_node_t *node, const char *query)
+{
+    if (node == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT,
+                        SSLOG_ERROR_TEXT_NULL_ARGUMENT "node.");
+        return NULL;
+    }
+
+    if (sslog_is_str_null_empty(query) == true) {
+        sslog_error_set(&node->last_error, SSLOG_ERROR_INCORRECT_ARGUMENT,
+                        SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "'query' is NULL or empty.");
+        return NULL;
+    }
+
+    list_t *constructed_triples = NULL;
+    int result = sslog_kpi_sparql_construct(node->kpi, query, &constructed_triples);
+
+    if (result != SSLOG_ERROR_NO) {
+        sslog_error_set(&node->last_error, result, sslog_kpi_get_error_text(result));
+        return NULL;
+    }
+
+    sslog_error_reset(&node->last_error);
+
+    return (constructed_triples != NULL) ? constructed_triples : list_new();
+}
 /*****************************************************************************/
 
 
@@ -1100,7 +1257,7 @@ list_t *sslog_sparql_template_to_triples(const char *triples_templates)
 }
 
 
-int sslog_store_sparql_results(sslog_sparql_result_t *result, list_t *triples_variables)
+int sslog_store_sparql_results(sslog_store_t *store, sslog_sparql_result_t *result, list_t *triples_variables)
 {
     int stored_triples_counter = 0;
 
@@ -1121,7 +1278,7 @@ int sslog_store_sparql_results(sslog_sparql_result_t *result, list_t *triples_va
             sslog_triple_t *triple = sslog_sparql_result_to_triple(result, row, triple_variables);
 
             if (triple != NULL) {
-                sslog_store_add_triple(sslog_session_get_default()->store, triple);
+                sslog_store_add_triple(store, triple);
                 sslog_free_triple(triple);
                 ++stored_triples_counter;
             }
@@ -38,11 +38,14 @@
 #ifndef _SSLOG_KPI_API_H
 #define	_SSLOG_KPI_API_H
 
+#include <stddef.h>
+
 #include "utils/bool.h"
 #include "utils/debug.h"
 #include "utils/list.h"
 #include "session.h"
 #include "triple.h"
+#include "triplestore.h"
 
 
 #if defined(SSLOG_EXPORT)
@@ -368,6 +371,22 @@ SSLOG_EXTERN sslog_sparql_result_t* sslog_node_sparql_select(sslog_node_t *node,
  * no data to construct triples and NULL otherwise (on error).
  */
 SSLOG_EXTERN list_t* sslog_node_sparql_construct(sslog_node_t *node, const char *query);
+
+/**
+ * @brief Executes SPARQL CONSTRUCT query without storing triples.
+ *
+ * Unlike #sslog_node_sparql_construct triples are not added to the local store,
+ * so nodes of the session can construct triples in different threads at the same
+ * time, then triples are added to the store with one call (#sslog_insert_triples).
+ *
+ * Function sets information about last error (#errors.h).
+ *
+ * @param[in] node. Node to process operation.
+ * @param query. String with CONSTRUCT query form.
+ * @return list with constructed triples (free it with #sslog_free_triples) on success,
+ * empty list if there are no data to construct triples and NULL otherwise (on error).
+ */
+SSLOG_EXTERN list_t* sslog_node_sparql_construct_triples(sslog_node_t *node, const char *query);
 /*****************************************************************************/
 
 
@@ -382,6 +401,165 @@ SSLOG_EXTERN int sslog_update_triple(sslog_triple_t *current_triple, sslog_tripl
 SSLOG_EXTERN int sslog_update_triples(list_t *current_triples, list_t *new_triples);
 
 
+/**
+ * @brief Performs a local SELECT over the store of the session.
+ * Patterns are conjunctive (basic graph pattern): each pattern is a triple,
+ * elements that start with '?' are variables (for example '?answer'),
+ * #SSLOG_TRIPLE_ANY matches any value and does not bind a variable.
+ * Other elements are constants, they are compared by value only (types are not compared).
+ *
+ * Result is a table like for SPARQL SELECT: columns are variables in the order
+ * of their first appearance in patterns (names without '?'), rows are solutions.
+ * No requests are sent to the smart space, so data must be already in the local store
+ * (for example after #sslog_node_query_triples or #sslog_node_populate).
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @param[in] patterns. List with triples-patterns (see #sslog_new_triple_detached).
+ * @param[in] max_rows_count. Maximum number of rows, negative value - no limits.
+ * @return result on success (can have no rows) or NULL otherwise.
+ * @see sslog_sparql_result_t
+ */
+SSLOG_EXTERN sslog_sparql_result_t* sslog_session_select(sslog_session_t *session, list_t *patterns, int max_rows_count);
+
+
+/**
+ * @brief Saves the local store of the session to the file.
+ * The file is a ready to map image of triples, it can be loaded
+ * on the next start with #sslog_session_load_store without requests to the smart space.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @param[in] path. Path to the file, existing file is replaced.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_save_store(sslog_session_t *session, const char *path);
+
+
+/**
+ * @brief Loads the local store of the session from the file.
+ * The file is mapped to the memory and checked only, triples are created
+ * when they are requested, so loading does not depend on the number of triples.
+ * New triples (queries, subscriptions) are added to the store as usual.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with an empty local store, NULL for default session.
+ * @param[in] path. Path to the file (see #sslog_session_save_store).
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_load_store(sslog_session_t *session, const char *path);
+
+
+/**
+ * @brief Freezes a part of the local store of the session.
+ * Use it for data that are not changed after loading (ontology, questionnaire structure):
+ * triples are moved to compact sorted arrays, that need less memory and are faster to search.
+ * Frozen triples are available through all query functions, they still can be removed.
+ *
+ * Triples are created again when they are requested, so triples
+ * and their values that were got before freezing must not be used (except entities)
+ * after the end of the read section (see sslog_session_begin_read).
+ * Freezing waits for the end of read sections of other threads.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @param[in] triples_templates. Templates of triples to freeze, NULL or empty list - all stored triples.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_freeze_store(sslog_session_t *session, list_t *triples_templates);
+
+
+/**
+ * @brief Begins the read section of the current thread in the local store of the session.
+ * The local store is read by the snapshot of the beginning of the section (and own changes
+ * of the thread), so the thread is not blocked while other threads (subscriptions)
+ * change the store. Values and triples that are got in the section are not freed
+ * until its end, even if they are removed or evicted by other threads.
+ * Sections can be nested, each section must be ended with sslog_session_end_read.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_begin_read(sslog_session_t *session);
+
+
+/**
+ * @brief Ends the read section of the current thread (see sslog_session_begin_read).
+ * Values and triples that were got in the section must not be used after it.
+ * @param[in] session. Session with the local store, NULL for default session.
+ */
+SSLOG_EXTERN void sslog_session_end_read(sslog_session_t *session);
+
+
+/**
+ * @brief Registers the generated ontology in the local store of the session.
+ * Classes and properties are statically initialized by the generator, so they
+ * are not created, and schema triples are attached as a frozen part of the store
+ * without copying. Registration time does not depend on the size of the ontology.
+ * Call it before any other work with the store, again registration of the same ontology does nothing.
+ *
+ * Function sets information about errors (#errors.h).
+ *
+ * @param[in] session. Session with an empty local store, NULL for default session.
+ * @param[in] ontology. Generated ontology (see ontology.h).
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_register_ontology(sslog_session_t *session, const sslog_ontology_t *ontology);
+
+
+/**
+ * @brief Sets the memory limit of the local store of the session.
+ * When the store grows over the limit, least recently used individuals are evicted:
+ * their properties are removed from the store, individuals stay valid.
+ * Properties of evicted individuals are got again by sslog_get_property and
+ * sslog_get_properties with the default node of the thread (see sslog_node_set_default),
+ * other functions don't get them, call sslog_node_populate to get them from the smart space.
+ * Classes, properties and subjects of active subscriptions are not evicted.
+ *
+ * Values and triples that were got from the store (including values of
+ * properties of individuals) are freed after the end of the read section
+ * of the thread (see sslog_session_begin_read), without the section - by next changes of the store.
+ *
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @param[in] max_bytes. Maximum size of the store in bytes, 0 - no limits (default).
+ */
+SSLOG_EXTERN void sslog_session_set_store_limit(sslog_session_t *session, size_t max_bytes);
+
+
+/**
+ * @brief Gets number of individuals that were evicted from the local store of the session.
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @return number of evicted individuals.
+ */
+SSLOG_EXTERN unsigned long sslog_session_get_evicted_count(sslog_session_t *session);
+
+
+/**
+ * @brief Gets the version of the local store of the session.
+ * Version is increased on each change of the store, data that were read
+ * from the store are actual while the version is the same.
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @return version of the store.
+ */
+SSLOG_EXTERN unsigned long sslog_session_get_store_version(sslog_session_t *session);
+
+
+/**
+ * @brief Gets statistics of the filter of the local store.
+ * Filter finds absent subjects without searching in the store, so the data
+ * are requested from the smart space at once (see sslog_node_get_property).
+ * @param[in] session. Session with the local store, NULL for default session.
+ * @param[out] stats. Structure to fill.
+ */
+SSLOG_EXTERN void sslog_session_get_filter_stats(sslog_session_t *session, sslog_store_filter_stats_t *stats);
+
+
 /******************* Functions for late implementation ********************/
 /**
  * @brief Executes the SSAP format insert graph in RDF-XML notation operation.
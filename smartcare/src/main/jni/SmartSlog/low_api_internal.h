@@ -76,12 +76,13 @@ list_t *sslog_sparql_template_to_triples(const char *triple_template);
 
 /**
  * @brief Converts SPARQL SELECT result to triples and stores it in local store.
+ * @param store. Store of the node session.
  * @param result. Result of SPARQL SELECT query.
  * @param triples_variables. Triples with elements (subject, prediacte, object) that represent
  * names of variables in the SPARQL results.
  * @return number of stored triples in the local store.
  */
-int sslog_store_sparql_results(sslog_sparql_result_t *result, list_t *triples_variables);
+int sslog_store_sparql_results(sslog_store_t *store, sslog_sparql_result_t *result, list_t *triples_variables);
 
 /**
  * @brief Converts SPARQL SELECT result to triples.
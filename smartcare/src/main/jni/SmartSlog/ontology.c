@@ -0,0 +1,78 @@
+/**
+ * @file   ontology.c
+ * @brief  Statically generated ontologies.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Lookup of entities of generated ontologies.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "ontology.h"
+#include "entity_internal.h"
+
+#include <string.h>
+
+
+/******************************************************************************/
+/****************************** Implementations *******************************/
+/*************************** External functions *******************************/
+uint32_t sslog_ontology_hash(const char *uri, uint32_t seed)
+{
+    uint32_t hash = 2166136261u ^ seed;
+
+    for (const unsigned char *c = (const unsigned char *) uri; *c != '\0'; ++c) {
+        hash = (hash ^ *c) * 16777619u;
+    }
+
+    hash ^= hash >> 16;
+    hash *= 0x85ebca6bu;
+    hash ^= hash >> 13;
+    hash *= 0xc2b2ae35u;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+
+sslog_entity_t *sslog_ontology_find(const sslog_ontology_t *ontology, const char *uri)
+{
+    if (ontology == NULL || uri == NULL || ontology->hash_slots_count == 0) {
+        return NULL;
+    }
+
+    uint32_t bucket = sslog_ontology_hash(uri, 0) % ontology->hash_buckets_count;
+    uint32_t slot = sslog_ontology_hash(uri, ontology->hash_seeds[bucket]) % ontology->hash_slots_count;
+    int index = ontology->hash_slots[slot];
+
+    // Hash is perfect for entities only, other URIs are checked.
+    if (index < 0 || index >= ontology->entities_count
+            || strcmp(ontology->entities[index]->uri, uri) != 0) {
+        return NULL;
+    }
+
+    return ontology->entities[index];
+}
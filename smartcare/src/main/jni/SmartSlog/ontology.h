@@ -0,0 +1,121 @@
+/**
+ * @file   ontology.h
+ * @brief  Statically generated ontologies.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Ontology generator emits classes and properties as statically initialized
+ * structures, a perfect hash of their URIs and the schema triples
+ * (rdf:type of each class and property) as a ready segment image of the store.
+ * Registration of such ontology does not create entities and triples,
+ * so it does not depend on the size of the ontology.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "entity.h"
+
+#ifndef _SSLOG_ONTOLOGY_H
+#define	_SSLOG_ONTOLOGY_H
+
+#if !defined(SSLOG_EXTERN)
+#if defined(SSLOG_EXPORT)
+#define SSLOG_EXTERN __declspec(dllexport)
+#elif defined (SSLOG_IMPORT)
+#define SSLOG_EXTERN __declspec(dllimport)
+#else
+#define SSLOG_EXTERN
+#endif
+#endif
+
+
+/**
+ * @brief Initializer of the static class (generated code, needs entity_internal.h).
+ * Static entities are not linked with triples and they are never freed.
+ */
+#define SSLOG_ONTOLOGY_CLASS(uri) \
+    { { SSLOG_ENTITY_CLASS, (char *) (uri), NULL }, NULL }
+
+/**
+ * @brief Initializer of the static property (generated code, needs entity_internal.h).
+ */
+#define SSLOG_ONTOLOGY_PROPERTY(uri, domain, type) \
+    { { SSLOG_ENTITY_PROPERTY, (char *) (uri), NULL }, (char *) (domain), -1, -1, (type) }
+
+
+/**
+ * @brief Statically generated ontology.
+ *
+ * Entity with some URI is in the slot
+ * hash_slots[sslog_ontology_hash(uri, hash_seeds[sslog_ontology_hash(uri, 0) % hash_buckets_count]) % hash_slots_count],
+ * generator selects seeds of buckets, so there are no collisions (hash and displace).
+ *
+ * Schema is an image of the store segment (see sslog_session_save_store)
+ * with the rdf:type triples of all entities, it is used without copying.
+ */
+typedef struct sslog_ontology_s {
+    const char *name;                   /**< Name of the ontology. */
+    sslog_entity_t *const *entities;    /**< Classes and properties. */
+    int entities_count;                 /**< Number of entities. */
+    const uint32_t *hash_seeds;         /**< Seeds of the hash buckets. */
+    uint32_t hash_buckets_count;        /**< Number of buckets. */
+    const int16_t *hash_slots;          /**< Index of the entity in each slot, -1 - empty slot. */
+    uint32_t hash_slots_count;          /**< Number of slots. */
+    const void *schema;                 /**< Segment image with schema triples, can be NULL. */
+    size_t schema_size;                 /**< Size of the image. */
+} sslog_ontology_t;
+
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hash of the URI that is used by the perfect hash of ontologies.
+ * Generators must use the same function: FNV-1a (32 bits) with the seed
+ * mixed into the offset basis and the finalizer of MurmurHash3.
+ * @param uri. URI of the entity.
+ * @param seed. Seed of the hash.
+ * @return hash of the URI.
+ */
+SSLOG_EXTERN uint32_t sslog_ontology_hash(const char *uri, uint32_t seed);
+
+
+/**
+ * @brief Finds the class or the property of the ontology.
+ * @param ontology. Generated ontology.
+ * @param uri. URI of the entity.
+ * @return entity on success or NULL otherwise (there is no such entity).
+ */
+SSLOG_EXTERN sslog_entity_t *sslog_ontology_find(const sslog_ontology_t *ontology, const char *uri);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* _SSLOG_ONTOLOGY_H */
@@ -37,6 +37,10 @@
 #include <string.h>
 #include <time.h>
 
+#ifdef MTENABLE
+#include <pthread.h>
+#endif
+
 #include "subscription_internal.h"
 
 #include "triplestore.h"
@@ -62,10 +66,38 @@ static sslog_session_t *g_session_default = NULL;
 /** @brief Contains all sessions and default session (#g_session_default). */
 static list_t g_sessions = {NULL, LIST_HEAD_INIT(g_sessions.links)};
 
+#ifdef MTENABLE
+/**
+ * @brief Key of the default session of the thread (see #sslog_session_set_default),
+ * threads without own session use #g_session_default.
+ */
+static pthread_key_t g_session_thread_key;
+static pthread_once_t g_session_thread_once = PTHREAD_ONCE_INIT;
+
+/** @brief Key of the default node of the thread (see #sslog_node_set_default). */
+static pthread_key_t g_node_thread_key;
+
+/** @brief Guards the list of sessions and lists of nodes of sessions. */
+static pthread_mutex_t g_sessions_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+#define SSLOG_SESSIONS_LOCK() pthread_mutex_lock(&g_sessions_mutex)
+#define SSLOG_SESSIONS_UNLOCK() pthread_mutex_unlock(&g_sessions_mutex)
+#else
+#define SSLOG_SESSIONS_LOCK()
+#define SSLOG_SESSIONS_UNLOCK()
+
+/** @brief Default node of the process (see #sslog_node_set_default). */
+static sslog_node_t *g_node_default = NULL;
+#endif
+
 
 /******************************** Definitions *********************************/
 /***************************** Static functions *******************************/
 static bool sslog_session_has_id(sslog_session_t *session, const char *nodeId);
+static sslog_session_t *sslog_get_process_session();
+#ifdef MTENABLE
+static void sslog_session_create_thread_key();
+#endif
 
 
 /****************************** Implementations *********************************/
@@ -92,7 +124,9 @@ sslog_session_t *sslog_new_session()
     INIT_LIST_HEAD(&session->nodes.links);
     INIT_LIST_HEAD(&session->subscriptions.links);
 
+    SSLOG_SESSIONS_LOCK();
     list_add_data(&g_sessions, session);
+    SSLOG_SESSIONS_UNLOCK();
 
     SSLOG_DEBUG_FUNC("Sessions in use: %d\n", list_count(&g_sessions));
 
@@ -124,10 +158,21 @@ void sslog_free_session(sslog_session_t *session)
         return;
     }
 
+    if (sslog_session_get_default() == session) {
+        sslog_session_set_default(NULL);
+    }
+
     sslog_store_free(session->store);
 
     list_del_and_free_nodes(&session->nodes, LIST_CAST_TO_FREE_FUNC sslog_free_node);
+
+    SSLOG_SESSIONS_LOCK();
     list_del_and_free_nodes_with_data(&g_sessions, session, NULL);
+
+    if (g_session_default == session) {
+        g_session_default = NULL;
+    }
+    SSLOG_SESSIONS_UNLOCK();
     free(session);
     SSLOG_DEBUG_FUNC("Sessions in use: %d\n", list_count(&g_sessions));
 }
@@ -167,7 +212,12 @@ sslog_node_t* sslog_new_session_node(sslog_session_t *session,
         return NULL;
     }
 
+    // Identifier is checked and the node is added at once,
+    // so threads can create nodes in the same session.
+    SSLOG_SESSIONS_LOCK();
+
     if (sslog_session_has_id(session, id) == true) {
+        SSLOG_SESSIONS_UNLOCK();
         sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_ARGUMENT,
                         SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "'id' already is used.");
         return NULL;
@@ -186,7 +236,10 @@ sslog_node_t* sslog_new_session_node(sslog_session_t *session,
 
     list_add_data(&node->session->nodes, node);
 
+    SSLOG_SESSIONS_UNLOCK();
+
     INIT_LIST_HEAD(&node->subscriptions.links);
+    sslog_error_reset(&node->last_error);
 
     return node;
 
@@ -194,12 +247,28 @@ sslog_node_t* sslog_new_session_node(sslog_session_t *session,
 }
 
 
+sslog_node_t* sslog_new_node_copy(sslog_node_t *node, const char *id)
+{
+    if (node == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT,
+                        SSLOG_ERROR_TEXT_NULL_ARGUMENT "'node'.");
+        return NULL;
+    }
+
+    return sslog_new_session_node(node->session, id, node->ss_id, node->ss_address, node->port);
+}
+
+
 void sslog_free_node(sslog_node_t *node)
 {
     if (node == NULL) {
         return;
     }
 
+    if (sslog_node_get_default() == node) {
+        sslog_node_set_default(NULL);
+    }
+
     //FIXME:unsubscribe all subscription.
     // Remove all subscription.
     list_del_and_free_nodes(&node->subscriptions, LIST_CAST_TO_FREE_FUNC sslog_free_subscription);
@@ -207,7 +276,9 @@ void sslog_free_node(sslog_node_t *node)
     sslog_error_reset(&node->last_error);
 
     // Remove node from the session.
+    SSLOG_SESSIONS_LOCK();
     list_del_and_free_nodes_with_data(&node->session->nodes, node, NULL);
+    SSLOG_SESSIONS_UNLOCK();
 
     // Prepare node to free.
     node->session = NULL;
@@ -226,16 +297,52 @@ sslog_node_t *sslog_new_node(const char *id, const char *ss_id, const char *addr
 {
     sslog_error_reset(NULL);
 
-    if (g_session_default == NULL) {
-        g_session_default = sslog_new_session();
+    sslog_session_t *session = sslog_session_get_default();
+
+    if (session == NULL) {
+        session = sslog_get_process_session();
     }
 
-    if (g_session_default == NULL) {
+    if (session == NULL) {
         sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
         return NULL;
     }
 
-    return sslog_new_session_node(g_session_default, id, ss_id, address, port);
+    return sslog_new_session_node(session, id, ss_id, address, port);
+}
+
+
+int sslog_session_set_default(sslog_session_t *session)
+{
+#ifdef MTENABLE
+    pthread_once(&g_session_thread_once, sslog_session_create_thread_key);
+
+    if (pthread_setspecific(g_session_thread_key, session) != 0) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+#else
+    if (session != NULL) {
+        g_session_default = session;
+    }
+#endif
+
+    return sslog_error_reset(NULL);
+}
+
+
+int sslog_node_set_default(sslog_node_t *node)
+{
+#ifdef MTENABLE
+    pthread_once(&g_session_thread_once, sslog_session_create_thread_key);
+
+    if (pthread_setspecific(g_node_thread_key, node) != 0) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+#else
+    g_node_default = node;
+#endif
+
+    return sslog_error_reset(NULL);
 }
 
 
@@ -278,11 +385,7 @@ int sslog_init()
 
     // Create a default session if it is needed
     // and a make initialization for low-level KPI.
-    if (g_session_default == NULL) {
-        g_session_default = sslog_new_session();
-    }
-
-    if (g_session_default == NULL) {
+    if (sslog_get_process_session() == NULL) {
         return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY,
                         SSLOG_ERROR_TEXT_OUT_OF_MEMORY " Can't create the default session.");
     }
@@ -317,13 +420,92 @@ void sslog_shutdown()
 /**************************** Internal functions ******************************/
 sslog_session_t *sslog_session_get_default()
 {
+#ifdef MTENABLE
+    pthread_once(&g_session_thread_once, sslog_session_create_thread_key);
+
+    sslog_session_t *session = (sslog_session_t *) pthread_getspecific(g_session_thread_key);
+
+    if (session != NULL) {
+        return session;
+    }
+#endif
+
     return g_session_default;
 }
 
 
+sslog_node_t *sslog_node_get_default()
+{
+#ifdef MTENABLE
+    pthread_once(&g_session_thread_once, sslog_session_create_thread_key);
+
+    return (sslog_node_t *) pthread_getspecific(g_node_thread_key);
+#else
+    return g_node_default;
+#endif
+}
+
+
+sslog_store_t *sslog_node_get_store(sslog_node_t *node)
+{
+    if (node == NULL || node->session == NULL) {
+        sslog_session_t *session = sslog_session_get_default();
+        return (session == NULL) ? NULL : session->store;
+    }
+
+    return node->session->store;
+}
+
+
 
 /****************************** Implementation ********************************/
 /***************************** Static functions *******************************/
+#ifdef MTENABLE
+static void sslog_session_create_thread_key()
+{
+    // Sessions and nodes are not owned by threads, so there are no destructors.
+    pthread_key_create(&g_session_thread_key, NULL);
+    pthread_key_create(&g_node_thread_key, NULL);
+}
+#endif
+
+
+/**
+ * @brief Gets the default session of the process, it is created on the first call.
+ * @return default session or NULL if it can't be created.
+ */
+static sslog_session_t *sslog_get_process_session()
+{
+    SSLOG_SESSIONS_LOCK();
+    bool is_created = (g_session_default == NULL);
+    SSLOG_SESSIONS_UNLOCK();
+
+    if (is_created == false) {
+        return g_session_default;
+    }
+
+    sslog_session_t *session = sslog_new_session();
+
+    if (session == NULL) {
+        return NULL;
+    }
+
+    SSLOG_SESSIONS_LOCK();
+    if (g_session_default == NULL) {
+        g_session_default = session;
+        session = NULL;
+    }
+    SSLOG_SESSIONS_UNLOCK();
+
+    // Other thread has created the session.
+    if (session != NULL) {
+        sslog_free_session(session);
+    }
+
+    return g_session_default;
+}
+
+
 static bool sslog_session_has_id(sslog_session_t *session, const char *nodeId)
 {
     list_head_t *list_walker = NULL;
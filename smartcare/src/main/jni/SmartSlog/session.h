@@ -133,8 +133,38 @@ SSLOG_EXTERN sslog_session_t* sslog_new_session();
  */
 SSLOG_EXTERN void sslog_free_session(sslog_session_t *session);
 
+/**
+ * @brief Sets the default session of the calling thread.
+ * Functions without node or session (local store functions, #sslog_new_node)
+ * work with the default session of the thread, threads that have not set it
+ * use the default session of the process. So each worker thread can have
+ * its own session and store without locking.
+ * The session must not be freed while it is a default session of other threads.
+ *
+ * Function sets information about last error (#errors.h).
+ * @param[in] session. Session of the thread or NULL to use the default session of the process.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_session_set_default(sslog_session_t *session);
+
+/**
+ * @brief Sets the default node of the calling thread.
+ * Local functions without node (#sslog_get_property, #sslog_get_properties)
+ * get properties of individuals that were evicted from the local store
+ * (see #sslog_session_set_store_limit) again with this node.
+ * Node must be in the default session of the thread and it must be used
+ * by this thread only. Node is reset when it is freed by this thread,
+ * other threads must reset it before freeing.
+ *
+ * Function sets information about last error (#errors.h).
+ * @param[in] node. Node of the thread or NULL, evicted properties are not got again then.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+SSLOG_EXTERN int sslog_node_set_default(sslog_node_t *node);
+
 /**
  * @brief Creates a new node in the default session.
+ * Default session of the thread is used if it is set (see #sslog_session_set_default).
  * Function sets information about last error (#errors.h).
  * @param[in] id. Identifier of the node, this id must be uniq in the session.
  * @param[in] ss_id. Smart space identifier.
@@ -158,6 +188,17 @@ SSLOG_EXTERN sslog_node_t* sslog_new_node(const char *id, const char *ss_id, con
  */
 SSLOG_EXTERN sslog_node_t* sslog_new_session_node(sslog_session_t *session, const char *id, const char *ss_id, const char *address, int port);
 
+/**
+ * @brief Creates a new node with the same session and smart space as the given node.
+ * It is an additional connection to the smart space, each node can be used
+ * by its own thread (node is not joined).
+ * Function sets information about last error (#errors.h).
+ * @param[in] node. Node to copy.
+ * @param[in] id. Identifier of the new node, this id must be uniq in the session.
+ * @return new node on success or NULL otherwise (get errno with #sslog_error_get_last_code()).
+ */
+SSLOG_EXTERN sslog_node_t* sslog_new_node_copy(sslog_node_t *node, const char *id);
+
 /**
  * @brief Free session.
  * Functions disconnect all nodes from the smart space, stops subscriptions.
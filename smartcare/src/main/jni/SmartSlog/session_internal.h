@@ -71,7 +71,26 @@ struct sslog_node_s {
 
 
 
+/**
+ * @brief Gets the default session of the calling thread.
+ * @return session of the thread (see #sslog_session_set_default)
+ * or the default session of the process.
+ */
 sslog_session_t *sslog_session_get_default();
 
+/**
+ * @brief Gets the default node of the calling thread.
+ * @return node of the thread (see #sslog_node_set_default) or NULL.
+ */
+sslog_node_t *sslog_node_get_default();
+
+/**
+ * @brief Gets the store of the node session.
+ * Functions with node must work with this store, not with the store of the default session.
+ * @param node. Node to get store (NULL - store of the default session).
+ * @return store or NULL if there is no session.
+ */
+sslog_store_t *sslog_node_get_store(sslog_node_t *node);
+
 
 #endif	/* _SSLOG_SESSION_H */
@@ -40,6 +40,7 @@
 
 #include "session.h"
 #include "entity.h"
+#include "ontology.h"
 #include "kpi_api.h"
 #include "high_api.h"
 #include "subscription.h"
@@ -146,6 +146,7 @@ static async_sbcr_thread_t async_sbcr_thread_info = {0, -1};
 /**************************** Static functions *******************************/
 static void add_subscription(sslog_subscription_t *container);
 static void remove_subscription(sslog_subscription_t *subscription);
+static void pin_subscription_subjects(sslog_subscription_t *subscription, bool is_pinned);
 static int process_subscription(sslog_subscription_t *subscription, int timeout);
 static int wait_unsubscription(sslog_subscription_t *subscription,
         int attempts_number);
@@ -833,6 +834,8 @@ SSLOG_EXTERN int sslog_sbcr_subscribe(sslog_subscription_t *subscription)
 
     subscription->is_active = true;
 
+    pin_subscription_subjects(subscription, true);
+
     // This step called first synchronization:
     // all triples that were receiveved after subscription are set as new.
     // Create an empty list  with old triples to update subscription.
@@ -1216,7 +1219,9 @@ subscription_data_t* new_subscription_data(sslog_individual_t *individual, list_
     list_for_each (list_walker, &properties->links) {
         list_t *entry = list_entry(list_walker, list_t, links);
         sslog_property_t *property = (sslog_property_t *) entry->data;
-        sslog_triple_t *triple = sslog_triple_copy(property->entity.linked_triple);
+        // Properties of the generated ontology are not linked with triples.
+        sslog_triple_t *triple = sslog_new_triple_detached(property->entity.uri, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_RDF_PROPERTY,
+                                                           SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
 
         list_add_data(data->properties_triples, triple);
     }
@@ -1327,6 +1332,10 @@ static void remove_subscription(sslog_subscription_t *subscription)
         return;
     }
 
+    if (subscription->is_active == true) {
+        pin_subscription_subjects(subscription, false);
+    }
+
     // Remove synchronous subscription.
     if (subscription->is_asynchronous == false) {
         list_del_and_free_nodes_with_data(&g_sync_subscriptions, subscription, NULL);
@@ -1366,6 +1375,33 @@ static void remove_subscription(sslog_subscription_t *subscription)
 #endif
 }
 
+/**
+ * @brief Pins or unpins subjects of subscribed triples in the local store.
+ *
+ * Subscribed data are updated by indications, so they are not evicted
+ * from the store while the subscription is active.
+ *
+ * @param[in] subscription subscription with triples.
+ * @param[in] is_pinned true to pin subjects, false to release them.
+ */
+static void pin_subscription_subjects(sslog_subscription_t *subscription, bool is_pinned)
+{
+    sslog_store_t *store = sslog_node_get_store(subscription->linked_node);
+    list_head_t *list_walker = NULL;
+
+    list_for_each(list_walker, &subscription->sbrc_triples.links)
+    {
+        list_t *node = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+
+        if (strcmp(triple->subject, SSLOG_TRIPLE_ANY) == 0) {
+            continue;
+        }
+
+        sslog_store_pin_subject(store, triple->subject, is_pinned);
+    }
+}
+
 /**
  * @brief Checks notification for the subscription.
  *
@@ -1597,7 +1633,7 @@ static void update_subscription(sslog_subscription_t *subscription,
     }
 
 
-    sslog_store_update_triples(sslog_session_get_default()->store, old_triples, new_triples);
+    sslog_store_update_triples(sslog_node_get_store(subscription->linked_node), old_triples, new_triples);
 
     list_t *copy_list = sslog_copy_triples(old_triples);
     list_add_list(copy_list , &subscription->last_changes->removed_triples);
@@ -1681,7 +1717,7 @@ static void update_subscription(sslog_subscription_t *subscription,
         // Get property using uri from the smart space.
         char *prop_name = active_triple->predicate;
 
-        sslog_property_t *prop_type = sslog_store_get_property(sslog_session_get_default()->store, prop_name);
+        sslog_property_t *prop_type = sslog_store_get_property(sslog_node_get_store(node), prop_name);
 
         if (prop_type == NULL) {
             SSLOG_DEBUG_FUNC("No property - %s for individual %s",
@@ -1719,7 +1755,7 @@ static void update_subscription(sslog_subscription_t *subscription,
             void *old_data = old_triple->object;
 
             if (sslog_property_is_object(prop_type) == true) {
-                old_data = sslog_store_get_individual(sslog_session_get_default()->store, old_triple->object);
+                old_data = sslog_store_get_individual(sslog_node_get_store(node), old_triple->object);
             }
 
             sslog_individual_t *ind = sslog_new_individual_from_triple(individual_triple);
@@ -1884,7 +1920,7 @@ static sslog_individual_t *get_or_create_individual_with_uuid(sslog_node_t *node
 {
     SSLOG_DEBUG_START
 
-    sslog_individual_t *ind = sslog_store_get_individual(sslog_session_get_default()->store, uri);
+    sslog_individual_t *ind = sslog_store_get_individual(sslog_node_get_store(node), uri);
 
     if (ind == NULL) {
 
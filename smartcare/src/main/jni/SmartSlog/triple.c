@@ -176,6 +176,7 @@ sslog_triple_t* sslog_triple_copy(sslog_triple_t *triple)
     sslog_internal_triple_t *new_triple = (sslog_internal_triple_t *) malloc(sizeof(sslog_internal_triple_t));
 
     new_triple->linked_entity = NULL;
+    new_triple->store_record = NULL;
     new_triple->is_stored = false;
     new_triple->data.subject = sslog_strndup(triple->subject, SSLOG_TRIPLE_SUBJECT_LEN);
     new_triple->data.predicate = sslog_strndup(triple->predicate, SSLOG_TRIPLE_PREDICATE_LEN);
@@ -237,6 +238,7 @@ sslog_triple_t *sslog_new_triple_empty()
     triple->object_type = SSLOG_RDF_TYPE_INCORRECT;
     int_triple->is_stored = false;
     int_triple->linked_entity = NULL;
+    int_triple->store_record = NULL;
 
     return triple;
 }
@@ -79,6 +79,7 @@ typedef struct sslog_internal_triple_s {
          /* Plus internals: */
         bool is_stored;
         sslog_entity_t* linked_entity;
+        struct sslog_store_record_s *store_record; /**< Record in the store, NULL for unstored triple. */
 //    } i;
 } sslog_internal_triple_t;
 
@@ -34,26 +34,124 @@
  */
 
 #include "triplestore.h"
+#include "triplestore_internal.h"
 
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef MTENABLE
+#include <sched.h>
+#endif
+
 #include "kpi_api.h"
 #include "entity_internal.h"
 #include "triple_internal.h"
 
 #include "utils/errors.h"
+#include "utils/errors_internal.h"
 #include "utils/list.h"
 #include "utils/util_func.h"
 
 
-#define SSLOG_STORE_CAST (list_t *)
-#define SSLOG_FREE_FUNC_CAST (void (*)(void*))
+/** @brief Initial capacity of the array with founded records. */
+#define SSLOG_STORE_MATCHES_INITIAL_CAPACITY 16
+
+
+#ifdef MTENABLE
+/** @brief Key of read sections of the thread (list of sslog_store_reader_t). */
+static pthread_key_t g_store_readers_key;
+static pthread_once_t g_store_readers_once = PTHREAD_ONCE_INIT;
+
+#define SSLOG_STORE_READERS_LOCK(store) pthread_mutex_lock(&(store)->readers_lock)
+#define SSLOG_STORE_READERS_UNLOCK(store) pthread_mutex_unlock(&(store)->readers_lock)
+#else
+/** @brief Read sections of the only thread. */
+static sslog_store_reader_t *g_store_readers = NULL;
 
-#define sslog_store_to_list(store, variable) list_t *variable = (list_t *) store;
+#define SSLOG_STORE_READERS_LOCK(store)
+#define SSLOG_STORE_READERS_UNLOCK(store)
+#endif
+
+
+/**
+ * @brief Triple that is matched to templates: a record or a row of the segment.
+ */
+typedef struct sslog_store_match_s {
+    sslog_store_record_t *record;       /**< Founded record, NULL for the segment row. */
+    uint32_t row;                       /**< Founded row of the segment. */
+    unsigned long order;                /**< Order in the store, rows are older than records. */
+} sslog_store_match_t;
 
 
-static bool sslog_store_match_templates(sslog_triple_t *triple, list_t *triples_templates);
+/**
+ * @brief Records that are matched to templates.
+ */
+typedef struct sslog_store_matches_s {
+    sslog_store_match_t *records;       /**< Founded records. */
+    int count;                          /**< Number of records. */
+    int capacity;                       /**< Size of the array. */
+} sslog_store_matches_t;
+
+
+static void sslog_store_lock_write(sslog_store_t *store);
+static void sslog_store_unlock_write(sslog_store_t *store);
+static void sslog_store_yield(sslog_store_t *store, int *changes_count);
+static void sslog_store_lock_exclusive(sslog_store_t *store);
+static void sslog_store_unlock_exclusive(sslog_store_t *store);
+static sslog_store_reader_t *sslog_store_thread_readers();
+static void sslog_store_set_thread_readers(sslog_store_reader_t *readers);
+static sslog_store_reader_t *sslog_store_find_reader(sslog_store_t *store);
+static void sslog_store_publish(sslog_store_t *store);
+static unsigned long sslog_store_oldest_snapshot(sslog_store_t *store);
+static void sslog_store_reclaim(sslog_store_t *store);
+static void sslog_store_unlink_record(sslog_store_t *store, sslog_store_record_t *record);
+static void sslog_store_retire(sslog_store_t *store, sslog_triple_t *triple, uint32_t row);
+static sslog_triple_t *sslog_store_detach_triple(sslog_triple_t *triple);
+#ifdef MTENABLE
+static void sslog_store_create_readers_key();
+#endif
+static bool sslog_store_is_bound(const char *value);
+static int sslog_store_matches_add(sslog_store_matches_t *matches, sslog_store_record_t *record,
+                                   uint32_t row, unsigned long order);
+static int sslog_store_compare_records(const void *a, const void *b);
+static bool sslog_store_match_record(sslog_store_record_t *record, sslog_store_key_t *keys[SSLOG_STORE_FIELDS_COUNT],
+                                     sslog_triple_t *triple_template, unsigned long snapshot);
+static bool sslog_store_match_row(const sslog_store_segment_row_t *row, long terms[SSLOG_STORE_FIELDS_COUNT],
+                                  sslog_triple_t *triple_template);
+static sslog_triple_t *sslog_store_match_triple(sslog_store_t *store, sslog_store_match_t *match);
+static int sslog_store_match_segment(sslog_store_t *store, sslog_triple_t *triple_template,
+                                     int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches);
+static int sslog_store_match_template(sslog_store_t *store, sslog_triple_t *triple_template,
+                                      int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches);
+static int sslog_store_match_templates(sslog_store_t *store, list_t *triples_templates,
+                                       int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches);
+static list_t *sslog_store_matches_to_list(sslog_store_t *store, sslog_store_matches_t *matches);
+static sslog_store_record_t *sslog_store_find_equal(sslog_store_t *store, sslog_triple_t *triple, unsigned long snapshot);
+static long sslog_store_find_row(sslog_store_t *store, sslog_triple_t *triple, unsigned long snapshot);
+static sslog_triple_t *sslog_store_find_stored(sslog_store_t *store, sslog_triple_t *triple);
+static int sslog_store_insert(sslog_store_t *store, sslog_triple_t *triple);
+static void sslog_store_delete_record(sslog_store_t *store, sslog_store_record_t *record);
+static void sslog_store_delete_row(sslog_store_t *store, uint32_t row);
+static int sslog_store_prepare_deleting(sslog_store_t *store, sslog_store_matches_t *matches);
+static list_t *sslog_store_query_data(sslog_store_t *store,
+                                      const char *subject, const char *predicate, const char *object,
+                                      sslog_rdf_type subject_type, sslog_rdf_type object_type,
+                                      int max_triples_count, unsigned long snapshot);
+static sslog_triple_t *sslog_store_find_rdftype(sslog_store_t *store, const char *uri, unsigned long snapshot);
+static int sslog_store_insert_triples(sslog_store_t *store, list_t *triples);
+static int sslog_store_delete_triples(sslog_store_t *store, list_t *triples_templates);
+static void sslog_store_matches_unique(sslog_store_matches_t *matches);
+static int sslog_store_delete_matches(sslog_store_t *store, sslog_store_matches_t *matches, list_t *triples_templates);
+static int sslog_store_match_individual(sslog_store_t *store, sslog_individual_t *individual, sslog_store_matches_t *matches);
+static size_t sslog_store_record_size(sslog_triple_t *triple);
+static int sslog_store_compare_access(const void *a, const void *b);
+static bool sslog_store_evict_subject(sslog_store_t *store, sslog_store_key_t *key);
+static void sslog_store_evict(sslog_store_t *store, unsigned long since_clock);
+static void sslog_store_filter_values(sslog_store_filter_t *filter, sslog_triple_t *triple);
+static int sslog_store_filter_template(sslog_store_t *store, sslog_triple_t *triple_template);
+static void sslog_store_update_filter(sslog_store_t *store);
+static void sslog_store_rebuild_filter(sslog_store_t *store);
+static void sslog_store_load_filter(sslog_store_t *store);
 
 /*****************************************************************************/
 /**************************** External functions *****************************/
@@ -65,12 +163,15 @@ static bool sslog_store_match_templates(sslog_triple_t *triple, list_t *triples_
 /// @cond DOXY_EXTERNAL_API
 list_t *sslog_store_get_individual_triples(sslog_store_t *store, sslog_individual_t *individual, bool with_rdftype)
 {
-    sslog_store_to_list(store, store_list);
+    sslog_store_lock_read(store);
 
-    list_t *ind_triples = sslog_store_query_triples_by_data(store_list, individual->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
-                                                           SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI, -1);
+    unsigned long snapshot = sslog_store_read_snapshot(store);
+
+    list_t *ind_triples = sslog_store_query_data(store, individual->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
+                                                 SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI, -1, snapshot);
 
     if (ind_triples == NULL) {
+        sslog_store_unlock_read(store);
         SSLOG_DEBUG_FUNC("Can't query triples for individual: '%s'.", individual->entity.uri);
         return NULL;
     }
@@ -95,7 +196,7 @@ list_t *sslog_store_get_individual_triples(sslog_store_t *store, sslog_individua
         sslog_triple_t *type_triple = NULL;
 
         if (with_rdftype == true) {
-            type_triple = sslog_store_get_rdftype(store, triple->object);
+            type_triple = sslog_store_find_rdftype(store, triple->object, snapshot);
         }
 
         if (type_triple != NULL) {
@@ -103,6 +204,8 @@ list_t *sslog_store_get_individual_triples(sslog_store_t *store, sslog_individua
         }
     }
 
+    sslog_store_unlock_read(store);
+
     return ind_triples;
 }
 
@@ -177,479 +280,2426 @@ list_t *sslog_store_get_individual_triples(sslog_store_t *store, sslog_individua
 /******************************************************************************/
 /***************************** Static functions *******************************/
 
+/**
+ * @brief Takes the lock of the writer for the whole change.
+ * Lock of readers is taken too, it is released by steps (see sslog_store_yield).
+ * @param store. Store with triples.
+ */
+static void sslog_store_lock_write(sslog_store_t *store)
+{
+#ifdef MTENABLE
+    pthread_mutex_lock(&store->write_lock);
+#endif
+    sslog_store_lock_step(store);
+}
 
 
+/**
+ * @brief Completes the change: readers see it from now and removed data
+ * that is not seen by read sections is freed.
+ * @param store. Store with triples.
+ */
+static void sslog_store_unlock_write(sslog_store_t *store)
+{
+    sslog_store_publish(store);
+    sslog_store_reclaim(store);
 
+    sslog_store_unlock_step(store);
+#ifdef MTENABLE
+    pthread_mutex_unlock(&store->write_lock);
+#endif
+}
 
 
-
-sslog_store_t* repo_new()
+/**
+ * @brief Lets readers work in the middle of the change.
+ * Lock of readers is released after each SSLOG_STORE_WRITE_STEP changes,
+ * readers don't see not completed changes and the writer keeps its lock,
+ * so records and keys that are found by the writer are not freed.
+ * @param store. Store with triples.
+ * @param changes_count. Counter of changes of the current operation.
+ */
+static void sslog_store_yield(sslog_store_t *store, int *changes_count)
 {
-    return list_new();
+    if (++(*changes_count) % SSLOG_STORE_WRITE_STEP != 0) {
+        return;
+    }
+
+#ifdef MTENABLE
+    sslog_store_unlock_step(store);
+    sched_yield();
+    sslog_store_lock_step(store);
+#else
+    (void) store;
+#endif
 }
 
 
-sslog_store_t *sslog_store_new()
+/**
+ * @brief Takes the lock of the writer after the end of read sections of other threads.
+ * It is used by changes that replace the segment: snapshots of the old segment are not kept.
+ * New sections wait for the end of the change.
+ * @param store. Store with triples.
+ */
+static void sslog_store_lock_exclusive(sslog_store_t *store)
 {
-    return list_new();
+    sslog_store_reader_t *own_reader = sslog_store_find_reader(store);
+
+    SSLOG_STORE_READERS_LOCK(store);
+
+    ++store->exclusive_count;
+
+    // Writer lock is taken after waiting: threads in sections can wait for it.
+    for (;;) {
+        list_head_t *first = store->readers.next;
+        bool has_readers = (first != &store->readers && (first->next != &store->readers
+                            || list_entry(first, sslog_store_reader_t, links) != own_reader)) ? true : false;
+
+        if (has_readers == false) {
+            break;
+        }
+
+#ifdef MTENABLE
+        pthread_cond_wait(&store->readers_changed, &store->readers_lock);
+#endif
+    }
+
+    SSLOG_STORE_READERS_UNLOCK(store);
+
+    sslog_store_lock_write(store);
 }
 
 
-void sslog_store_free(sslog_store_t *store)
+/**
+ * @brief Completes the exclusive change and lets new read sections begin.
+ * @param store. Store with triples.
+ */
+static void sslog_store_unlock_exclusive(sslog_store_t *store)
 {
-    list_t *store_list = SSLOG_STORE_CAST(store);
+    sslog_store_unlock_write(store);
 
-    list_free_with_nodes(store_list, SSLOG_FREE_FUNC_CAST sslog_free_triple_force);
+    SSLOG_STORE_READERS_LOCK(store);
 
-//    list_head_t *list_walker = NULL;
-//    list_head_t *position = NULL;
-//    list_for_each_safe(list_walker, position, &store_list->links) {
-//        list_t *node = list_entry(list_walker, list_t, links);
-//        sslog_triple_t *triple = (sslog_triple_t *) node->data;
-//        list_del_and_free_node(node, SSLOG_FREE_FUNC_CAST sslog_free_triple_force);
-//    }
+    --store->exclusive_count;
 
-//    list_free(store_list);
+#ifdef MTENABLE
+    pthread_cond_broadcast(&store->readers_changed);
+#endif
 
-    //list_free_with_nodes(SSLOG_STORE_CAST store, SSLOG_FREE_FUNC_CAST );
+    SSLOG_STORE_READERS_UNLOCK(store);
 }
 
 
-int sslog_store_add_triple(sslog_store_t *store, sslog_triple_t *triple)
+#ifdef MTENABLE
+static void sslog_store_create_readers_key()
 {
-    list_t *list = SSLOG_STORE_CAST(store);
+    pthread_key_create(&g_store_readers_key, NULL);
+}
+#endif
 
-    if (list_has_data_with_equals(list, triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples) == true) {
-        return SSLOG_ERROR_ALREADY_EXISTS;
-    }
-    
-    list_add_data(list, triple);
-    sslog_triple_stored(triple, true);
-    
-    SSLOG_DEBUG_FUNC("New triple: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
-    SSLOG_DEBUG_FUNC("Stored triples: %d", list_count(list));
 
-    return SSLOG_ERROR_NO;
-}
+/**
+ * @brief Gets read sections of the current thread.
+ * @return list of sections or NULL if there are no sections.
+ */
+static sslog_store_reader_t *sslog_store_thread_readers()
+{
+#ifdef MTENABLE
+    pthread_once(&g_store_readers_once, sslog_store_create_readers_key);
 
+    return (sslog_store_reader_t *) pthread_getspecific(g_store_readers_key);
+#else
+    return g_store_readers;
+#endif
+}
 
 
-sslog_triple_t* sslog_store_add_get_triple(sslog_store_t *store, sslog_triple_t *triple)
+/**
+ * @brief Sets read sections of the current thread.
+ * @param readers. List of sections, NULL if there are no sections.
+ */
+static void sslog_store_set_thread_readers(sslog_store_reader_t *readers)
 {
-    list_t *list = SSLOG_STORE_CAST(store);
+#ifdef MTENABLE
+    pthread_once(&g_store_readers_once, sslog_store_create_readers_key);
+    pthread_setspecific(g_store_readers_key, readers);
+#else
+    g_store_readers = readers;
+#endif
+}
 
-    list_t *node = list_get_node_with_equals(list, triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
 
-    if (node != NULL) {
-        SSLOG_DEBUG_FUNC("Triple already stored: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
-        return (sslog_triple_t *)node->data;
+/**
+ * @brief Finds the read section of the current thread with the store.
+ * @param store. Store with triples.
+ * @return section or NULL if the thread is not in the section.
+ */
+static sslog_store_reader_t *sslog_store_find_reader(sslog_store_t *store)
+{
+    sslog_store_reader_t *reader = sslog_store_thread_readers();
+
+    while (reader != NULL && reader->store != store) {
+        reader = reader->next;
     }
 
-    list_add_data(list, triple);
-    sslog_triple_stored(triple, true);
+    return reader;
+}
 
-    SSLOG_DEBUG_FUNC("New triple: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
-    SSLOG_DEBUG_FUNC("Stored triples: %d", list_count(list));
 
-    return triple;
+/**
+ * @brief Makes the changes of the writer visible for readers.
+ * The section of the writer thread sees own changes, but its old data is kept.
+ * @param store. Store with triples, locked by the writer.
+ */
+static void sslog_store_publish(sslog_store_t *store)
+{
+    SSLOG_STORE_READERS_LOCK(store);
+    store->published = store->version;
+    SSLOG_STORE_READERS_UNLOCK(store);
+
+    sslog_store_reader_t *own_reader = sslog_store_find_reader(store);
+
+    if (own_reader != NULL) {
+        own_reader->snapshot = store->version;
+    }
 }
 
 
-sslog_triple_t *sslog_store_get_triple_by_data(sslog_store_t *store, const char *subject, const char *predicate, const char *object,
-                                               sslog_rdf_type subject_type, sslog_rdf_type object_type) {
-    list_t *store_list = SSLOG_STORE_CAST(store);
+/**
+ * @brief Gets the oldest snapshot that can be used by readers.
+ * Readers without sections use the published version.
+ * @param store. Store with triples.
+ * @return version of the oldest snapshot.
+ */
+static unsigned long sslog_store_oldest_snapshot(sslog_store_t *store)
+{
+    SSLOG_STORE_READERS_LOCK(store);
 
-    sslog_triple_t *triple_data = sslog_new_triple_detached(subject, predicate, object, subject_type, object_type);
+    unsigned long oldest = store->published;
 
     list_head_t *list_walker = NULL;
-    list_for_each(list_walker, &store_list->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+    list_for_each(list_walker, &store->readers) {
+        sslog_store_reader_t *reader = list_entry(list_walker, sslog_store_reader_t, links);
 
-        if (sslog_compare_triple_with_any(triple_data, triple, SSLOG_TRIPLE_ANY) == true) {
-            sslog_free_triple(triple_data);
-            return triple;
+        if (reader->oldest < oldest) {
+            oldest = reader->oldest;
         }
     }
 
-    sslog_free_triple(triple_data);
-    return NULL;
+    SSLOG_STORE_READERS_UNLOCK(store);
+
+    return oldest;
 }
 
 
-static bool sslog_store_match_templates(sslog_triple_t *triple, list_t *triples_templates)
+/**
+ * @brief Frees removed records and triples that are not seen by any snapshot.
+ * Removed data is listed in the order of versions, so freeing stops on the first newer one.
+ * @param store. Store with triples, locked by the writer.
+ */
+static void sslog_store_reclaim(sslog_store_t *store)
 {
-    list_head_t *list_walker = NULL;
-    list_for_each(list_walker, &triples_templates->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple_template = (sslog_triple_t *) node->data;
+    unsigned long oldest = sslog_store_oldest_snapshot(store);
 
-        if (sslog_compare_triple_with_any(triple, triple_template, SSLOG_TRIPLE_ANY) == true) {
-            return true;
+    while (list_empty(&store->dead_records) == 0) {
+        sslog_store_record_t *record = list_entry(store->dead_records.next, sslog_store_record_t, dead_links);
+        sslog_triple_t *triple = record->triple;
+
+        if (record->died > oldest) {
+            break;
         }
+
+        sslog_store_unlink_record(store, record);
+        sslog_free_triple_force(triple);
     }
 
-    return false;
-}
+    while (list_empty(&store->garbage) == 0) {
+        sslog_store_garbage_t *garbage = list_entry(store->garbage.next, sslog_store_garbage_t, links);
 
+        if (garbage->died > oldest) {
+            break;
+        }
 
-int sslog_store_update_triples(sslog_store_t *store, list_t *current_triples, list_t *new_triples)
-{
-    sslog_store_remove_triples(store, current_triples);
-    sslog_store_add_triples(store, new_triples);
+        if (garbage->triple != NULL) {
+            sslog_free_triple_force(garbage->triple);
+        } else if (store->segment != NULL && store->segment->triples != NULL) {
+            sslog_free_triple_force(store->segment->triples[garbage->row]);
+            store->segment->triples[garbage->row] = NULL;
+        }
 
-    return SSLOG_ERROR_NO;
-}
+        list_del(&garbage->links);
+        free(garbage);
+    }
 
+    store->reclaimed = oldest;
+}
 
 
-int sslog_store_add_triples(sslog_store_t *store, list_t *triples)
+/**
+ * @brief Checks that the triple element has a value (it is not the 'any' value).
+ * @param value. Value of the triple element.
+ * @return true if value is bound or false otherwise.
+ */
+static bool sslog_store_is_bound(const char *value)
 {
-    list_t *list = SSLOG_STORE_CAST(store);
-
-    int unstored_count = 0;
+    return (strcmp(value, SSLOG_TRIPLE_ANY) == 0) ? false : true;
+}
 
-    list_head_t *list_walker = NULL;
-    list_for_each(list_walker, &triples->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *new_triple = (sslog_triple_t *) node->data;
 
-        if (sslog_triple_is_stored(new_triple) == true) {
-            continue;
-        }
+static int sslog_store_matches_add(sslog_store_matches_t *matches, sslog_store_record_t *record,
+                                   uint32_t row, unsigned long order)
+{
+    if (matches->count == matches->capacity) {
+        int new_capacity = (matches->capacity == 0) ? SSLOG_STORE_MATCHES_INITIAL_CAPACITY : matches->capacity * 2;
+        sslog_store_match_t *new_records = (sslog_store_match_t *) realloc(matches->records,
+                                                                            new_capacity * sizeof(sslog_store_match_t));
 
-        if (sslog_triple_is_template(new_triple) == true) {
-            ++unstored_count;
-            continue;
+        if (new_records == NULL) {
+            return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
         }
 
-//        list_t *founded_node = list_get_node_with_equals(list, new_triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
+        matches->records = new_records;
+        matches->capacity = new_capacity;
+    }
 
-//        if (founded_node == NULL) {
-//            list_add_data(list, new_triple);
-//            sslog_triple_stored(new_triple, true);
-//        } else {
-//            sslog_internal_triple_t *old_triple = (sslog_internal_triple_t *) founded_node->data;
+    sslog_store_match_t *match = &matches->records[matches->count++];
 
-//            if (old_triple->linked_entity != NULL) {
-//                sslog_entity_set_link(old_triple->linked_entity, sslog_triple_as_internal(new_triple));
-//                old_triple->linked_entity = NULL;
-//            }
+    match->record = record;
+    match->row = row;
+    match->order = order;
 
-//            founded_node->data = node->data;
-//            sslog_free_triple_force((sslog_triple_t *)old_triple);
-//            sslog_triple_stored(new_triple, true);
-//        }
+    return SSLOG_ERROR_NO;
+}
 
-        if (sslog_store_exists(list, new_triple) != true) {
-            list_add_data(list, new_triple);
-            sslog_triple_stored(new_triple, true);
-        } else {
-            ++unstored_count;
-        }
 
-        //sslog_triple_t *old_triple = (founded_node == NULL) ? NULL : (sslog_triple_t *) founded_node->data;
+/**
+ * @brief Compares records to sort them in the store order (newest first).
+ */
+static int sslog_store_compare_records(const void *a, const void *b)
+{
+    const sslog_store_match_t *match_a = (const sslog_store_match_t *) a;
+    const sslog_store_match_t *match_b = (const sslog_store_match_t *) b;
 
-        // The store already has a triple (old-triple) with same data of new-triple:
-        // - checks: new and old triple are different pointers;
-        // - make a link from node (triples list) to old-triple;
-        // - remove new-triple.
-        // If the new-triple is not in the store then add it.
-        //if ((old_triple != NULL) && (old_triple != new_triple)) {
-           // node->data = old_triple;
-           // sslog_free_triple(new_triple);
-       // } else {
-//            list_add_data(list, new_triple);
-        //}
+    if (match_a->order == match_b->order) {
+        return 0;
     }
 
-    SSLOG_DEBUG_FUNC("Stored triples: %i", list_count(list));
-
-    return unstored_count;
+    return (match_a->order > match_b->order) ? -1 : 1;
 }
 
 
-
-int sslog_store_add_triples_with_replace(sslog_store_t *store, list_t *triples)
+/**
+ * @brief Matches the record with the compiled template.
+ * Values of records are keys of indexes, so bound elements are compared
+ * by keys without comparing strings, types are compared for bound elements only.
+ * @param record. Record to match.
+ * @param keys. Keys of bound elements of the template, NULL for not bound elements.
+ * @param triple_template. Template with types.
+ * @param snapshot. Version of the snapshot, records out of it are not matched.
+ * @return true if the record is matched, false otherwise.
+ */
+static bool sslog_store_match_record(sslog_store_record_t *record, sslog_store_key_t *keys[SSLOG_STORE_FIELDS_COUNT],
+                                     sslog_triple_t *triple_template, unsigned long snapshot)
 {
-    list_t *list = SSLOG_STORE_CAST(store);
-
-    list_head_t *list_walker = NULL;
-    list_for_each(list_walker, &triples->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *new_triple = (sslog_triple_t *) node->data;
+    if (sslog_store_record_is_visible(record, snapshot) == false) {
+        return false;
+    }
 
-        if (sslog_triple_is_stored(new_triple) == true) {
-            continue;
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        if (keys[field] != NULL && record->keys[field] != keys[field]) {
+            return false;
         }
+    }
 
-        if (sslog_triple_is_template(new_triple) == true) {
-            continue;
-        }
+    if (keys[SSLOG_STORE_FIELD_SUBJECT] != NULL
+            && record->triple->subject_type != triple_template->subject_type) {
+        return false;
+    }
 
-        list_t *founded_node = list_get_node_with_equals(list, new_triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
+    if (keys[SSLOG_STORE_FIELD_OBJECT] != NULL
+            && record->triple->object_type != triple_template->object_type) {
+        return false;
+    }
 
-        if (founded_node == NULL) {
-            list_add_data(list, new_triple);
-            sslog_triple_stored(new_triple, true);
-        } else {
-            sslog_internal_triple_t *old_triple = (sslog_internal_triple_t *) founded_node->data;
+    return true;
+}
 
-            if (old_triple->linked_entity != NULL) {
-                sslog_entity_set_link(old_triple->linked_entity, sslog_triple_as_internal(new_triple));
-                old_triple->linked_entity = NULL;
-            }
 
-            founded_node->data = node->data;
-            sslog_free_triple_force((sslog_triple_t *)old_triple);
-            sslog_triple_stored(new_triple, true);
+/**
+ * @brief Matches the row of the segment with the compiled template.
+ * @param row. Row to match.
+ * @param terms. Terms of bound elements of the template, -1 for not bound elements.
+ * @param triple_template. Template with types.
+ * @return true if the row is matched, false otherwise.
+ */
+static bool sslog_store_match_row(const sslog_store_segment_row_t *row, long terms[SSLOG_STORE_FIELDS_COUNT],
+                                  sslog_triple_t *triple_template)
+{
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        if (terms[field] >= 0 && row->terms[field] != (uint32_t) terms[field]) {
+            return false;
         }
+    }
 
-//        if (sslog_store_exists(list, new_triple) != true) {
-//            list_add_data(list, new_triple);
-//            sslog_triple_stored(new_triple, true);
-//        }
-
-        //sslog_triple_t *old_triple = (founded_node == NULL) ? NULL : (sslog_triple_t *) founded_node->data;
-
-        // The store already has a triple (old-triple) with same data of new-triple:
-        // - checks: new and old triple are different pointers;
-        // - make a link from node (triples list) to old-triple;
-        // - remove new-triple.
-        // If the new-triple is not in the store then add it.
-        //if ((old_triple != NULL) && (old_triple != new_triple)) {
-           // node->data = old_triple;
-           // sslog_free_triple(new_triple);
-       // } else {
-//            list_add_data(list, new_triple);
-        //}
+    if (terms[SSLOG_STORE_FIELD_SUBJECT] >= 0 && row->subject_type != triple_template->subject_type) {
+        return false;
     }
 
-    SSLOG_DEBUG_FUNC("Stored triples: %i", list_count(list));
+    if (terms[SSLOG_STORE_FIELD_OBJECT] >= 0 && row->object_type != triple_template->object_type) {
+        return false;
+    }
 
-    return SSLOG_ERROR_NO;
+    return true;
 }
 
 
+/**
+ * @brief Gets a triple of the founded record or row.
+ * The row of the segment is materialized to the triple.
+ * @param store. Store with triples.
+ * @param match. Founded record or row.
+ * @return triple on success or NULL otherwise.
+ */
+static sslog_triple_t *sslog_store_match_triple(sslog_store_t *store, sslog_store_match_t *match)
+{
+    if (match->record != NULL) {
+        return match->record->triple;
+    }
 
-int sslog_store_remove_triples(sslog_store_t *store, list_t *triples_templates)
+    return sslog_store_segment_get_triple(store->segment, match->row);
+}
+
+
+/**
+ * @brief Finds rows of the segment that are matched to the template.
+ * Rows are added from the newest to the oldest one.
+ * @param store. Store with triples.
+ * @param triple_template. Template to match.
+ * @param max_triples_count. Maximum number of rows, negative value - no limits.
+ * @param snapshot. Version of the snapshot.
+ * @param matches. Founded rows.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_match_segment(sslog_store_t *store, sslog_triple_t *triple_template,
+                                     int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches)
 {
-    if (list_is_empty(triples_templates) == true) {
-        SSLOG_DEBUG_FUNC("Not riples templates.");
+    sslog_store_segment_t *segment = store->segment;
+
+    // Rows that are removed after the snapshot are not counted as live.
+    if (segment == NULL || (segment->live_count == 0 && snapshot == SSLOG_STORE_LATEST)
+            || segment->born > snapshot || max_triples_count == 0) {
         return SSLOG_ERROR_NO;
     }
 
-    list_t *list_store = SSLOG_STORE_CAST(store);
+    const char *values[SSLOG_STORE_FIELDS_COUNT];
+    long terms[SSLOG_STORE_FIELDS_COUNT];
 
-    list_head_t *current_position = NULL;
-    list_head_t *list_walker = NULL;
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        const char *value = sslog_store_field_value(triple_template, (sslog_store_field) field);
+        values[field] = (sslog_store_is_bound(value) == true) ? value : NULL;
+    }
 
-    list_for_each_safe(list_walker, current_position, &list_store->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+    int order_field = -1;
+    uint32_t begin = 0;
+    uint32_t end = 0;
 
-        if (sslog_store_match_templates(triple, triples_templates) == true) {
+    if (sslog_store_segment_plan(segment, values, terms, &order_field, &begin, &end) != true) {
+        return SSLOG_ERROR_NO;
+    }
 
-            // Check is the list with templates contain a fouded triple.
-            if (list_has_data(triples_templates, triple) == 1 ) {
-                sslog_triple_stored(triple, false);
-                sslog_free_entity(sslog_triple_as_internal(triple)->linked_entity);
-                sslog_triple_as_internal(triple)->linked_entity = NULL;
-                list_del_and_free_node(node, NULL);
-            } else {
-                list_del_and_free_node(node, SSLOG_FREE_FUNC_CAST sslog_free_triple_force);
-            }
+    int counter = 0;
+
+    for (uint32_t position = end; position > begin; --position) {
+        uint32_t row = sslog_store_segment_row_at(segment, order_field, position - 1);
+
+        if (sslog_store_segment_is_visible(segment, row, snapshot) == false) {
+            continue;
         }
 
-//        list_t *founded_node = list_get_node_with_equals(list_store, remove_triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
+        if (sslog_store_match_row(&segment->rows[row], terms, triple_template) != true) {
+            continue;
+        }
 
-//        sslog_triple_stored(founded_node->data, true);
+        int result = sslog_store_matches_add(matches, NULL, row, row);
 
-        // If the pointers of triples are the same,
-        // then detach a triple (remove from internal store only).
-        // If poiters are different (only triples data are same),
-        // then remove node from list and free triple.
-//        if (founded_node->data == remove_triple) {
-//            list_del_and_free_node(node, NULL);
-//        } else {
-//            list_del_and_free_node(node, LIST_CAST_TO_FREE_FUNC sslog_free);
-//        }
-    }
+        if (result != SSLOG_ERROR_NO) {
+            return result;
+        }
 
-    SSLOG_DEBUG_FUNC("Stored triples: %i", list_count(list_store));
+        if (max_triples_count > 0 && ++counter >= max_triples_count) {
+            break;
+        }
+    }
 
     return SSLOG_ERROR_NO;
 }
 
 
+/**
+ * @brief Finds records that are matched to the template.
+ *
+ * Uses the key of the most selective bound element of the template,
+ * if there are no bound elements, then all store is scanned.
+ * If some bound element has no key, then there are no such records.
+ * Fully bound template can be matched to one triple only, so searching stops on the first one.
+ * Records are added in the store order, then rows of the segment (they are older).
+ *
+ * @param store. Store with triples.
+ * @param triple_template. Template to match.
+ * @param max_triples_count. Maximum number of records, negative value - no limits.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for the writer.
+ * @param matches. Founded records.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_match_template(sslog_store_t *store, sslog_triple_t *triple_template,
+                                      int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches)
+{
+    if (triple_template == NULL) {
+        return SSLOG_ERROR_NO;
+    }
 
+    int filter_result = sslog_store_filter_template(store, triple_template);
 
+    if (filter_result == 0) {
+        return SSLOG_ERROR_NO;
+    }
 
-int sslog_store_update_triples_old(sslog_store_t *store, list_t *current_triples, list_t *new_triples)
-{
-    list_t *list_store = SSLOG_STORE_CAST(store);
+    int matches_count = matches->count;
 
-    list_t *insert_triples = list_new();
+    // Template is compiled to keys of bound elements, records are matched by keys.
+    sslog_store_key_t *keys[SSLOG_STORE_FIELDS_COUNT] = { NULL, NULL, NULL };
+    sslog_store_key_t *best_key = NULL;
+    sslog_store_field best_field = SSLOG_STORE_FIELD_SUBJECT;
+    int bound_count = 0;
+    bool has_records = true;
 
-    list_head_t *current_position = NULL;
-    list_head_t *list_walker = NULL;
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        const char *value = sslog_store_field_value(triple_template, (sslog_store_field) field);
 
-    list_for_each_safe(list_walker, current_position, &current_triples->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *remove_triple = (sslog_triple_t *) node->data;
+        if (sslog_store_is_bound(value) == false) {
+            continue;
+        }
 
-        list_t *founded_node = list_get_node_with_equals(list_store, remove_triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
+        ++bound_count;
 
-        sslog_triple_stored((sslog_triple_t *) founded_node->data, true);
+        sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[field], value);
+        keys[field] = key;
 
-        // If the pointers of triples are the same,
-        // then detach a triple (remove from internal store only).
-        // If poiters are different (only triples data are same),
-        // then remove node from list and free triple.
-        if (founded_node->data == remove_triple) {
-            list_del_and_free_node(node, NULL);
-        } else {
-            //TODO: was free_triple
-            list_del_and_free_node(node, LIST_CAST_TO_FREE_FUNC sslog_free);
+        if (key == NULL) {
+            has_records = false;
+            continue;
         }
-    }
-
-    list_walker = NULL;
-    list_for_each(list_walker, &new_triples->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
 
-        if (list_has_data_with_equals(list_store, triple,
-                                      LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples) != true) {
-            list_add_data(insert_triples, triple);
+        if (best_key == NULL || key->count < best_key->count) {
+            best_key = key;
+            best_field = (sslog_store_field) field;
         }
     }
 
+    if (bound_count == SSLOG_STORE_FIELDS_COUNT) {
+        max_triples_count = 1;
+    }
 
+    list_head_t *records_head = (best_key == NULL) ? &store->records : &best_key->records;
+    int counter = 0;
 
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, records_head) {
+        if (has_records == false) {
+            break;
+        }
 
-    return 0;
-}
-
+        sslog_store_record_t *record = (best_key == NULL) ?
+                    list_entry(list_walker, sslog_store_record_t, store_links)
+                  : sslog_store_record_from_links(list_walker, best_field);
 
+        if (sslog_store_match_record(record, keys, triple_template, snapshot) != true) {
+            continue;
+        }
 
-bool sslog_store_exists(sslog_store_t *store, sslog_triple_t *triple)
-{
-    list_t *list_store = SSLOG_STORE_CAST(store);
+        // Subject of the found record is used now, it is evicted last.
+        sslog_store_touch_key(store, record->keys[SSLOG_STORE_FIELD_SUBJECT]);
 
-    return list_has_data_with_equals(list_store, triple, LIST_CAST_TO_EQUAL_BOOL_FUNC sslog_equal_triples);
-}
+        int result = sslog_store_matches_add(matches, record, 0, sslog_store_record_order(store, record));
 
+        if (result != SSLOG_ERROR_NO) {
+            return result;
+        }
 
-bool sslog_store_exists_template_data(sslog_store_t *store, const char *subject, const char *predicate, const char *object,
-                                               sslog_rdf_type subject_type, sslog_rdf_type object_type)
-{
-	sslog_triple_t *triple = sslog_store_get_triple_by_data(store, subject, predicate, object, subject_type, object_type);
+        if (max_triples_count > 0 && ++counter >= max_triples_count) {
+            return SSLOG_ERROR_NO;
+        }
+    }
 
-	return (triple == NULL) ? false : true;
-}
+    int rows_count = (max_triples_count > 0) ? max_triples_count - counter : -1;
 
+    int result = sslog_store_match_segment(store, triple_template, rows_count, snapshot, matches);
 
-bool sslog_store_exists_pointer(sslog_store_t *store, sslog_triple_t *triple)
-{
-    list_t *list_store = SSLOG_STORE_CAST(store);
+    // Filter is checked for the subject or the pair, so without the object
+    // an empty result means that the filter is wrong.
+    if (filter_result > 0 && matches->count == matches_count
+            && sslog_store_is_bound(triple_template->object) == false) {
+        sslog_store_count(store->filter.false_positives);
+    }
 
-    return list_has_data_with_equals(list_store, triple, NULL);
+    return result;
 }
 
 
-list_t *sslog_store_query_triples(sslog_store_t *store, list_t *triples_templates)
+/**
+ * @brief Finds records that are matched to any of templates.
+ *
+ * Each template is matched separately, then results are united
+ * in the store order without duplicates. Each template gives no more than
+ * max_triples_count records, it is enough to get first max_triples_count records of union.
+ *
+ * @param store. Store with triples.
+ * @param triples_templates. Templates to match.
+ * @param max_triples_count. Maximum number of records, negative value - no limits.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for the writer.
+ * @param matches. Founded records.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_match_templates(sslog_store_t *store, list_t *triples_templates,
+                                       int max_triples_count, unsigned long snapshot, sslog_store_matches_t *matches)
 {
-    list_t *list_store = SSLOG_STORE_CAST(store);
-
-    list_t *query_triples = list_new();
+    int templates_count = 0;
 
     list_head_t *list_walker = NULL;
-
-    list_for_each(list_walker, &list_store->links) {
+    list_for_each(list_walker, &triples_templates->links) {
         list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
 
-        if (sslog_store_match_templates(triple, triples_templates) == true) {
-            list_add_data(query_triples, triple);
+        int result = sslog_store_match_template(store, (sslog_triple_t *) node->data, max_triples_count, snapshot, matches);
+
+        if (result != SSLOG_ERROR_NO) {
+            return result;
         }
+
+        ++templates_count;
     }
 
-    SSLOG_DEBUG_FUNC("Stored triples: %i", list_count(list_store));
+    if (templates_count > 1) {
+        sslog_store_matches_unique(matches);
+    }
 
-    return query_triples;
-}
+    if (max_triples_count > 0 && matches->count > max_triples_count) {
+        matches->count = max_triples_count;
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+/**
+ * @brief Sorts found records in the store order and removes duplicates.
+ * @param matches. Found records.
+ */
+static void sslog_store_matches_unique(sslog_store_matches_t *matches)
+{
+    if (matches->count < 2) {
+        return;
+    }
+
+    qsort(matches->records, matches->count, sizeof(sslog_store_match_t), sslog_store_compare_records);
+
+    int unique_count = 1;
+
+    for (int i = 1; i < matches->count; ++i) {
+        if (matches->records[i].order != matches->records[unique_count - 1].order) {
+            matches->records[unique_count++] = matches->records[i];
+        }
+    }
+
+    matches->count = unique_count;
+}
+
+
+static list_t *sslog_store_matches_to_list(sslog_store_t *store, sslog_store_matches_t *matches)
+{
+    list_t *query_triples = list_new();
+
+    for (int i = 0; i < matches->count; ++i) {
+        sslog_triple_t *triple = sslog_store_match_triple(store, &matches->records[i]);
+
+        if (triple != NULL) {
+            list_add_data(query_triples, triple);
+        }
+    }
+
+    return query_triples;
+}
+
+
+/**
+ * @brief Finds a record with the same triple data.
+ * @param store. Store with triples.
+ * @param triple. Triple to find.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for the writer.
+ * @return record on success or NULL if there is no such triple.
+ */
+static sslog_store_record_t *sslog_store_find_equal(sslog_store_t *store, sslog_triple_t *triple, unsigned long snapshot)
+{
+    sslog_store_key_t *keys[SSLOG_STORE_FIELDS_COUNT];
+    sslog_store_key_t *best_key = NULL;
+    sslog_store_field best_field = SSLOG_STORE_FIELD_SUBJECT;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[field],
+                                                           sslog_store_field_value(triple, (sslog_store_field) field));
+        keys[field] = key;
+
+        if (key == NULL) {
+            return NULL;
+        }
+
+        if (best_key == NULL || key->count < best_key->count) {
+            best_key = key;
+            best_field = (sslog_store_field) field;
+        }
+    }
+
+    // All elements are bound, so the record is equal if it has same keys and types.
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &best_key->records) {
+        sslog_store_record_t *record = sslog_store_record_from_links(list_walker, best_field);
+
+        if (sslog_store_match_record(record, keys, triple, snapshot) == true) {
+            return record;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Finds a row of the segment with the same triple data in the snapshot.
+ * @param store. Store with triples.
+ * @param triple. Triple to find.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for not removed rows.
+ * @return row on success or -1 if there is no such triple.
+ */
+static long sslog_store_find_row(sslog_store_t *store, sslog_triple_t *triple, unsigned long snapshot)
+{
+    sslog_store_segment_t *segment = store->segment;
+
+    if (segment == NULL || (segment->live_count == 0 && snapshot == SSLOG_STORE_LATEST) || segment->born > snapshot) {
+        return -1;
+    }
+
+    return sslog_store_segment_find_row(segment, triple, snapshot);
+}
+
+
+/**
+ * @brief Finds a stored triple (record or row) with the same triple data in the latest data.
+ * @param store. Store with triples.
+ * @param triple. Triple to find.
+ * @return stored triple on success or NULL if there is no such triple.
+ */
+static sslog_triple_t *sslog_store_find_stored(sslog_store_t *store, sslog_triple_t *triple)
+{
+    if (sslog_store_filter_template(store, triple) == 0) {
+        return NULL;
+    }
+
+    sslog_store_record_t *record = sslog_store_find_equal(store, triple, SSLOG_STORE_LATEST);
+
+    if (record != NULL) {
+        return record->triple;
+    }
+
+    long row = sslog_store_find_row(store, triple, SSLOG_STORE_LATEST);
+
+    return (row < 0) ? NULL : sslog_store_segment_get_triple(store->segment, (uint32_t) row);
+}
+
+
+/**
+ * @brief Adds the triple to the store and indexes.
+ * Function does not check that the same triple is already stored.
+ * @param store. Store with triples.
+ * @param triple. Triple to add.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_insert(sslog_store_t *store, sslog_triple_t *triple)
+{
+    sslog_store_record_t *record = (sslog_store_record_t *) malloc(sizeof(sslog_store_record_t));
+
+    if (record == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    record->triple = triple;
+    record->sequence = store->sequence++;
+    record->died = 0;
+    INIT_LIST_HEAD(&record->dead_links);
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        record->keys[field] = NULL;
+        INIT_LIST_HEAD(&record->field_links[field]);
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        int result = sslog_store_index_insert(&store->indexes[field], record);
+
+        if (result != SSLOG_ERROR_NO) {
+            for (int i = 0; i < field; ++i) {
+                sslog_store_index_remove(&store->indexes[i], record);
+            }
+
+            free(record);
+            return result;
+        }
+    }
+
+    list_add(&record->store_links, &store->records);
+    ++store->triples_count;
+
+    store->memory_size += sslog_store_record_size(triple);
+    sslog_store_filter_values(&store->filter, triple);
+    sslog_store_touch_key(store, record->keys[SSLOG_STORE_FIELD_SUBJECT]);
+    record->born = ++store->version;
+    record->keys[SSLOG_STORE_FIELD_SUBJECT]->generation = record->born;
+
+    sslog_triple_as_internal(triple)->store_record = record;
+    sslog_triple_stored(triple, true);
+
+    return SSLOG_ERROR_NO;
+}
+
+
+/**
+ * @brief Marks the record as removed.
+ * The record stays in the store for older snapshots, it is freed
+ * with its triple when there are no such snapshots (see sslog_store_reclaim).
+ * @param store. Store with triples.
+ * @param record. Record to remove.
+ */
+static void sslog_store_delete_record(sslog_store_t *store, sslog_store_record_t *record)
+{
+    record->died = ++store->version;
+    record->keys[SSLOG_STORE_FIELD_SUBJECT]->generation = record->died;
+
+    list_add_tail(&record->dead_links, &store->dead_records);
+    --store->triples_count;
+
+    store->memory_size -= sslog_store_record_size(record->triple);
+    store->filter.removed_count += 2;
+}
+
+
+/**
+ * @brief Removes the record from the store and indexes and frees it.
+ * The triple of the record is not freed.
+ * @param store. Store with triples.
+ * @param record. Removed record (see sslog_store_delete_record).
+ */
+static void sslog_store_unlink_record(sslog_store_t *store, sslog_store_record_t *record)
+{
+    sslog_store_key_t *subject_key = record->keys[SSLOG_STORE_FIELD_SUBJECT];
+
+    // The key is freed with the last record, the generation of the subject
+    // must not go back, so subjects without keys get the last such generation.
+    if (subject_key->count == 1 && subject_key->pins == 0 && subject_key->generation > store->removed_generation) {
+        store->removed_generation = subject_key->generation;
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        sslog_store_index_remove(&store->indexes[field], record);
+    }
+
+    list_del(&record->store_links);
+    list_del(&record->dead_links);
+
+    if (sslog_triple_as_internal(record->triple)->store_record == record) {
+        sslog_triple_as_internal(record->triple)->store_record = NULL;
+    }
+
+    free(record);
+}
+
+
+/**
+ * @brief Keeps the removed triple until there are no snapshots that can see it.
+ * Without memory the triple is freed now.
+ * @param store. Store with triples.
+ * @param triple. Replaced triple or NULL for the materialized triple of the row.
+ * @param row. Removed row of the segment (if the triple is NULL).
+ */
+static void sslog_store_retire(sslog_store_t *store, sslog_triple_t *triple, uint32_t row)
+{
+    sslog_store_garbage_t *garbage = (sslog_store_garbage_t *) malloc(sizeof(sslog_store_garbage_t));
+
+    if (garbage == NULL) {
+        // The triple of the row is freed with the segment.
+        sslog_free_triple_force(triple);
+        return;
+    }
+
+    garbage->triple = triple;
+    garbage->row = row;
+    garbage->died = store->version;
+
+    list_add_tail(&garbage->links, &store->garbage);
+}
+
+
+/**
+ * @brief Detaches the stored triple, the caller owns it after removing.
+ * Readers of older snapshots can use the triple and its entity, so the store keeps
+ * a copy of the triple with the entity. Without memory for the copy the entity is freed now.
+ * @param triple. Stored triple.
+ * @return copy of the triple on success or NULL otherwise.
+ */
+static sslog_triple_t *sslog_store_detach_triple(sslog_triple_t *triple)
+{
+    sslog_internal_triple_t *internal_triple = sslog_triple_as_internal(triple);
+    sslog_triple_t *copy = sslog_triple_copy(triple);
+
+    if (copy != NULL) {
+        sslog_triple_stored(copy, true);
+
+        if (internal_triple->linked_entity != NULL) {
+            sslog_entity_set_link(internal_triple->linked_entity, sslog_triple_as_internal(copy));
+        }
+    } else {
+        sslog_free_entity(internal_triple->linked_entity);
+    }
+
+    internal_triple->linked_entity = NULL;
+    internal_triple->store_record = NULL;
+    sslog_triple_stored(triple, false);
+
+    return copy;
+}
+
+
+/**
+ * @brief Prepares the segment for deleting matches.
+ * Marks of removed rows are allocated on the first removing of rows,
+ * it is done before any changes, so deleting is not failed in the middle.
+ * @param store. Store with triples.
+ * @param matches. Found records and rows, NULL if a row is deleted.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_prepare_deleting(sslog_store_t *store, sslog_store_matches_t *matches)
+{
+    if (store->segment == NULL || store->segment->removed != NULL) {
+        return SSLOG_ERROR_NO;
+    }
+
+    bool has_rows = (matches == NULL) ? true : false;
+
+    for (int i = 0; matches != NULL && i < matches->count && has_rows == false; ++i) {
+        has_rows = (matches->records[i].record == NULL) ? true : false;
+    }
+
+    return (has_rows == true) ? sslog_store_segment_init_removed(store->segment) : SSLOG_ERROR_NO;
+}
+
+
+/**
+ * @brief Removes the row from the segment, the segment must be prepared.
+ * Subjects of rows have no keys, so the removing changes generation of all such subjects.
+ * Materialized triple of the row is freed when there are no snapshots that can see it.
+ * @see sslog_store_prepare_deleting
+ * @param store. Store with triples.
+ * @param row. Row to remove.
+ */
+static void sslog_store_delete_row(sslog_store_t *store, uint32_t row)
+{
+    sslog_store_segment_remove_row(store->segment, row, ++store->version);
+
+    store->removed_generation = store->version;
+    store->filter.removed_count += 2;
+
+    sslog_store_retire(store, NULL, row);
+}
+
+
+
+static list_t *sslog_store_query_data(sslog_store_t *store,
+                                      const char *subject, const char *predicate, const char *object,
+                                      sslog_rdf_type subject_type, sslog_rdf_type object_type,
+                                      int max_triples_count, unsigned long snapshot)
+{
+    if (max_triples_count == 0
+            || subject == NULL || predicate == NULL || object == NULL) {
+        return list_new();
+    }
+
+    sslog_triple_t triple_template = { (char *) subject, (char *) predicate, (char *) object, subject_type, object_type };
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    sslog_store_match_template(store, &triple_template, max_triples_count, snapshot, &matches);
+
+    list_t *query_triples = sslog_store_matches_to_list(store, &matches);
+
+    free(matches.records);
+
+    return query_triples;
+}
+
+
+static sslog_triple_t *sslog_store_find_rdftype(sslog_store_t *store, const char *uri, unsigned long snapshot)
+{
+    if (uri == NULL) {
+        return NULL;
+    }
+
+    sslog_triple_t triple_template = { (char *) uri, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_ANY,
+                                       SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI };
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    sslog_store_match_template(store, &triple_template, 1, snapshot, &matches);
+
+    sslog_triple_t *triple = (matches.count == 0) ? NULL : sslog_store_match_triple(store, &matches.records[0]);
+
+    free(matches.records);
+
+    return triple;
+}
+
+
+static int sslog_store_insert_triples(sslog_store_t *store, list_t *triples)
+{
+    int unstored_count = 0;
+    int changes_count = 0;
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &triples->links) {
+        list_t *node = list_entry(list_walker, list_t, links);
+        sslog_triple_t *new_triple = (sslog_triple_t *) node->data;
+
+        if (sslog_triple_is_stored(new_triple) == true) {
+            continue;
+        }
+
+        if (sslog_triple_is_template(new_triple) == true) {
+            ++unstored_count;
+            continue;
+        }
+
+        if (sslog_store_find_equal(store, new_triple, SSLOG_STORE_LATEST) != NULL
+                || sslog_store_find_row(store, new_triple, SSLOG_STORE_LATEST) >= 0
+                || sslog_store_insert(store, new_triple) != SSLOG_ERROR_NO) {
+            ++unstored_count;
+        }
+
+        sslog_store_yield(store, &changes_count);
+    }
+
+    SSLOG_DEBUG_FUNC("Stored triples: %i", store->triples_count);
+
+    return unstored_count;
+}
+
+
+static int sslog_store_delete_triples(sslog_store_t *store, list_t *triples_templates)
+{
+    // Records are collected before removing, because removing changes keys of indexes.
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    int result = sslog_store_match_templates(store, triples_templates, -1, SSLOG_STORE_LATEST, &matches);
+
+    if (result != SSLOG_ERROR_NO) {
+        free(matches.records);
+        return result;
+    }
+
+    result = sslog_store_delete_matches(store, &matches, triples_templates);
+
+    free(matches.records);
+
+    SSLOG_DEBUG_FUNC("Stored triples: %i", store->triples_count);
+
+    return result;
+}
+
+
+/**
+ * @brief Removes found records and rows, their triples are freed when
+ * there are no snapshots that can see them.
+ * @param store. Store with triples.
+ * @param matches. Found records without duplicates.
+ * @param triples_templates. Templates that were used to find records, found triples
+ * from this list are detached from the store instead of freeing, NULL if there are no such triples.
+ * @return SSLOG_ERROR_NO on success or error code otherwise (nothing is deleted).
+ */
+static int sslog_store_delete_matches(sslog_store_t *store, sslog_store_matches_t *matches, list_t *triples_templates)
+{
+    int result = sslog_store_prepare_deleting(store, matches);
+
+    if (result != SSLOG_ERROR_NO) {
+        return result;
+    }
+
+    int changes_count = 0;
+
+    for (int i = 0; i < matches->count; ++i) {
+        sslog_store_match_t *match = &matches->records[i];
+        sslog_store_record_t *record = match->record;
+        sslog_triple_t *triple = (record != NULL) ?
+                    record->triple : sslog_store_segment_row_triple(store->segment, match->row);
+
+        // Check is the list with templates contain a fouded triple.
+        // If it is, then detach a triple (remove from internal store only),
+        // the store keeps its copy for older snapshots.
+        bool is_detached = (triple != NULL && triples_templates != NULL
+                            && list_has_data(triples_templates, triple) == 1) ? true : false;
+        sslog_triple_t *copy = (is_detached == true) ? sslog_store_detach_triple(triple) : NULL;
+
+        if (record != NULL) {
+            sslog_store_delete_record(store, record);
+
+            if (is_detached == true && copy == NULL) {
+                sslog_store_unlink_record(store, record);
+            } else if (is_detached == true) {
+                record->triple = copy;
+                sslog_triple_as_internal(copy)->store_record = record;
+            }
+        } else {
+            if (is_detached == true) {
+                store->segment->triples[match->row] = copy;
+            }
+
+            sslog_store_delete_row(store, match->row);
+        }
+
+        sslog_store_yield(store, &changes_count);
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+/**
+ * @brief Finds triples of the individual: triples with the individual as a subject
+ * and triples that link other individuals to it (the individual is an object).
+ * Triples are found with subject and object indexes, templates are not allocated.
+ * @param store. Store with triples.
+ * @param individual. Individual to find triples.
+ * @param matches. Found records, duplicates are possible.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_match_individual(sslog_store_t *store, sslog_individual_t *individual, sslog_store_matches_t *matches)
+{
+    char *uri = individual->entity.uri;
+
+    sslog_triple_t subject_template = { uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY, SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI };
+    sslog_triple_t object_template = { SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY, uri, SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI };
+
+    int result = sslog_store_match_template(store, &subject_template, -1, SSLOG_STORE_LATEST, matches);
+
+    if (result != SSLOG_ERROR_NO) {
+        return result;
+    }
+
+    return sslog_store_match_template(store, &object_template, -1, SSLOG_STORE_LATEST, matches);
+}
+
+
+/**
+ * @brief Estimates memory that is used by the record and its triple.
+ * @param triple. Stored triple.
+ * @return size in bytes.
+ */
+static size_t sslog_store_record_size(sslog_triple_t *triple)
+{
+    return sizeof(sslog_store_record_t) + sizeof(sslog_internal_triple_t)
+            + strlen(triple->subject) + strlen(triple->predicate) + strlen(triple->object) + 3;
+}
+
+
+/**
+ * @brief Compares keys to sort them from the least recently used.
+ */
+static int sslog_store_compare_access(const void *a, const void *b)
+{
+    const sslog_store_key_t *key_a = *(const sslog_store_key_t **) a;
+    const sslog_store_key_t *key_b = *(const sslog_store_key_t **) b;
+
+    unsigned long access_a = sslog_store_key_access(key_a);
+    unsigned long access_b = sslog_store_key_access(key_b);
+
+    if (access_a == access_b) {
+        return 0;
+    }
+
+    return (access_a < access_b) ? -1 : 1;
+}
+
+
+/**
+ * @brief Removes records of the subject.
+ *
+ * Subjects of classes and properties (ontology) are not evicted.
+ * Triples that are linked to entities (rdf:type of individuals) are kept,
+ * so individuals are valid and their properties can be got from the smart space again.
+ * Triples are freed when there are no snapshots that can see them.
+ *
+ * @param store. Store with triples.
+ * @param key. Key of the subject.
+ * @return true if some records are removed, false otherwise.
+ */
+static bool sslog_store_evict_subject(sslog_store_t *store, sslog_store_key_t *key)
+{
+    // Records are collected before removing, the key has removed records too.
+    sslog_store_record_t **records = (sslog_store_record_t **) malloc(key->count * sizeof(sslog_store_record_t *));
+
+    if (records == NULL) {
+        return false;
+    }
+
+    int records_count = 0;
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &key->records) {
+        sslog_store_record_t *record = sslog_store_record_from_links(list_walker, SSLOG_STORE_FIELD_SUBJECT);
+        sslog_entity_t *entity = sslog_triple_as_internal(record->triple)->linked_entity;
+
+        if (record->died != 0) {
+            continue;
+        }
+
+        if (entity != NULL && entity->type != SSLOG_ENTITY_INDIVIDUAL) {
+            free(records);
+            return false;
+        }
+
+        records[records_count++] = record;
+    }
+
+    bool is_evicted = false;
+
+    for (int i = 0; i < records_count; ++i) {
+        if (sslog_triple_as_internal(records[i]->triple)->linked_entity != NULL) {
+            continue;
+        }
+
+        sslog_store_delete_record(store, records[i]);
+
+        is_evicted = true;
+    }
+
+    free(records);
+
+    // Key is kept by linked records, so evicted individuals can be got again.
+    if (is_evicted == true) {
+        key->is_evicted = true;
+    }
+
+    return is_evicted;
+}
+
+
+/**
+ * @brief Evicts least recently used subjects, if the store exceeds the memory limit.
+ *
+ * Subjects are evicted until the store uses SSLOG_STORE_EVICTION_TARGET_PERCENT
+ * of the limit, so eviction is not done on each change.
+ * Pinned subjects and subjects that are used by the current operation are not evicted.
+ *
+ * @param store. Store with triples.
+ * @param since_clock. Store clock at the start of the current operation.
+ */
+static void sslog_store_evict(sslog_store_t *store, unsigned long since_clock)
+{
+    if (store->memory_limit == 0 || store->memory_size <= store->memory_limit) {
+        return;
+    }
+
+    sslog_store_index_t *index = &store->indexes[SSLOG_STORE_FIELD_SUBJECT];
+    sslog_store_key_t **keys = (sslog_store_key_t **) malloc((index->keys_count + 1) * sizeof(sslog_store_key_t *));
+
+    if (keys == NULL) {
+        return;
+    }
+
+    int keys_count = 0;
+
+    for (int bucket = 0; bucket < index->buckets_count; ++bucket) {
+        for (sslog_store_key_t *key = index->buckets[bucket]; key != NULL; key = key->next) {
+            if (key->count > 0 && key->pins == 0 && sslog_store_key_access(key) <= since_clock) {
+                keys[keys_count++] = key;
+            }
+        }
+    }
+
+    qsort(keys, keys_count, sizeof(sslog_store_key_t *), sslog_store_compare_access);
+
+    size_t target_size = store->memory_limit / 100 * SSLOG_STORE_EVICTION_TARGET_PERCENT;
+
+    int changes_count = 0;
+
+    for (int i = 0; i < keys_count && store->memory_size > target_size; ++i) {
+        if (sslog_store_evict_subject(store, keys[i]) == true) {
+            ++store->evicted_count;
+        }
+
+        sslog_store_yield(store, &changes_count);
+    }
+
+    free(keys);
+
+    SSLOG_DEBUG_FUNC("Evicted subjects: %lu, stored triples: %i", store->evicted_count, store->triples_count);
+}
+
+
+
+/**
+ * @brief Adds the subject and the pair (subject, predicate) of the triple to the filter.
+ * @param filter. Filter to update.
+ * @param triple. Stored triple.
+ */
+static void sslog_store_filter_values(sslog_store_filter_t *filter, sslog_triple_t *triple)
+{
+    sslog_store_filter_add(filter, sslog_store_filter_hash(triple->subject, NULL));
+    sslog_store_filter_add(filter, sslog_store_filter_hash(triple->subject, triple->predicate));
+}
+
+
+/**
+ * @brief Checks the template with the filter of the store.
+ * The pair (subject, predicate) is checked if the predicate is set, the subject otherwise.
+ * @param store. Store with triples.
+ * @param triple_template. Template or triple to check.
+ * @return 0 if the store has no such triples, 1 if it can have them,
+ * -1 if the template is not checked (the subject is not set).
+ */
+static int sslog_store_filter_template(sslog_store_t *store, sslog_triple_t *triple_template)
+{
+    if (sslog_store_is_bound(triple_template->subject) == false) {
+        return -1;
+    }
+
+    const char *predicate = (sslog_store_is_bound(triple_template->predicate) == true) ?
+                triple_template->predicate : NULL;
+
+    sslog_store_count(store->filter.checks);
+
+    if (sslog_store_filter_check(&store->filter, sslog_store_filter_hash(triple_template->subject, predicate)) == false) {
+        sslog_store_count(store->filter.negatives);
+        return 0;
+    }
+
+    return 1;
+}
+
+
+/**
+ * @brief Rebuilds the filter if many triples are removed or it is overfilled.
+ * @param store. Store with triples.
+ */
+static void sslog_store_update_filter(sslog_store_t *store)
+{
+    if (sslog_store_filter_is_stale(&store->filter) == true) {
+        sslog_store_rebuild_filter(store);
+    }
+}
+
+
+/**
+ * @brief Builds the filter again from records and rows of the segment.
+ * Removed records and rows that are not freed are added too, older snapshots can see them.
+ * If there is no memory for the new filter, then the filter is disabled
+ * (all checks are positive) and it is rebuilt on next changes.
+ * @param store. Store with triples.
+ */
+static void sslog_store_rebuild_filter(sslog_store_t *store)
+{
+    int rows_count = (store->segment == NULL) ? 0 : store->segment->live_count;
+    sslog_store_filter_t filter = store->filter;
+
+    if (sslog_store_filter_init(&filter, 2 * (store->triples_count + rows_count)) != SSLOG_ERROR_NO) {
+        sslog_store_filter_free(&store->filter);
+        return;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &store->records) {
+        sslog_store_record_t *record = list_entry(list_walker, sslog_store_record_t, store_links);
+
+        sslog_store_filter_values(&filter, record->triple);
+    }
+
+    for (uint32_t row = 0; store->segment != NULL && row < store->segment->header->rows_count; ++row) {
+        unsigned long died = (store->segment->removed == NULL) ? 0 : store->segment->removed[row];
+
+        if (died != 0 && died <= store->reclaimed) {
+            continue;
+        }
+
+        sslog_triple_t data;
+        sslog_store_segment_row_data(store->segment, row, &data);
+
+        sslog_store_filter_values(&filter, &data);
+    }
+
+    sslog_store_filter_free(&store->filter);
+
+    store->filter = filter;
+    ++store->filter.rebuilds;
+
+    SSLOG_DEBUG_FUNC("Filter is rebuilt: %i values, %u blocks", filter.values_count, filter.blocks_count);
+}
+
+
+/**
+ * @brief Sets the filter of the empty store from the image of its segment.
+ * Rows are not read, the filter is rebuilt only if it can't be copied.
+ * @param store. Store with the segment and without records.
+ */
+static void sslog_store_load_filter(sslog_store_t *store)
+{
+    const sslog_store_segment_header_t *header = store->segment->header;
+    sslog_store_filter_t filter = store->filter;
+
+    if (header->filter_blocks_count == 0
+            || sslog_store_filter_load(&filter, (const char *) store->segment->data + header->filter_offset,
+                                       header->filter_blocks_count, (int) header->filter_values_count) != SSLOG_ERROR_NO) {
+        sslog_store_rebuild_filter(store);
+        return;
+    }
+
+    sslog_store_filter_free(&store->filter);
+
+    store->filter = filter;
+}
+
+
+
+sslog_store_t* repo_new()
+{
+    return sslog_store_new();
+}
+
+
+sslog_store_t *sslog_store_new()
+{
+    sslog_store_t *store = (sslog_store_t *) malloc(sizeof(sslog_store_t));
+
+    if (store == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    INIT_LIST_HEAD(&store->records);
+    store->triples_count = 0;
+    store->sequence = 0;
+    store->segment = NULL;
+    store->ontology = NULL;
+    store->memory_size = 0;
+    store->memory_limit = 0;
+    store->clock = 0;
+    store->evicted_count = 0;
+    store->version = 0;
+    store->published = 0;
+    store->reclaimed = 0;
+    store->removed_generation = 0;
+    INIT_LIST_HEAD(&store->dead_records);
+    INIT_LIST_HEAD(&store->garbage);
+    INIT_LIST_HEAD(&store->readers);
+    store->exclusive_count = 0;
+    store->filter.checks = 0;
+    store->filter.negatives = 0;
+    store->filter.false_positives = 0;
+    store->filter.rebuilds = 0;
+
+    if (sslog_store_filter_init(&store->filter, 0) != SSLOG_ERROR_NO) {
+        free(store);
+        return NULL;
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        if (sslog_store_index_init(&store->indexes[field], (sslog_store_field) field) != SSLOG_ERROR_NO) {
+            for (int i = 0; i < field; ++i) {
+                sslog_store_index_free(&store->indexes[i]);
+            }
+
+            sslog_store_filter_free(&store->filter);
+            free(store);
+            return NULL;
+        }
+    }
+
+#ifdef MTENABLE
+    pthread_rwlock_init(&store->lock, NULL);
+    pthread_mutex_init(&store->write_lock, NULL);
+    pthread_mutex_init(&store->readers_lock, NULL);
+    pthread_cond_init(&store->readers_changed, NULL);
+#endif
+
+    return store;
+}
+
+
+void sslog_store_free(sslog_store_t *store)
+{
+    if (store == NULL) {
+        return;
+    }
+
+    list_head_t *current_position = NULL;
+    list_head_t *list_walker = NULL;
+
+    list_for_each_safe(list_walker, current_position, &store->records) {
+        sslog_store_record_t *record = list_entry(list_walker, sslog_store_record_t, store_links);
+        sslog_triple_t *triple = record->triple;
+
+        sslog_triple_as_internal(triple)->store_record = NULL;
+        free(record);
+
+        sslog_free_triple_force(triple);
+    }
+
+    // Triples of removed rows are freed with the segment.
+    list_for_each_safe(list_walker, current_position, &store->garbage) {
+        sslog_store_garbage_t *garbage = list_entry(list_walker, sslog_store_garbage_t, links);
+
+        sslog_free_triple_force(garbage->triple);
+        free(garbage);
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        sslog_store_index_free(&store->indexes[field]);
+    }
+
+    if (store->segment != NULL) {
+        for (uint32_t row = 0; store->segment->triples != NULL && row < store->segment->header->rows_count; ++row) {
+            if (store->segment->triples[row] != NULL) {
+                sslog_free_triple_force(store->segment->triples[row]);
+            }
+        }
+
+        sslog_store_segment_free(store->segment);
+    }
+
+    sslog_store_filter_free(&store->filter);
+
+#ifdef MTENABLE
+    pthread_rwlock_destroy(&store->lock);
+    pthread_mutex_destroy(&store->write_lock);
+    pthread_mutex_destroy(&store->readers_lock);
+    pthread_cond_destroy(&store->readers_changed);
+#endif
+
+    free(store);
+}
+
+
+int sslog_store_add_triple(sslog_store_t *store, sslog_triple_t *triple)
+{
+    sslog_store_lock_write(store);
+
+    unsigned long since_clock = store->clock;
+
+    int result = (sslog_store_find_stored(store, triple) != NULL) ?
+                SSLOG_ERROR_ALREADY_EXISTS : sslog_store_insert(store, triple);
+
+    sslog_store_evict(store, since_clock);
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+
+    if (result != SSLOG_ERROR_NO) {
+        return result;
+    }
+
+    SSLOG_DEBUG_FUNC("New triple: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
+    SSLOG_DEBUG_FUNC("Stored triples: %d", store->triples_count);
+
+    return SSLOG_ERROR_NO;
+}
+
+
+
+sslog_triple_t* sslog_store_add_get_triple(sslog_store_t *store, sslog_triple_t *triple)
+{
+    sslog_store_lock_write(store);
+
+    unsigned long since_clock = store->clock;
+
+    sslog_triple_t *stored_triple = sslog_store_find_stored(store, triple);
+
+    if (stored_triple != NULL) {
+        sslog_store_unlock_write(store);
+
+        SSLOG_DEBUG_FUNC("Triple already stored: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
+        return stored_triple;
+    }
+
+    int result = sslog_store_insert(store, triple);
+
+    sslog_store_evict(store, since_clock);
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+
+    if (result != SSLOG_ERROR_NO) {
+        return NULL;
+    }
+
+    SSLOG_DEBUG_FUNC("New triple: %s - %s - %s (%d)", triple->subject, triple->predicate, triple->object, triple->object_type);
+    SSLOG_DEBUG_FUNC("Stored triples: %d", store->triples_count);
+
+    return triple;
+}
+
+
+sslog_triple_t *sslog_store_get_triple_by_data(sslog_store_t *store, const char *subject, const char *predicate, const char *object,
+                                               sslog_rdf_type subject_type, sslog_rdf_type object_type) {
+    if (subject == NULL || predicate == NULL || object == NULL) {
+        return NULL;
+    }
+
+    sslog_triple_t triple_template = { (char *) subject, (char *) predicate, (char *) object, subject_type, object_type };
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    sslog_store_lock_read(store);
+
+    sslog_store_match_template(store, &triple_template, 1, sslog_store_read_snapshot(store), &matches);
+
+    sslog_triple_t *triple = (matches.count == 0) ? NULL : sslog_store_match_triple(store, &matches.records[0]);
+
+    sslog_store_unlock_read(store);
+
+    free(matches.records);
+
+    return triple;
+}
+
+
+int sslog_store_update_triples(sslog_store_t *store, list_t *current_triples, list_t *new_triples)
+{
+    // Removing and adding are one change,
+    // so readers see the store before or after the update only.
+    sslog_store_lock_write(store);
+
+    unsigned long since_clock = store->clock;
+
+    if (list_is_empty(current_triples) != true) {
+        sslog_store_delete_triples(store, current_triples);
+    }
+
+    sslog_store_insert_triples(store, new_triples);
+
+    sslog_store_evict(store, since_clock);
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+
+    return SSLOG_ERROR_NO;
+}
+
+
+
+int sslog_store_add_triples(sslog_store_t *store, list_t *triples)
+{
+    sslog_store_lock_write(store);
+
+    unsigned long since_clock = store->clock;
+
+    int unstored_count = sslog_store_insert_triples(store, triples);
+
+    sslog_store_evict(store, since_clock);
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+
+    return unstored_count;
+}
+
+
+
+int sslog_store_add_triples_with_replace(sslog_store_t *store, list_t *triples)
+{
+    sslog_store_lock_write(store);
+
+    unsigned long since_clock = store->clock;
+    int changes_count = 0;
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &triples->links) {
+        list_t *node = list_entry(list_walker, list_t, links);
+        sslog_triple_t *new_triple = (sslog_triple_t *) node->data;
+
+        if (sslog_triple_is_stored(new_triple) == true) {
+            continue;
+        }
+
+        if (sslog_triple_is_template(new_triple) == true) {
+            continue;
+        }
+
+        sslog_store_yield(store, &changes_count);
+
+        sslog_store_record_t *record = sslog_store_find_equal(store, new_triple, SSLOG_STORE_LATEST);
+        long row = (record == NULL) ? sslog_store_find_row(store, new_triple, SSLOG_STORE_LATEST) : -1;
+
+        if (row >= 0) {
+            // Rows of the segment are not changed: the row is removed
+            // and the new triple is stored as a record. Without memory
+            // for marks the new triple is not stored (as on failed inserting).
+            if (sslog_store_prepare_deleting(store, NULL) != SSLOG_ERROR_NO) {
+                continue;
+            }
+
+            // Materialized triple of the row is freed later, its entity is moved now.
+            sslog_internal_triple_t *old_triple = (sslog_internal_triple_t *) sslog_store_segment_row_triple(store->segment, (uint32_t) row);
+
+            sslog_store_delete_row(store, (uint32_t) row);
+
+            if (old_triple != NULL && old_triple->linked_entity != NULL) {
+                sslog_entity_set_link(old_triple->linked_entity, sslog_triple_as_internal(new_triple));
+                old_triple->linked_entity = NULL;
+            }
+        }
+
+        if (record == NULL) {
+            sslog_store_insert(store, new_triple);
+            continue;
+        }
+
+        // Replace the stored triple: keys of the record are not changed,
+        // because triples have same data. Readers can use the old triple, it is freed later.
+        sslog_internal_triple_t *old_triple = sslog_triple_as_internal(record->triple);
+
+        if (old_triple->linked_entity != NULL) {
+            sslog_entity_set_link(old_triple->linked_entity, sslog_triple_as_internal(new_triple));
+            old_triple->linked_entity = NULL;
+        }
+
+        old_triple->store_record = NULL;
+        record->triple = new_triple;
+
+        sslog_triple_as_internal(new_triple)->store_record = record;
+        sslog_triple_stored(new_triple, true);
+        sslog_store_touch_key(store, record->keys[SSLOG_STORE_FIELD_SUBJECT]);
+        record->keys[SSLOG_STORE_FIELD_SUBJECT]->generation = ++store->version;
+
+        sslog_store_retire(store, (sslog_triple_t *) old_triple, 0);
+    }
+
+    sslog_store_evict(store, since_clock);
+    sslog_store_update_filter(store);
+
+    SSLOG_DEBUG_FUNC("Stored triples: %i", store->triples_count);
+
+    sslog_store_unlock_write(store);
+
+    return SSLOG_ERROR_NO;
+}
+
+
+
+int sslog_store_remove_triples(sslog_store_t *store, list_t *triples_templates)
+{
+    if (list_is_empty(triples_templates) == true) {
+        SSLOG_DEBUG_FUNC("Not riples templates.");
+        return SSLOG_ERROR_NO;
+    }
+
+    sslog_store_lock_write(store);
+
+    int result = sslog_store_delete_triples(store, triples_templates);
+
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+
+    return result;
+}
+
+
+
+bool sslog_store_exists(sslog_store_t *store, sslog_triple_t *triple)
+{
+    sslog_store_lock_read(store);
+
+    unsigned long snapshot = sslog_store_read_snapshot(store);
+
+    bool is_exists = (sslog_store_find_equal(store, triple, snapshot) != NULL
+                      || sslog_store_find_row(store, triple, snapshot) >= 0) ? true : false;
+
+    sslog_store_unlock_read(store);
+
+    return is_exists;
+}
+
+
+bool sslog_store_exists_template_data(sslog_store_t *store, const char *subject, const char *predicate, const char *object,
+                                               sslog_rdf_type subject_type, sslog_rdf_type object_type)
+{
+	sslog_triple_t *triple = sslog_store_get_triple_by_data(store, subject, predicate, object, subject_type, object_type);
+
+	return (triple == NULL) ? false : true;
+}
+
+
+bool sslog_store_exists_pointer(sslog_store_t *store, sslog_triple_t *triple)
+{
+    sslog_store_lock_read(store);
+
+    unsigned long snapshot = sslog_store_read_snapshot(store);
+    sslog_store_record_t *record = sslog_triple_as_internal(triple)->store_record;
+
+    // Stored triples are unique in the snapshot, so record with same data must be the record of the triple.
+    bool is_exists = (record != NULL && sslog_store_find_equal(store, triple, snapshot) == record) ? true : false;
+
+    if (is_exists == false && record == NULL) {
+        long row = sslog_store_find_row(store, triple, snapshot);
+        is_exists = (row >= 0 && sslog_store_segment_row_triple(store->segment, (uint32_t) row) == triple) ? true : false;
+    }
+
+    sslog_store_unlock_read(store);
+
+    return is_exists;
+}
+
+
+list_t *sslog_store_query_triples(sslog_store_t *store, list_t *triples_templates)
+{
+    return sslog_store_query_triples_with_limit(store, triples_templates, -1);
+}
+
+
+list_t *sslog_store_query_triples_with_limit(sslog_store_t *store, list_t *triples_templates, int max_triples_count)
+{
+    if (max_triples_count == 0) {
+        return list_new();
+    }
+
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    sslog_store_lock_read(store);
+
+    sslog_store_match_templates(store, triples_templates, max_triples_count, sslog_store_read_snapshot(store), &matches);
+
+    list_t *query_triples = sslog_store_matches_to_list(store, &matches);
+
+    sslog_store_unlock_read(store);
+
+    free(matches.records);
+
+    SSLOG_DEBUG_FUNC("Stored triples: %i", store->triples_count);
+
+    return query_triples;
+}
+
+
+list_t *sslog_store_query_triples_by_data(sslog_store_t *store,
+                                          const char *subject, const char *predicate, const char *object,
+                                          sslog_rdf_type subject_type, sslog_rdf_type object_type,
+                                          int max_triples_count)
+{
+    sslog_store_lock_read(store);
+
+    list_t *query_triples = sslog_store_query_data(store, subject, predicate, object,
+                                                   subject_type, object_type, max_triples_count,
+                                                   sslog_store_read_snapshot(store));
+
+    sslog_store_unlock_read(store);
+
+    return query_triples;
+}
+
+
+sslog_triple_t *sslog_store_get_triple(sslog_store_t *store, list_t *triples_templates)
+{
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+
+    sslog_store_lock_read(store);
+
+    sslog_store_match_templates(store, triples_templates, 1, sslog_store_read_snapshot(store), &matches);
+
+    sslog_triple_t *triple = (matches.count == 0) ? NULL : sslog_store_match_triple(store, &matches.records[0]);
+
+    sslog_store_unlock_read(store);
+
+    free(matches.records);
+
+    return triple;
+}
+
+
+sslog_triple_t *sslog_store_get_rdftype(sslog_store_t *store, const char *uri)
+{
+    sslog_store_lock_read(store);
+
+    sslog_triple_t *type_triple = sslog_store_find_rdftype(store, uri, sslog_store_read_snapshot(store));
+
+    sslog_store_unlock_read(store);
+
+    return type_triple;
+}
+
+
+
+
+
+
+int sslog_store_save(sslog_store_t *store, const char *path)
+{
+    if (store == NULL || path == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_ARGUMENT, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "store or path");
+    }
+
+    sslog_store_lock_read(store);
+
+    unsigned long snapshot = sslog_store_read_snapshot(store);
+    sslog_store_segment_t *segment = store->segment;
+    int count = 0;
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &store->records) {
+        ++count;
+    }
+
+    count += (segment == NULL) ? 0 : (int) segment->header->rows_count;
+
+    // Values of triples are not copied, the image is built under the lock.
+    sslog_triple_t *triples = (sslog_triple_t *) malloc((count + 1) * sizeof(sslog_triple_t));
+
+    if (triples == NULL) {
+        sslog_store_unlock_read(store);
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    int index = 0;
+
+    list_for_each(list_walker, &store->records) {
+        sslog_store_record_t *record = list_entry(list_walker, sslog_store_record_t, store_links);
+
+        if (sslog_store_record_is_visible(record, snapshot) == true) {
+            triples[index++] = *record->triple;
+        }
+    }
+
+    for (uint32_t row = 0; segment != NULL && segment->born <= snapshot && row < segment->header->rows_count; ++row) {
+        if (sslog_store_segment_is_visible(segment, row, snapshot) == true) {
+            sslog_store_segment_row_data(segment, row, &triples[index++]);
+        }
+    }
+
+    void *data = NULL;
+    size_t size = 0;
+
+    int result = sslog_store_segment_build(triples, index, &data, &size);
+
+    sslog_store_unlock_read(store);
+
+    free(triples);
+
+    if (result != SSLOG_ERROR_NO) {
+        return sslog_error_set(NULL, result, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    result = sslog_store_segment_write(data, size, path);
+
+    free(data);
+
+    if (result != SSLOG_ERROR_NO) {
+        return sslog_error_set(NULL, result, SSLOG_ERROR_TEXT_FILE "can't write file");
+    }
 
+    return sslog_error_reset(NULL);
+}
 
-list_t *sslog_store_query_triples_by_data(sslog_store_t *store,
-                                          const char *subject, const char *predicate, const char *object,
-                                          sslog_rdf_type subject_type, sslog_rdf_type object_type,
-                                          int max_triples_count)
+
+int sslog_store_load(sslog_store_t *store, const char *path)
 {
-    if (max_triples_count == 0) {
-        return list_new();
+    if (store == NULL || path == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_ARGUMENT, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "store or path");
     }
 
-    list_t *list_store = SSLOG_STORE_CAST(store);
+    sslog_store_segment_t *segment = sslog_store_segment_open(path);
 
-    list_t *query_triples = list_new();
+    if (segment == NULL) {
+        return sslog_error_get_last_code();
+    }
 
-    list_head_t *list_walker = NULL;
+    sslog_store_lock_write(store);
 
-    int counter = 0;
+    if (store->triples_count != 0 || store->segment != NULL) {
+        sslog_store_unlock_write(store);
+        sslog_store_segment_free(segment);
 
-    sslog_triple_t *triple_template = sslog_new_triple_detached(subject, predicate, object, subject_type, object_type);
+        return sslog_error_set(NULL, SSLOG_ERROR_ALREADY_EXISTS, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "store is not empty");
+    }
 
-    list_for_each(list_walker, &list_store->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+    // Older snapshots see the empty store.
+    store->segment = segment;
+    store->removed_generation = ++store->version;
+    segment->born = store->version;
 
-        if (sslog_compare_triple_with_any(triple, triple_template, SSLOG_TRIPLE_ANY) == true) {
-            list_add_data(query_triples, triple);
-            ++counter;
-        }
+    sslog_store_load_filter(store);
 
-        if (max_triples_count > 0 && counter >= max_triples_count) {
-            break;
+    sslog_store_unlock_write(store);
+
+    SSLOG_DEBUG_FUNC("Loaded triples: %i", segment->live_count);
+
+    return sslog_error_reset(NULL);
+}
+
+
+int sslog_store_set_ontology(sslog_store_t *store, const sslog_ontology_t *ontology)
+{
+    if (store == NULL || ontology == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "store or ontology");
+    }
+
+    sslog_store_segment_t *segment = NULL;
+
+    // Image is checked once here, it is not copied and it is never freed.
+    if (ontology->schema != NULL) {
+        segment = sslog_store_segment_new((void *) ontology->schema, ontology->schema_size, false);
+
+        if (segment == NULL) {
+            return sslog_error_get_last_code();
         }
+
+        segment->is_static = true;
     }
 
-    sslog_free_triple(triple_template);
+    sslog_store_lock_write(store);
 
-    return query_triples;
+    if (store->ontology == ontology) {
+        sslog_store_unlock_write(store);
+        sslog_store_segment_free(segment);
+
+        return sslog_error_reset(NULL);
+    }
+
+    if (store->ontology != NULL || store->triples_count != 0 || store->segment != NULL) {
+        sslog_store_unlock_write(store);
+        sslog_store_segment_free(segment);
+
+        return sslog_error_set(NULL, SSLOG_ERROR_ALREADY_EXISTS, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "store is not empty");
+    }
+
+    store->ontology = ontology;
+
+    if (segment != NULL) {
+        store->segment = segment;
+        store->removed_generation = ++store->version;
+        segment->born = store->version;
+
+        sslog_store_load_filter(store);
+    }
+
+    sslog_store_unlock_write(store);
+
+    SSLOG_DEBUG_FUNC("Ontology '%s': %i entities", ontology->name, ontology->entities_count);
+
+    return sslog_error_reset(NULL);
 }
 
 
-sslog_triple_t *sslog_store_get_triple(sslog_store_t *store, list_t *triples_templates)
+int sslog_store_freeze(sslog_store_t *store, list_t *triples_templates)
 {
-    list_t *list_store = SSLOG_STORE_CAST(store);
+    if (store == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "store");
+    }
+
+    sslog_store_lock_exclusive(store);
+
+    sslog_store_segment_t *old_segment = store->segment;
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+    int result = SSLOG_ERROR_NO;
+
+    if (list_is_null_or_empty(triples_templates) == true) {
+        list_head_t *list_walker = NULL;
+        list_for_each(list_walker, &store->records) {
+            sslog_store_record_t *record = list_entry(list_walker, sslog_store_record_t, store_links);
+
+            if (record->died != 0) {
+                continue;
+            }
+
+            result = sslog_store_matches_add(&matches, record, 0, 0);
+
+            if (result != SSLOG_ERROR_NO) {
+                break;
+            }
+        }
+    } else {
+        result = sslog_store_match_templates(store, triples_templates, -1, SSLOG_STORE_LATEST, &matches);
+    }
+
+    // Rows of the current segment are frozen again, so only records are needed.
+    int records_count = 0;
+
+    for (int i = 0; i < matches.count; ++i) {
+        if (matches.records[i].record != NULL) {
+            matches.records[records_count++] = matches.records[i];
+        }
+    }
+
+    matches.count = records_count;
+
+    if (result != SSLOG_ERROR_NO || matches.count == 0) {
+        sslog_store_unlock_exclusive(store);
+        free(matches.records);
+        return (result != SSLOG_ERROR_NO) ? result : sslog_error_reset(NULL);
+    }
+
+    int rows_count = (old_segment == NULL) ? 0 : old_segment->live_count;
+    sslog_triple_t *triples = (sslog_triple_t *) malloc((rows_count + matches.count) * sizeof(sslog_triple_t));
+
+    if (triples == NULL) {
+        sslog_store_unlock_exclusive(store);
+        free(matches.records);
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    int index = 0;
+
+    for (uint32_t row = 0; old_segment != NULL && row < old_segment->header->rows_count; ++row) {
+        if (sslog_store_segment_is_removed(old_segment, row) == false) {
+            sslog_store_segment_row_data(old_segment, row, &triples[index++]);
+        }
+    }
+
+    for (int i = 0; i < matches.count; ++i) {
+        triples[index++] = *matches.records[i].record->triple;
+    }
+
+    void *data = NULL;
+    size_t size = 0;
+    sslog_store_segment_t *segment = NULL;
+
+    result = sslog_store_segment_build(triples, index, &data, &size);
+
+    if (result == SSLOG_ERROR_NO) {
+        segment = sslog_store_segment_new(data, size, false);
+        result = (segment == NULL) ? SSLOG_ERROR_INCORRECT_ARGUMENT : SSLOG_ERROR_NO;
+    }
+
+    // Linked triples are moved to the new segment, so it needs the array of triples.
+    sslog_triple_t **segment_triples = (segment == NULL) ? NULL : sslog_store_segment_init_triples(segment);
+
+    if (segment != NULL && segment_triples == NULL) {
+        // The segment owns the image, it is freed with the segment.
+        sslog_store_segment_free(segment);
+        data = NULL;
+        result = SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    free(triples);
+
+    if (result != SSLOG_ERROR_NO) {
+        sslog_store_unlock_exclusive(store);
+        free(data);
+        free(matches.records);
+        return sslog_error_set(NULL, result, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
 
+    // Removed rows of the old segment are forgotten, their materialized triples are kept.
+    list_head_t *current_position = NULL;
     list_head_t *list_walker = NULL;
 
-    list_for_each(list_walker, &list_store->links) {
-        list_t *node = list_entry(list_walker, list_t, links);
-        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+    list_for_each_safe(list_walker, current_position, &store->garbage) {
+        sslog_store_garbage_t *garbage = list_entry(list_walker, sslog_store_garbage_t, links);
+
+        if (garbage->triple != NULL || old_segment == NULL) {
+            continue;
+        }
+
+        garbage->triple = sslog_store_segment_row_triple(old_segment, garbage->row);
 
-        if (sslog_store_match_templates(triple, triples_templates) == true) {
-            return triple;
+        if (garbage->triple == NULL) {
+            list_del(&garbage->links);
+            free(garbage);
+        } else {
+            old_segment->triples[garbage->row] = NULL;
         }
     }
 
-    return NULL;
+    // Triples that are linked to entities stay as materialized rows of the new segment,
+    // so entities keep their triples. Other triples are freed later, the thread
+    // of freezing can use them in its read section.
+    for (uint32_t row = 0; old_segment != NULL && row < old_segment->header->rows_count; ++row) {
+        sslog_internal_triple_t *triple = (sslog_internal_triple_t *) sslog_store_segment_row_triple(old_segment, row);
+
+        if (triple == NULL) {
+            continue;
+        }
+
+        if (triple->linked_entity != NULL) {
+            segment_triples[sslog_store_segment_find_row(segment, (sslog_triple_t *) triple, SSLOG_STORE_LATEST)] = (sslog_triple_t *) triple;
+        } else {
+            sslog_store_retire(store, (sslog_triple_t *) triple, 0);
+        }
+    }
+
+    for (int i = 0; i < matches.count; ++i) {
+        sslog_store_record_t *record = matches.records[i].record;
+        sslog_internal_triple_t *triple = sslog_triple_as_internal(record->triple);
+
+        sslog_store_delete_record(store, record);
+
+        if (triple->linked_entity != NULL) {
+            sslog_store_unlink_record(store, record);
+            segment_triples[sslog_store_segment_find_row(segment, (sslog_triple_t *) triple, SSLOG_STORE_LATEST)] = (sslog_triple_t *) triple;
+        }
+    }
+
+    // Other read sections are ended, so there are no snapshots with the old segment.
+    store->segment = segment;
+    segment->born = store->version;
+
+    sslog_store_segment_free(old_segment);
+
+    SSLOG_DEBUG_FUNC("Frozen triples: %i, stored triples: %i", segment->live_count, store->triples_count);
+
+    sslog_store_unlock_exclusive(store);
+
+    free(matches.records);
+
+    return sslog_error_reset(NULL);
 }
 
 
+void sslog_store_set_memory_limit(sslog_store_t *store, size_t max_bytes)
+{
+    sslog_store_lock_write(store);
 
+    store->memory_limit = max_bytes;
 
-sslog_triple_t *sslog_store_get_rdftype(sslog_store_t *store, const char *uri)
+    sslog_store_evict(store, store->clock);
+    sslog_store_update_filter(store);
+
+    sslog_store_unlock_write(store);
+}
+
+
+unsigned long sslog_store_get_evicted_count(sslog_store_t *store)
+{
+    sslog_store_lock_read(store);
+
+    unsigned long evicted_count = store->evicted_count;
+
+    sslog_store_unlock_read(store);
+
+    return evicted_count;
+}
+
+
+bool sslog_store_is_evicted(sslog_store_t *store, const char *uri)
+{
+    if (uri == NULL) {
+        return false;
+    }
+
+    sslog_store_lock_read(store);
+
+    sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[SSLOG_STORE_FIELD_SUBJECT], uri);
+    bool is_evicted = (key != NULL && key->is_evicted == true);
+
+    sslog_store_unlock_read(store);
+
+    return is_evicted;
+}
+
+
+void sslog_store_reset_evicted(sslog_store_t *store, const char *uri)
+{
+    if (uri == NULL) {
+        return;
+    }
+
+    sslog_store_lock_write(store);
+
+    sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[SSLOG_STORE_FIELD_SUBJECT], uri);
+
+    if (key != NULL) {
+        key->is_evicted = false;
+    }
+
+    sslog_store_unlock_write(store);
+}
+
+
+int sslog_store_pin_subject(sslog_store_t *store, const char *uri, bool is_pinned)
+{
+    if (uri == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_ARGUMENT, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT);
+    }
+
+    sslog_store_lock_write(store);
+
+    sslog_store_index_t *index = &store->indexes[SSLOG_STORE_FIELD_SUBJECT];
+    sslog_store_key_t *key = sslog_store_index_get_key(index, uri);
+
+    // Generation is kept when the key is created or freed by pinning.
+    if (is_pinned == false && key != NULL && key->count == 0 && key->pins == 1
+            && key->generation > store->removed_generation) {
+        store->removed_generation = key->generation;
+    }
+
+    int result = sslog_store_index_pin(index, uri, is_pinned);
+
+    if (is_pinned == true && key == NULL && result == SSLOG_ERROR_NO) {
+        sslog_store_index_get_key(index, uri)->generation = store->removed_generation;
+    }
+
+    sslog_store_unlock_write(store);
+
+    return result;
+}
+
+
+unsigned long sslog_store_get_version(sslog_store_t *store)
+{
+    sslog_store_lock_read(store);
+
+    unsigned long version = store->version;
+
+    sslog_store_unlock_read(store);
+
+    return version;
+}
+
+
+unsigned long sslog_store_get_generation(sslog_store_t *store, const char *uri)
+{
+    if (uri == NULL) {
+        return 0;
+    }
+
+    sslog_store_lock_read(store);
+
+    sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[SSLOG_STORE_FIELD_SUBJECT], uri);
+
+    unsigned long generation = (key == NULL) ? store->removed_generation : key->generation;
+
+    // Rows of the segment have no generation, their removing changes the common one.
+    if (generation < store->removed_generation && store->segment != NULL
+            && sslog_store_segment_find_term(store->segment, uri) >= 0) {
+        generation = store->removed_generation;
+    }
+
+    sslog_store_unlock_read(store);
+
+    return generation;
+}
+
+
+void sslog_store_get_filter_stats(sslog_store_t *store, sslog_store_filter_stats_t *stats)
+{
+    sslog_store_lock_read(store);
+
+    stats->checks = store->filter.checks;
+    stats->negatives = store->filter.negatives;
+    stats->false_positives = store->filter.false_positives;
+    stats->rebuilds = store->filter.rebuilds;
+
+    sslog_store_unlock_read(store);
+}
+
+
+int sslog_store_begin_read(sslog_store_t *store)
 {
-    return sslog_store_get_triple_by_data(store, uri, SSLOG_TRIPLE_RDF_TYPE, SSLOG_TRIPLE_ANY,
-                                   SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
+    if (store == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_NULL_ARGUMENT, SSLOG_ERROR_TEXT_NULL_ARGUMENT "store");
+    }
+
+    sslog_store_reader_t *reader = sslog_store_find_reader(store);
+
+    if (reader != NULL) {
+        ++reader->depth;
+        return SSLOG_ERROR_NO;
+    }
+
+    reader = (sslog_store_reader_t *) malloc(sizeof(sslog_store_reader_t));
+
+    if (reader == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    reader->store = store;
+    reader->depth = 1;
+
+    SSLOG_STORE_READERS_LOCK(store);
+
+#ifdef MTENABLE
+    while (store->exclusive_count > 0) {
+        pthread_cond_wait(&store->readers_changed, &store->readers_lock);
+    }
+#endif
+
+    // Published version is read with registering, so the writer can't free its data.
+    reader->oldest = store->published;
+    reader->snapshot = reader->oldest;
+    list_add(&reader->links, &store->readers);
+
+    SSLOG_STORE_READERS_UNLOCK(store);
+
+    reader->next = sslog_store_thread_readers();
+    sslog_store_set_thread_readers(reader);
+
+    return SSLOG_ERROR_NO;
 }
 
 
+void sslog_store_end_read(sslog_store_t *store)
+{
+    sslog_store_reader_t *reader = (store == NULL) ? NULL : sslog_store_find_reader(store);
+
+    if (reader == NULL || --reader->depth > 0) {
+        return;
+    }
+
+    sslog_store_reader_t *readers = sslog_store_thread_readers();
+
+    if (readers == reader) {
+        sslog_store_set_thread_readers(reader->next);
+    } else {
+        while (readers->next != reader) {
+            readers = readers->next;
+        }
+
+        readers->next = reader->next;
+    }
+
+    SSLOG_STORE_READERS_LOCK(store);
+
+    list_del(&reader->links);
+
+#ifdef MTENABLE
+    pthread_cond_broadcast(&store->readers_changed);
+#endif
+
+    SSLOG_STORE_READERS_UNLOCK(store);
+
+    free(reader);
+
+    // Removed data can be kept for this section only, it is freed now
+    // if the writer is not busy, otherwise the writer frees it.
+#ifdef MTENABLE
+    if (pthread_mutex_trylock(&store->write_lock) != 0) {
+        return;
+    }
+#endif
+
+    sslog_store_lock_step(store);
+    sslog_store_reclaim(store);
+    sslog_store_unlock_step(store);
 
+#ifdef MTENABLE
+    pthread_mutex_unlock(&store->write_lock);
+#endif
+}
+
+
+unsigned long sslog_store_read_snapshot(sslog_store_t *store)
+{
+    sslog_store_reader_t *reader = sslog_store_find_reader(store);
 
+    return (reader == NULL) ? store->published : reader->snapshot;
+}
 
 
 sslog_individual_t *sslog_store_get_individual(sslog_store_t *store, const char *uri)
@@ -658,39 +2708,89 @@ sslog_individual_t *sslog_store_get_individual(sslog_store_t *store, const char
         return NULL;
     }
 
-    sslog_internal_triple_t *type_triple = (sslog_internal_triple_t *) sslog_store_get_rdftype(store, uri);
+    // Individual can be linked to the triple, so other readers are excluded,
+    // but the change of the writer is not waited for, the triple is found in the snapshot.
+    sslog_store_lock_step(store);
+
+    sslog_internal_triple_t *type_triple = (sslog_internal_triple_t *) sslog_store_find_rdftype(store, uri,
+                                                                                                 sslog_store_read_snapshot(store));
+
+    sslog_individual_t *individual = NULL;
 
     if (type_triple == NULL) {
-        return NULL;
+        individual = NULL;
+    } else if (type_triple->linked_entity != NULL) {
+        individual = sslog_entity_as_individual(type_triple->linked_entity);
+    } else {
+        individual = sslog_new_individual_from_triple((sslog_triple_t *) type_triple);
     }
 
-    if (type_triple->linked_entity != NULL) {
-        return sslog_entity_as_individual(type_triple->linked_entity);
-    }
+    sslog_store_unlock_step(store);
 
-    return sslog_new_individual_from_triple((sslog_triple_t *) type_triple);
+    return individual;
 }
 
 
 int sslog_store_remove_individual(sslog_store_t *store, sslog_individual_t *individual)
 {
-    list_t *triples = list_new();
+    sslog_store_matches_t matches = { NULL, 0, 0 };
 
-    sslog_triple_t *triple = sslog_new_triple_detached(individual->entity.uri, SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY,
-                                                       SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI) ;
-    list_add_data(triples, triple);
+    sslog_store_lock_write(store);
 
-    // Triple to remove properties, that is link to individual.
-    triple = sslog_new_triple_detached(SSLOG_TRIPLE_ANY, SSLOG_TRIPLE_ANY, individual->entity.uri,
-                                       SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI) ;
+    int result = sslog_store_match_individual(store, individual, &matches);
 
-    list_add_data(triples, triple);
+    // Individual is freed with its rdf:type triple, so all triples are found before removing.
+    if (result == SSLOG_ERROR_NO) {
+        sslog_store_matches_unique(&matches);
+        result = sslog_store_delete_matches(store, &matches, NULL);
+        sslog_store_update_filter(store);
+    }
 
-    sslog_store_remove_triples(store, triples);
+    sslog_store_unlock_write(store);
 
-    list_free_with_nodes(triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+    free(matches.records);
 
-    return SSLOG_ERROR_NO;
+    return result;
+}
+
+
+int sslog_store_remove_individuals(sslog_store_t *store, list_t *individuals)
+{
+    sslog_store_matches_t matches = { NULL, 0, 0 };
+    int result = SSLOG_ERROR_NO;
+
+    sslog_store_lock_write(store);
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &individuals->links) {
+        list_t *node = list_entry(list_walker, list_t, links);
+
+        if (node->data == NULL) {
+            continue;
+        }
+
+        result = sslog_store_match_individual(store, (sslog_individual_t *) node->data, &matches);
+
+        if (result != SSLOG_ERROR_NO) {
+            break;
+        }
+    }
+
+    // Triples that link individuals from the list are found twice,
+    // they are removed once.
+    if (result == SSLOG_ERROR_NO) {
+        sslog_store_matches_unique(&matches);
+        result = sslog_store_delete_matches(store, &matches, NULL);
+        sslog_store_update_filter(store);
+    }
+
+    sslog_store_unlock_write(store);
+
+    free(matches.records);
+
+    SSLOG_DEBUG_FUNC("Stored triples: %i", store->triples_count);
+
+    return result;
 }
 
 sslog_property_t *sslog_store_get_property(sslog_store_t *store, const char *uri)
@@ -699,6 +2799,12 @@ sslog_property_t *sslog_store_get_property(sslog_store_t *store, const char *uri
         return NULL;
     }
 
+    sslog_entity_t *entity = sslog_ontology_find(store->ontology, uri);
+
+    if (entity != NULL) {
+        return (entity->type == SSLOG_ENTITY_PROPERTY) ? sslog_entity_as_property(entity) : NULL;
+    }
+
     sslog_internal_triple_t *type_triple = (sslog_internal_triple_t *) sslog_store_get_rdftype(store, uri);
 
     if (type_triple == NULL) {
@@ -725,6 +2831,12 @@ sslog_class_t *sslog_store_get_class(sslog_store_t *store, const char *uri)
         return NULL;
     }
 
+    sslog_entity_t *entity = sslog_ontology_find(store->ontology, uri);
+
+    if (entity != NULL) {
+        return (entity->type == SSLOG_ENTITY_CLASS) ? sslog_entity_as_class(entity) : NULL;
+    }
+
     sslog_internal_triple_t *type_triple = (sslog_internal_triple_t *) sslog_store_get_rdftype(store, uri);
 
     if (type_triple == NULL) {
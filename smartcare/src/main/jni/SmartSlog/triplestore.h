@@ -27,6 +27,10 @@
  * @section DESCRIPTION
  *
  * Describe functions to work with reository.
+ * Functions of the store can be called by several threads: readers see
+ * the snapshot of the last completed change (see triplestore_internal.h),
+ * returned stored triples are valid until the end of the read section
+ * (see sslog_store_begin_read), without the section - until the next change of the store.
  * This file is part of SmartSlog KP Library.
  *
  * Copyright (C) 2009 - SmartSlog. All rights reserved.
@@ -35,9 +39,12 @@
 
 //#include "structures.h"
 //#include "utils/kp_debug.h"
+#include <stddef.h>
+
 #include "triple.h"
 #include "utils/list.h"
 #include "entity.h"
+#include "ontology.h"
 
 #ifndef _SSLOG_TRIPLESTORE_H
 #define	_SSLOG_TRIPLESTORE_H
@@ -53,7 +60,20 @@
 #endif
 
 
-typedef list_t sslog_store_t;
+/** @brief Local triple-store (see triplestore_internal.h). */
+typedef struct sslog_store_s sslog_store_t;
+
+/**
+ * @brief Statistics of the store filter.
+ * Filter checks subjects and pairs (subject, predicate) of templates,
+ * negative checks skip searching in the store.
+ */
+typedef struct sslog_store_filter_stats_s {
+    unsigned long checks;           /**< Number of checks. */
+    unsigned long negatives;        /**< Number of checks that skip searching. */
+    unsigned long false_positives;  /**< Number of positive checks without found triples. */
+    unsigned long rebuilds;         /**< Number of filter rebuilds (after removing or growing). */
+} sslog_store_filter_stats_t;
 
 
 #ifdef	__cplusplus
@@ -90,6 +110,16 @@ sslog_triple_t * sslog_store_get_triple_by_data(sslog_store_t *store,
 sslog_triple_t * sslog_store_get_triple(sslog_store_t *store, list_t *triples_templates);
 
 list_t* sslog_store_query_triples(sslog_store_t *store, list_t *triples_templates);
+
+/**
+ * @brief Queries triples that are matched to any of templates.
+ * Result contains no more than max_triples_count triples in the store order.
+ * @param store. Store with triples.
+ * @param triples_templates. List with triples templates.
+ * @param max_triples_count. Maximum number of triples, negative value - no limits.
+ * @return list with triples (can be empty) on success or NULL otherwise.
+ */
+list_t* sslog_store_query_triples_with_limit(sslog_store_t *store, list_t *triples_templates, int max_triples_count);
 list_t* sslog_store_query_triples_by_data(sslog_store_t *store,
                                           const char *subject, const char *predicate, const char *object,
                                           sslog_rdf_type subject_type, sslog_rdf_type object_type, int max_triples_count);
@@ -107,6 +137,18 @@ sslog_triple_t * sslog_store_get_rdftype(sslog_store_t *store, const char *uri);
 int sslog_store_remove_individual(sslog_store_t *store, sslog_individual_t *individual);
 
 
+/**
+ * @brief Removes individuals from local store in one pass.
+ * Triples of individuals are found with indexes, so removing time depends
+ * on the number of removed triples, not on the size of the store.
+ * Individuals are freed.
+ * @param store. Store with triples.
+ * @param individuals. List with individuals to remove.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_remove_individuals(sslog_store_t *store, list_t *individuals);
+
+
 
 /**
  * @brief Gets triples that represent an individual.
@@ -128,6 +170,157 @@ list_t *sslog_store_get_individual_triples(sslog_store_t *store, sslog_individua
 sslog_triple_t* sslog_store_add_get_triple(sslog_store_t *store, sslog_triple_t *triple);
 
 
+/**
+ * @brief Saves all stored triples to the file (segment image).
+ * The file can be loaded with sslog_store_load on the next start.
+ * @param store. Store with triples.
+ * @param path. Path to the file, it is replaced if it exists.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_save(sslog_store_t *store, const char *path);
+
+
+/**
+ * @brief Loads triples from the file that was saved with sslog_store_save.
+ * The file is mapped to the memory and checked, triples are created only
+ * when they are requested. New triples are stored as usual.
+ * @param store. Empty store.
+ * @param path. Path to the file.
+ * @return SSLOG_ERROR_NO on success or error code otherwise
+ * (SSLOG_ERROR_ALREADY_EXISTS if the store is not empty).
+ */
+int sslog_store_load(sslog_store_t *store, const char *path);
+
+
+/**
+ * @brief Compacts triples into the immutable part of the store.
+ * Triples that are matched to templates are moved from the hash indexes
+ * to the sorted arrays (segment), queries work with them as usual.
+ * Triples that are linked to entities are kept, other moved triples are freed
+ * and created again when queries return them, so pointers to such triples
+ * (and their values) that were got before freezing can't be used after the end
+ * of the read section of the thread. Freezing waits for the end of read sections of other threads.
+ * @param store. Store with triples.
+ * @param triples_templates. Templates of triples to freeze, NULL or empty list - all triples.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_freeze(sslog_store_t *store, list_t *triples_templates);
+
+
+/**
+ * @brief Sets the generated ontology of the store.
+ * Classes and properties of the ontology are found with its perfect hash,
+ * schema triples are attached as the segment of the store without copying.
+ * @param store. Empty store.
+ * @param ontology. Generated ontology, it must be valid while the store is used.
+ * @return SSLOG_ERROR_NO on success or error code otherwise
+ * (SSLOG_ERROR_ALREADY_EXISTS if the store is not empty or it has other ontology).
+ */
+int sslog_store_set_ontology(sslog_store_t *store, const sslog_ontology_t *ontology);
+
+
+/**
+ * @brief Sets the memory limit of the store.
+ * If stored records use more memory, then least recently used subjects are evicted:
+ * their triples are removed, except triples of classes, properties and
+ * rdf:type triples of created individuals and pinned subjects.
+ * Evicted subjects are marked (see sslog_store_is_evicted), so their triples can be got
+ * again from the smart space. Evicted triples are freed after the end of read sections
+ * that can see them (see sslog_store_begin_read).
+ * @param store. Store with triples.
+ * @param max_bytes. Maximum size of stored records, 0 - no limits.
+ */
+void sslog_store_set_memory_limit(sslog_store_t *store, size_t max_bytes);
+
+
+/**
+ * @brief Gets number of evictions of subjects.
+ * @param store. Store with triples.
+ * @return number of evicted subjects since the store was created.
+ */
+unsigned long sslog_store_get_evicted_count(sslog_store_t *store);
+
+
+/**
+ * @brief Pins or unpins the subject, pinned subjects are not evicted.
+ * Pins are counted, so each pin must be released.
+ * @param store. Store with triples.
+ * @param uri. URI of the subject.
+ * @param is_pinned. True to pin the subject, false to release the pin.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_pin_subject(sslog_store_t *store, const char *uri, bool is_pinned);
+
+
+/**
+ * @brief Checks if triples of the subject were evicted and they are not got again.
+ * Only subjects with kept triples (individuals) are marked.
+ * @param store. Store with triples.
+ * @param uri. URI of the subject.
+ * @return true if the subject is evicted, false otherwise.
+ */
+bool sslog_store_is_evicted(sslog_store_t *store, const char *uri);
+
+
+/**
+ * @brief Removes the mark of eviction, when triples of the subject are got again.
+ * @param store. Store with triples.
+ * @param uri. URI of the subject.
+ */
+void sslog_store_reset_evicted(sslog_store_t *store, const char *uri);
+
+
+/**
+ * @brief Begins the read section of the current thread.
+ * Queries of the thread see the snapshot of the store at the beginning of the section
+ * and own changes of the thread. Triples, values and entities that are got
+ * in the section are not freed until its end, even if they are removed or evicted
+ * by other threads. Sections can be nested, each section must be ended.
+ * @param store. Store with triples.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_begin_read(sslog_store_t *store);
+
+
+/**
+ * @brief Ends the read section of the current thread (see sslog_store_begin_read).
+ * Removed data that was kept for the section is freed.
+ * @param store. Store with triples.
+ */
+void sslog_store_end_read(sslog_store_t *store);
+
+
+/**
+ * @brief Gets the version of the store.
+ * Version is increased on each adding and removing of triples,
+ * so equal versions mean that the store is not changed.
+ * @param store. Store with triples.
+ * @return version of the store.
+ */
+unsigned long sslog_store_get_version(sslog_store_t *store);
+
+
+/**
+ * @brief Gets the generation of the subject.
+ * Generation is the store version of the last change of triples with the subject,
+ * it is never decreased and it is always increased when the subject is changed.
+ * Generation can be increased without changes of the subject
+ * (when all triples of some subject or frozen triples are removed).
+ * @param store. Store with triples.
+ * @param uri. URI of the subject.
+ * @return generation of the subject.
+ */
+unsigned long sslog_store_get_generation(sslog_store_t *store, const char *uri);
+
+
+/**
+ * @brief Gets statistics of the filter that is used to skip searching of absent subjects.
+ * @param store. Store with triples.
+ * @param stats. Structure to fill.
+ */
+void sslog_store_get_filter_stats(sslog_store_t *store, sslog_store_filter_stats_t *stats);
+
+
 
 void repo_add(sslog_triple_t *triple);
 void repo_del(sslog_triple_t *triple);
@@ -0,0 +1,215 @@
+/**
+ * @file   triplestore_filter.c
+ * @brief  Blocked Bloom filter of the triple-store.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Filter answers whether the store can contain triples with the subject
+ * or with the pair (subject, predicate). Negative answer is exact, so
+ * the store skips index probes and the segment search for such templates.
+ * The high part of the hash selects a block, other bits of the mixed hash
+ * select SSLOG_STORE_FILTER_HASHES bits in the block.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "triplestore_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils/errors.h"
+#include "utils/errors_internal.h"
+
+
+/******************************************************************************/
+/*************************** Static functions list ****************************/
+static uint64_t *sslog_store_filter_block(const sslog_store_filter_t *filter, uint64_t hash);
+
+
+
+/******************************************************************************/
+/****************************** Implementations *******************************/
+/*************************** Internal functions *******************************/
+/// @cond INTERNAL_FUNCTIONS
+int sslog_store_filter_init(sslog_store_filter_t *filter, int values_count)
+{
+    uint32_t blocks_count = SSLOG_STORE_FILTER_MIN_BLOCKS;
+    uint64_t bits_count = (uint64_t) values_count * SSLOG_STORE_FILTER_BITS_PER_VALUE;
+
+    while ((uint64_t) blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS * 64 < bits_count) {
+        blocks_count *= 2;
+    }
+
+    uint64_t *blocks = (uint64_t *) calloc(blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS, sizeof(uint64_t));
+
+    if (blocks == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    filter->blocks = blocks;
+    filter->blocks_count = blocks_count;
+    filter->values_count = 0;
+    filter->removed_count = 0;
+
+    return SSLOG_ERROR_NO;
+}
+
+
+int sslog_store_filter_load(sslog_store_filter_t *filter, const void *blocks, uint32_t blocks_count, int values_count)
+{
+    size_t size = (size_t) blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS * sizeof(uint64_t);
+    uint64_t *copy = (uint64_t *) malloc(size);
+
+    if (copy == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    // Bits are copied as they are, values are not hashed again.
+    memcpy(copy, blocks, size);
+
+    filter->blocks = copy;
+    filter->blocks_count = blocks_count;
+    filter->values_count = values_count;
+    filter->removed_count = 0;
+
+    return SSLOG_ERROR_NO;
+}
+
+
+void sslog_store_filter_free(sslog_store_filter_t *filter)
+{
+    free(filter->blocks);
+
+    filter->blocks = NULL;
+    filter->blocks_count = 0;
+}
+
+
+uint64_t sslog_store_filter_hash(const char *subject, const char *predicate)
+{
+    // FNV-1a (64 bits), the pair is hashed with a separator.
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const unsigned char *c = (const unsigned char *) subject; *c != '\0'; ++c) {
+        hash = (hash ^ *c) * 1099511628211ULL;
+    }
+
+    if (predicate != NULL) {
+        hash = (hash ^ 0xff) * 1099511628211ULL;
+
+        for (const unsigned char *c = (const unsigned char *) predicate; *c != '\0'; ++c) {
+            hash = (hash ^ *c) * 1099511628211ULL;
+        }
+    }
+
+    // Last bytes change only low bits of FNV, so bits are mixed (finalizer of MurmurHash3).
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+
+void sslog_store_filter_add(sslog_store_filter_t *filter, uint64_t hash)
+{
+    ++filter->values_count;
+
+    if (filter->blocks == NULL) {
+        return;
+    }
+
+    uint64_t *block = sslog_store_filter_block(filter, hash);
+    uint64_t bits = hash * 0x9e3779b97f4a7c15ULL;
+
+    for (int i = 0; i < SSLOG_STORE_FILTER_HASHES; ++i) {
+        unsigned int bit = (unsigned int) (bits & (SSLOG_STORE_FILTER_BLOCK_WORDS * 64 - 1));
+
+        block[bit / 64] |= (uint64_t) 1 << (bit % 64);
+        bits >>= 9;
+    }
+}
+
+
+bool sslog_store_filter_check(const sslog_store_filter_t *filter, uint64_t hash)
+{
+    // Without bits all values can be in the store.
+    if (filter->blocks == NULL) {
+        return true;
+    }
+
+    const uint64_t *block = sslog_store_filter_block(filter, hash);
+    uint64_t bits = hash * 0x9e3779b97f4a7c15ULL;
+
+    for (int i = 0; i < SSLOG_STORE_FILTER_HASHES; ++i) {
+        unsigned int bit = (unsigned int) (bits & (SSLOG_STORE_FILTER_BLOCK_WORDS * 64 - 1));
+
+        if ((block[bit / 64] & ((uint64_t) 1 << (bit % 64))) == 0) {
+            return false;
+        }
+
+        bits >>= 9;
+    }
+
+    return true;
+}
+
+
+bool sslog_store_filter_is_stale(const sslog_store_filter_t *filter)
+{
+    if (filter->blocks == NULL) {
+        return true;
+    }
+
+    uint64_t capacity = (uint64_t) filter->blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS * 64
+                        / SSLOG_STORE_FILTER_BITS_PER_VALUE;
+
+    return (filter->values_count > capacity)
+            || (filter->removed_count > SSLOG_STORE_FILTER_MIN_BLOCKS * 64
+                && filter->removed_count * 2 > filter->values_count);
+}
+
+/// @endcond
+
+
+
+/******************************************************************************/
+/***************************** Static functions *******************************/
+
+/**
+ * @brief Gets the block of the value.
+ * @param filter. Filter with blocks.
+ * @param hash. Hash of the value.
+ * @return first word of the block.
+ */
+static uint64_t *sslog_store_filter_block(const sslog_store_filter_t *filter, uint64_t hash)
+{
+    uint32_t block = (uint32_t) (hash >> 32) & (filter->blocks_count - 1);
+
+    return &filter->blocks[block * SSLOG_STORE_FILTER_BLOCK_WORDS];
+}
@@ -0,0 +1,346 @@
+/**
+ * @file   triplestore_index.c
+ * @brief  Hash indexes of the triple-store.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Index is a hash table with chains of keys. The table grows twice
+ * when number of keys exceeds number of buckets.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "triplestore_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils/errors.h"
+#include "utils/errors_internal.h"
+#include "utils/list.h"
+#include "utils/util_func.h"
+
+
+/******************************************************************************/
+/*************************** Static functions list ****************************/
+static unsigned long sslog_store_hash_string(const char *value);
+static int sslog_store_index_grow(sslog_store_index_t *index);
+static sslog_store_key_t *sslog_store_new_key(const char *value, unsigned long hash);
+static sslog_store_key_t *sslog_store_index_add_key(sslog_store_index_t *index, const char *value);
+static void sslog_store_index_remove_key(sslog_store_index_t *index, sslog_store_key_t *key);
+static void sslog_store_free_key(sslog_store_key_t *key);
+
+
+
+/******************************************************************************/
+/****************************** Implementations *******************************/
+/**************************** Internal functions ******************************/
+/// @cond DOXY_INTERNAL
+const char *sslog_store_field_value(sslog_triple_t *triple, sslog_store_field field)
+{
+    switch (field) {
+    case SSLOG_STORE_FIELD_SUBJECT:
+        return triple->subject;
+    case SSLOG_STORE_FIELD_PREDICATE:
+        return triple->predicate;
+    case SSLOG_STORE_FIELD_OBJECT:
+        return triple->object;
+    default:
+        return NULL;
+    }
+}
+
+
+int sslog_store_index_init(sslog_store_index_t *index, sslog_store_field field)
+{
+    index->field = field;
+    index->keys_count = 0;
+    index->buckets_count = SSLOG_STORE_INDEX_INITIAL_BUCKETS;
+    index->buckets = (sslog_store_key_t **) calloc(index->buckets_count, sizeof(sslog_store_key_t *));
+
+    if (index->buckets == NULL) {
+        index->buckets_count = 0;
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+void sslog_store_index_free(sslog_store_index_t *index)
+{
+    for (int i = 0; i < index->buckets_count; ++i) {
+        sslog_store_key_t *key = index->buckets[i];
+
+        while (key != NULL) {
+            sslog_store_key_t *next_key = key->next;
+            sslog_store_free_key(key);
+            key = next_key;
+        }
+    }
+
+    free(index->buckets);
+
+    index->buckets = NULL;
+    index->buckets_count = 0;
+    index->keys_count = 0;
+}
+
+
+sslog_store_key_t *sslog_store_index_get_key(sslog_store_index_t *index, const char *value)
+{
+    if (value == NULL || index->buckets_count == 0) {
+        return NULL;
+    }
+
+    unsigned long hash = sslog_store_hash_string(value);
+    sslog_store_key_t *key = index->buckets[hash % index->buckets_count];
+
+    for (; key != NULL; key = key->next) {
+        if (key->hash == hash && strcmp(key->value, value) == 0) {
+            return key;
+        }
+    }
+
+    return NULL;
+}
+
+
+int sslog_store_index_insert(sslog_store_index_t *index, sslog_store_record_t *record)
+{
+    const char *value = sslog_store_field_value(record->triple, index->field);
+
+    sslog_store_key_t *key = sslog_store_index_add_key(index, value);
+
+    if (key == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    // New records are added to the head, like in the store list.
+    list_add(&record->field_links[index->field], &key->records);
+    record->keys[index->field] = key;
+    ++key->count;
+
+    return SSLOG_ERROR_NO;
+}
+
+
+void sslog_store_index_remove(sslog_store_index_t *index, sslog_store_record_t *record)
+{
+    sslog_store_key_t *key = record->keys[index->field];
+
+    if (key == NULL) {
+        return;
+    }
+
+    list_del_init(&record->field_links[index->field]);
+    record->keys[index->field] = NULL;
+
+    if (--key->count > 0 || key->pins > 0) {
+        return;
+    }
+
+    sslog_store_index_remove_key(index, key);
+}
+
+
+int sslog_store_index_pin(sslog_store_index_t *index, const char *value, bool is_pinned)
+{
+    if (is_pinned == true) {
+        sslog_store_key_t *key = sslog_store_index_add_key(index, value);
+
+        if (key == NULL) {
+            return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        }
+
+        ++key->pins;
+
+        return SSLOG_ERROR_NO;
+    }
+
+    sslog_store_key_t *key = sslog_store_index_get_key(index, value);
+
+    if (key == NULL || key->pins == 0) {
+        return SSLOG_ERROR_NO;
+    }
+
+    if (--key->pins == 0 && key->count == 0) {
+        sslog_store_index_remove_key(index, key);
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+/// @endcond
+
+
+
+/******************************************************************************/
+/***************************** Static functions *******************************/
+
+/**
+ * @brief Gets a key with the given value, a new key is created if it is needed.
+ * @param index. Index to update.
+ * @param value. Value of the element.
+ * @return key on success or NULL otherwise.
+ */
+static sslog_store_key_t *sslog_store_index_add_key(sslog_store_index_t *index, const char *value)
+{
+    sslog_store_key_t *key = sslog_store_index_get_key(index, value);
+
+    if (key != NULL) {
+        return key;
+    }
+
+    if (index->keys_count >= index->buckets_count) {
+        sslog_store_index_grow(index);
+    }
+
+    unsigned long hash = sslog_store_hash_string(value);
+
+    key = sslog_store_new_key(value, hash);
+
+    if (key == NULL) {
+        return NULL;
+    }
+
+    int bucket = hash % index->buckets_count;
+    key->next = index->buckets[bucket];
+    index->buckets[bucket] = key;
+    ++index->keys_count;
+
+    return key;
+}
+
+
+/**
+ * @brief Removes the key from the bucket and frees it.
+ * @param index. Index to update.
+ * @param key. Key without records and pins.
+ */
+static void sslog_store_index_remove_key(sslog_store_index_t *index, sslog_store_key_t *key)
+{
+    sslog_store_key_t **key_link = &index->buckets[key->hash % index->buckets_count];
+
+    while (*key_link != NULL && *key_link != key) {
+        key_link = &(*key_link)->next;
+    }
+
+    if (*key_link == key) {
+        *key_link = key->next;
+    }
+
+    sslog_store_free_key(key);
+    --index->keys_count;
+}
+
+
+/**
+ * @brief Calculates hash of the string (FNV-1a).
+ * @param value. String to hash.
+ * @return hash value.
+ */
+static unsigned long sslog_store_hash_string(const char *value)
+{
+    unsigned long hash = 2166136261UL;
+
+    for (const unsigned char *symbol = (const unsigned char *) value; *symbol != '\0'; ++symbol) {
+        hash ^= *symbol;
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+
+
+/**
+ * @brief Makes twice more buckets and moves keys to them.
+ * If there is no memory, the index keeps old buckets.
+ * @param index. Index to grow.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_index_grow(sslog_store_index_t *index)
+{
+    int new_count = index->buckets_count * 2;
+    sslog_store_key_t **new_buckets = (sslog_store_key_t **) calloc(new_count, sizeof(sslog_store_key_t *));
+
+    if (new_buckets == NULL) {
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (int i = 0; i < index->buckets_count; ++i) {
+        sslog_store_key_t *key = index->buckets[i];
+
+        while (key != NULL) {
+            sslog_store_key_t *next_key = key->next;
+            int bucket = key->hash % new_count;
+
+            key->next = new_buckets[bucket];
+            new_buckets[bucket] = key;
+            key = next_key;
+        }
+    }
+
+    free(index->buckets);
+    index->buckets = new_buckets;
+    index->buckets_count = new_count;
+
+    return SSLOG_ERROR_NO;
+}
+
+
+static sslog_store_key_t *sslog_store_new_key(const char *value, unsigned long hash)
+{
+    sslog_store_key_t *key = (sslog_store_key_t *) malloc(sizeof(sslog_store_key_t));
+
+    if (key == NULL) {
+        return NULL;
+    }
+
+    key->value = sslog_strndup(value, strlen(value));
+
+    if (key->value == NULL) {
+        free(key);
+        return NULL;
+    }
+
+    key->hash = hash;
+    key->count = 0;
+    key->pins = 0;
+    key->is_evicted = false;
+    key->access = 0;
+    key->generation = 0;
+    key->next = NULL;
+    INIT_LIST_HEAD(&key->records);
+
+    return key;
+}
+
+
+static void sslog_store_free_key(sslog_store_key_t *key)
+{
+    free(key->value);
+    free(key);
+}
@@ -0,0 +1,740 @@
+/**
+ * @file   triplestore_internal.h
+ * @brief  Internal structures of the triple-store: records and indexes.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Each stored triple is kept in a record. The record links the triple
+ * into the list of all stored triples and into three hash indexes:
+ * by subject, by predicate and by object. An index maps a value (URI or literal)
+ * to a key, the key contains all records that have this value in the indexed element.
+ * Queries use the most selective key of a triple-template instead of the store scan.
+ *
+ * Records and rows of the segment have versions of adding and removing,
+ * so readers see the snapshot of the last completed change. Removed records
+ * and triples are freed when there are no read sections that can see them.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "triplestore.h"
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef MTENABLE
+#include <pthread.h>
+#endif
+
+#include "kpi_api.h"
+#include "utils/list.h"
+
+#ifndef _SSLOG_TRIPLESTORE_INTERNAL_H
+#define	_SSLOG_TRIPLESTORE_INTERNAL_H
+
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+
+/******************************* Definitions *********************************/
+/****************** Defines, structures, constatnts and etc.******************/
+/// @cond DOXY_INTERNAL
+
+/**
+ * @brief Locks of the store.
+ * Store is used by JNI (UI) threads and by the thread of asynchronous subscriptions.
+ * Each external function of the store takes a lock, internal (static) functions work without locks.
+ *
+ * Readers take the lock for reading and see the snapshot of the store
+ * (see sslog_store_read_snapshot). One writer makes the whole change under the write lock,
+ * but it takes the lock of readers by steps (SSLOG_STORE_WRITE_STEP changes), so readers
+ * are not blocked by a long batch and they don't see its changes until it is completed.
+ * Removed records and triples are not freed while read sections can see them,
+ * so triples that are got in a section are valid until its end (see sslog_store_begin_read).
+ */
+#ifdef MTENABLE
+#define sslog_store_lock_read(store) pthread_rwlock_rdlock(&(store)->lock)
+#define sslog_store_unlock_read(store) pthread_rwlock_unlock(&(store)->lock)
+#define sslog_store_lock_step(store) pthread_rwlock_wrlock(&(store)->lock)
+#define sslog_store_unlock_step(store) pthread_rwlock_unlock(&(store)->lock)
+#else
+#define sslog_store_lock_read(store)
+#define sslog_store_unlock_read(store)
+#define sslog_store_lock_step(store)
+#define sslog_store_unlock_step(store)
+#endif
+
+/** @brief Snapshot of the writer: the latest data, including not completed changes. */
+#define SSLOG_STORE_LATEST ULONG_MAX
+
+/** @brief Number of changes of the writer between releasing of the readers lock. */
+#define SSLOG_STORE_WRITE_STEP 64
+
+/**
+ * @brief Next value of the store clock, it is used to mark accessed subjects.
+ * Readers can mark subjects at the same time, so the clock is atomic.
+ */
+#ifdef MTENABLE
+#define sslog_store_next_clock(store) __sync_add_and_fetch(&(store)->clock, 1)
+#else
+#define sslog_store_next_clock(store) (++(store)->clock)
+#endif
+
+/**
+ * @brief Marks the subject key as accessed now (it is evicted last).
+ * Readers mark keys at the same time, so the access clock is written atomically.
+ */
+#ifdef MTENABLE
+#define sslog_store_touch_key(store, key) \
+    __atomic_store_n(&(key)->access, sslog_store_next_clock(store), __ATOMIC_RELAXED)
+#define sslog_store_key_access(key) __atomic_load_n(&(key)->access, __ATOMIC_RELAXED)
+#else
+#define sslog_store_touch_key(store, key) ((key)->access = sslog_store_next_clock(store))
+#define sslog_store_key_access(key) ((key)->access)
+#endif
+
+/**
+ * @brief Increments a counter of the store statistics.
+ * Readers count at the same time, so the counter is atomic.
+ */
+#ifdef MTENABLE
+#define sslog_store_count(counter) __sync_add_and_fetch(&(counter), 1)
+#else
+#define sslog_store_count(counter) (++(counter))
+#endif
+
+/** @brief Initial number of buckets in the index. */
+#define SSLOG_STORE_INDEX_INITIAL_BUCKETS 64
+
+/** @brief Part of the memory limit (percents) that is left after eviction. */
+#define SSLOG_STORE_EVICTION_TARGET_PERCENT 75
+
+/** @brief Number of 64-bit words in the block of the filter (one cache line). */
+#define SSLOG_STORE_FILTER_BLOCK_WORDS 8
+
+/** @brief Number of bits that are set in the block for one value. */
+#define SSLOG_STORE_FILTER_HASHES 6
+
+/** @brief Number of bits of the filter for one value. */
+#define SSLOG_STORE_FILTER_BITS_PER_VALUE 10
+
+/** @brief Minimal number of blocks in the filter. */
+#define SSLOG_STORE_FILTER_MIN_BLOCKS 16
+
+/** @brief Elements of the triple that are indexed. */
+typedef enum sslog_store_field_e {
+    SSLOG_STORE_FIELD_SUBJECT = 0,  /**< Index by subject. */
+    SSLOG_STORE_FIELD_PREDICATE,    /**< Index by predicate. */
+    SSLOG_STORE_FIELD_OBJECT,       /**< Index by object. */
+    SSLOG_STORE_FIELDS_COUNT        /**< Number of indexes. */
+} sslog_store_field;
+
+
+/**
+ * @brief Key of the index: one value of the triple element and all records with this value.
+ */
+typedef struct sslog_store_key_s {
+    char *value;                    /**< Value of the element (own copy). */
+    unsigned long hash;             /**< Hash of the value. */
+    int count;                      /**< Number of records with such value. */
+    int pins;                       /**< Number of pins, records of pinned subject are not evicted. */
+    bool is_evicted;                /**< Records of the subject are evicted and they are not got again. */
+    unsigned long access;           /**< Store clock of the last access to the subject (see sslog_store_touch_key). */
+    unsigned long generation;       /**< Store version of the last change of the subject. */
+    list_head_t records;            /**< Records, linked with sslog_store_record_s::field_links. */
+    struct sslog_store_key_s *next; /**< Next key in the bucket. */
+} sslog_store_key_t;
+
+
+/**
+ * @brief Hash index for one element of triples (subject, predicate or object).
+ */
+typedef struct sslog_store_index_s {
+    sslog_store_field field;        /**< Indexed element. */
+    sslog_store_key_t **buckets;    /**< Buckets with chains of keys. */
+    int buckets_count;              /**< Number of buckets. */
+    int keys_count;                 /**< Number of keys in the index. */
+} sslog_store_index_t;
+
+
+/**
+ * @brief Record of the stored triple.
+ * Removed record stays in the store and indexes until it is freed (see sslog_store_reclaim),
+ * readers of older snapshots can find it.
+ */
+typedef struct sslog_store_record_s {
+    sslog_triple_t *triple;                                 /**< Stored triple. */
+    unsigned long sequence;                                 /**< Order of adding to the store. */
+    unsigned long born;                                     /**< Store version of adding. */
+    unsigned long died;                                     /**< Store version of removing, 0 - not removed. */
+    list_head_t store_links;                                /**< Links in the list of all records. */
+    list_head_t dead_links;                                 /**< Links in the list of removed records. */
+    list_head_t field_links[SSLOG_STORE_FIELDS_COUNT];      /**< Links in the keys of indexes. */
+    sslog_store_key_t *keys[SSLOG_STORE_FIELDS_COUNT];      /**< Keys that contain the record. */
+} sslog_store_record_t;
+
+
+/** @brief Magic bytes of the store segment. */
+#define SSLOG_STORE_SEGMENT_MAGIC "SSLOGSEG"
+
+/** @brief Length of the magic bytes. */
+#define SSLOG_STORE_SEGMENT_MAGIC_LEN 8
+
+/** @brief Version of the segment format. */
+#define SSLOG_STORE_SEGMENT_VERSION 2
+
+
+/**
+ * @brief Header of the store segment.
+ * All offsets are from the start of the segment, so the segment
+ * can be mapped to any address. Only the header is checked on opening
+ * (checksum and bounds of sections), rows and terms are trusted.
+ */
+typedef struct sslog_store_segment_header_s {
+    char magic[SSLOG_STORE_SEGMENT_MAGIC_LEN];  /**< SSLOG_STORE_SEGMENT_MAGIC. */
+    uint32_t version;                           /**< SSLOG_STORE_SEGMENT_VERSION. */
+    uint32_t terms_count;                       /**< Number of terms in the dictionary. */
+    uint32_t rows_count;                        /**< Number of triples. */
+    uint32_t pool_size;                         /**< Size of the strings pool. */
+    uint32_t terms_offset;                      /**< Offsets of terms in the pool (sorted by value). */
+    uint32_t rows_offset;                       /**< Triples sorted by subject, predicate, object. */
+    uint32_t orders_offsets[SSLOG_STORE_FIELDS_COUNT];  /**< Rows ordered by element (no order for subject). */
+    uint32_t indexes_offsets[SSLOG_STORE_FIELDS_COUNT]; /**< First position of each term in the order. */
+    uint32_t pool_offset;                       /**< Strings pool. */
+    uint32_t filter_offset;                     /**< Blocks of the filter of rows (aligned to 8 bytes). */
+    uint32_t filter_blocks_count;               /**< Number of blocks of the filter. */
+    uint32_t filter_values_count;               /**< Number of values in the filter. */
+    uint32_t size;                              /**< Size of the image. */
+    uint32_t checksum;                          /**< FNV-1a of the header with zero checksum. */
+} sslog_store_segment_header_t;
+
+
+/**
+ * @brief Triple of the segment: identifiers of terms and types.
+ */
+typedef struct sslog_store_segment_row_s {
+    uint32_t terms[SSLOG_STORE_FIELDS_COUNT];   /**< Terms of subject, predicate and object. */
+    uint8_t subject_type;                       /**< Type of the subject. */
+    uint8_t object_type;                        /**< Type of the object. */
+    uint16_t reserved;                          /**< Alignment. */
+} sslog_store_segment_row_t;
+
+
+/**
+ * @brief Immutable part of the store: sorted triples with dictionary of terms.
+ *
+ * For each element (subject, predicate, object) rows are available in the order
+ * of the element terms and for each term there is a position of its first row
+ * (CSR-like adjacency), so all triples with some term are in one range.
+ * Rows are materialized to regular triples only when they are returned by queries.
+ * Removed rows are marked with the store version of removing and skipped
+ * by newer snapshots. Arrays of materialized triples and marks
+ * are allocated on the first materializing and removing.
+ */
+typedef struct sslog_store_segment_s {
+    void *data;                                 /**< Segment image (mapped file or memory). */
+    size_t size;                                /**< Size of the image. */
+    bool is_mapped;                             /**< Image is a mapped file. */
+    bool is_static;                             /**< Image is static data (generated ontology), it is not freed. */
+    const sslog_store_segment_header_t *header; /**< Header of the image. */
+    const uint32_t *terms;                      /**< Offsets of terms in the pool. */
+    const sslog_store_segment_row_t *rows;      /**< Rows in the order of subjects. */
+    const uint32_t *orders[SSLOG_STORE_FIELDS_COUNT];   /**< Rows identifiers in the order of element, NULL for subject. */
+    const uint32_t *indexes[SSLOG_STORE_FIELDS_COUNT];  /**< First position of term in the order (terms_count + 1). */
+    const char *pool;                           /**< Strings pool. */
+    sslog_triple_t **triples;                   /**< Materialized triples of rows, can be NULL. */
+    unsigned long *removed;                     /**< Versions of removing rows (0 - not removed), can be NULL. */
+    unsigned long born;                         /**< Store version of attaching the segment. */
+    int live_count;                             /**< Number of not removed rows. */
+} sslog_store_segment_t;
+
+
+/**
+ * @brief Blocked Bloom filter over subjects and pairs (subject, predicate).
+ * All bits of one value are in one block, so the check reads one cache line.
+ * Bits are not cleared on removing, the filter is rebuilt when
+ * many values are removed or it is overfilled.
+ */
+typedef struct sslog_store_filter_s {
+    uint64_t *blocks;               /**< Bits of the filter, can be NULL (no filter). */
+    uint32_t blocks_count;          /**< Number of blocks, power of two. */
+    int values_count;               /**< Number of added values. */
+    int removed_count;              /**< Number of removed values, their bits are set. */
+    unsigned long checks;           /**< Number of checks. */
+    unsigned long negatives;        /**< Number of checks without the value. */
+    unsigned long false_positives;  /**< Number of positive checks without records. */
+    unsigned long rebuilds;         /**< Number of rebuilds. */
+} sslog_store_filter_t;
+
+
+/**
+ * @brief Removed triple that is freed later: a replaced triple or a materialized triple of the row.
+ */
+typedef struct sslog_store_garbage_s {
+    sslog_triple_t *triple;         /**< Replaced triple, NULL for the row. */
+    uint32_t row;                   /**< Removed row of the segment. */
+    unsigned long died;             /**< Store version of removing. */
+    list_head_t links;              /**< Links in the garbage of the store. */
+} sslog_store_garbage_t;
+
+
+/**
+ * @brief Read section of the thread (see sslog_store_begin_read).
+ */
+typedef struct sslog_store_reader_s {
+    sslog_store_t *store;               /**< Store of the section. */
+    unsigned long oldest;               /**< Snapshot of the beginning, its data is not freed. */
+    unsigned long snapshot;             /**< Snapshot of queries, it is moved by own changes of the thread. */
+    int depth;                          /**< Number of nested sections. */
+    list_head_t links;                  /**< Links in the readers of the store. */
+    struct sslog_store_reader_s *next;  /**< Next section of the thread (with other store). */
+} sslog_store_reader_t;
+
+
+/**
+ * @brief Triple-store structure.
+ */
+struct sslog_store_s {
+    list_head_t records;                                    /**< All records, newest first. */
+    int triples_count;                                      /**< Number of stored triples. */
+    unsigned long sequence;                                 /**< Sequence for the next record. */
+    sslog_store_index_t indexes[SSLOG_STORE_FIELDS_COUNT];  /**< Indexes by triple elements. */
+    sslog_store_segment_t *segment;                         /**< Immutable part of the store, can be NULL. */
+    const sslog_ontology_t *ontology;                       /**< Generated ontology of the store, can be NULL. */
+    size_t memory_size;                                     /**< Estimated memory of records and their triples. */
+    size_t memory_limit;                                    /**< Limit of the memory, 0 - no limits. */
+    unsigned long clock;                                    /**< Clock to mark accessed subjects. */
+    unsigned long evicted_count;                            /**< Number of evicted subjects. */
+    unsigned long version;                                  /**< Version, it is increased on each change. */
+    unsigned long published;                                /**< Version of the last completed change (snapshot of readers). */
+    unsigned long reclaimed;                                /**< Removed data of this and older versions is freed. */
+    unsigned long removed_generation;                       /**< Generation of subjects without keys. */
+    sslog_store_filter_t filter;                            /**< Filter of subjects and pairs (subject, predicate). */
+    list_head_t dead_records;                               /**< Removed records that are not freed, oldest first. */
+    list_head_t garbage;                                    /**< Removed triples that are not freed, oldest first. */
+    list_head_t readers;                                    /**< Active read sections. */
+    int exclusive_count;                                    /**< Number of writers that wait for the end of sections. */
+#ifdef MTENABLE
+    pthread_rwlock_t lock;                                  /**< Lock for readers and one step of the writer. */
+    pthread_mutex_t write_lock;                             /**< Lock of the writer for the whole change. */
+    pthread_mutex_t readers_lock;                           /**< Lock of read sections and of published version. */
+    pthread_cond_t readers_changed;                         /**< Section is ended or exclusive change is done. */
+#endif
+};
+
+
+/**
+ * @brief Gets a record from the index links.
+ * @param links. Links of the record in the key.
+ * @param field. Indexed element, that is used for links.
+ * @return record.
+ */
+static inline sslog_store_record_t *sslog_store_record_from_links(list_head_t *links, sslog_store_field field)
+{
+    return (sslog_store_record_t *) ((char *) links - offsetof(sslog_store_record_t, field_links)
+                                     - field * sizeof(list_head_t));
+}
+
+
+/**
+ * @brief Gets an order of the record in the store.
+ * Records are added after the segment, so they are newer than rows
+ * (order of the row is its identifier).
+ * @param store. Store with the record.
+ * @param record. Record.
+ * @return order of the record.
+ */
+static inline unsigned long sslog_store_record_order(sslog_store_t *store, sslog_store_record_t *record)
+{
+    unsigned long rows_count = (store->segment == NULL) ? 0 : store->segment->header->rows_count;
+
+    return rows_count + record->sequence;
+}
+
+
+/**
+ * @brief Checks whether data with given versions is in the snapshot.
+ * @param born. Version of adding.
+ * @param died. Version of removing, 0 - not removed.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for the writer.
+ * @return true if data is added before the snapshot and it is not removed in it, false otherwise.
+ */
+static inline bool sslog_store_is_visible(unsigned long born, unsigned long died, unsigned long snapshot)
+{
+    return (born <= snapshot && (died == 0 || died > snapshot)) ? true : false;
+}
+
+
+/**
+ * @brief Checks whether the record is in the snapshot.
+ * @param record. Record.
+ * @param snapshot. Version of the snapshot.
+ * @return true if the record is visible, false otherwise.
+ */
+static inline bool sslog_store_record_is_visible(const sslog_store_record_t *record, unsigned long snapshot)
+{
+    return sslog_store_is_visible(record->born, record->died, snapshot);
+}
+
+
+/**
+ * @brief Checks whether the row of the segment is removed in the latest data.
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @return true if the row is removed, false otherwise.
+ */
+static inline bool sslog_store_segment_is_removed(const sslog_store_segment_t *segment, uint32_t row)
+{
+    return (segment->removed != NULL && segment->removed[row] != 0) ? true : false;
+}
+
+
+/**
+ * @brief Checks whether the row of the segment is in the snapshot.
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @param snapshot. Version of the snapshot.
+ * @return true if the row is visible, false otherwise.
+ */
+static inline bool sslog_store_segment_is_visible(const sslog_store_segment_t *segment, uint32_t row, unsigned long snapshot)
+{
+    return sslog_store_is_visible(segment->born, (segment->removed == NULL) ? 0 : segment->removed[row], snapshot);
+}
+
+
+/**
+ * @brief Gets the materialized triple of the row without materializing.
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @return triple or NULL if the row is not materialized.
+ */
+static inline sslog_triple_t *sslog_store_segment_row_triple(const sslog_store_segment_t *segment, uint32_t row)
+{
+    return (segment->triples == NULL) ? NULL : segment->triples[row];
+}
+
+
+/******************************* Definitions *********************************/
+/**************************** Internal functions *****************************/
+
+/**
+ * @brief Gets a value of the triple element.
+ * @param triple. Triple to get value.
+ * @param field. Element of the triple.
+ * @return value of the element.
+ */
+const char *sslog_store_field_value(sslog_triple_t *triple, sslog_store_field field);
+
+
+/**
+ * @brief Gets the snapshot of the reader, the store must be locked.
+ * It is the snapshot of the read section of the thread or the last completed change.
+ * @param store. Store with triples.
+ * @return version of the snapshot.
+ */
+unsigned long sslog_store_read_snapshot(sslog_store_t *store);
+
+
+/**
+ * @brief Initializes an empty index.
+ * @param index. Index to initialize.
+ * @param field. Element of triples to index.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_index_init(sslog_store_index_t *index, sslog_store_field field);
+
+
+/**
+ * @brief Frees all keys and buckets of the index.
+ * Records are not freed, they are owned by the store.
+ * @param index. Index to free.
+ */
+void sslog_store_index_free(sslog_store_index_t *index);
+
+
+/**
+ * @brief Finds a key with the given value.
+ * @param index. Index to search.
+ * @param value. Value of the element.
+ * @return key on success or NULL if there is no records with such value.
+ */
+sslog_store_key_t *sslog_store_index_get_key(sslog_store_index_t *index, const char *value);
+
+
+/**
+ * @brief Links a record into the index.
+ * Creates a new key if it is needed.
+ * @param index. Index to update.
+ * @param record. Record to link.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_index_insert(sslog_store_index_t *index, sslog_store_record_t *record);
+
+
+/**
+ * @brief Pins or unpins the value of the index.
+ * Key of the pinned value is not freed without records.
+ * @param index. Index to update.
+ * @param value. Value to pin.
+ * @param is_pinned. Pin (true) or unpin (false) the value.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_index_pin(sslog_store_index_t *index, const char *value, bool is_pinned);
+
+
+/**
+ * @brief Unlinks a record from the index.
+ * The key is freed when it has no more records and pins.
+ * @param index. Index to update.
+ * @param record. Record to unlink.
+ */
+void sslog_store_index_remove(sslog_store_index_t *index, sslog_store_record_t *record);
+
+
+/**
+ * @brief Initializes an empty filter for the given number of values.
+ * @param filter. Filter to initialize, statistics are not changed.
+ * @param values_count. Expected number of values.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_filter_init(sslog_store_filter_t *filter, int values_count);
+
+
+/**
+ * @brief Frees bits of the filter.
+ * @param filter. Filter to free.
+ */
+void sslog_store_filter_free(sslog_store_filter_t *filter);
+
+
+/**
+ * @brief Gets a hash of the subject or of the pair (subject, predicate).
+ * @param subject. Subject.
+ * @param predicate. Predicate or NULL to get the hash of the subject.
+ * @return hash.
+ */
+uint64_t sslog_store_filter_hash(const char *subject, const char *predicate);
+
+
+/**
+ * @brief Adds the value to the filter.
+ * @param filter. Filter to update.
+ * @param hash. Hash of the value.
+ */
+void sslog_store_filter_add(sslog_store_filter_t *filter, uint64_t hash);
+
+
+/**
+ * @brief Checks the value.
+ * @param filter. Filter to check.
+ * @param hash. Hash of the value.
+ * @return false if the value is not added, true if it can be added.
+ */
+bool sslog_store_filter_check(const sslog_store_filter_t *filter, uint64_t hash);
+
+
+/**
+ * @brief Initializes the filter with a copy of blocks.
+ * @param filter. Filter to initialize, statistics are not changed.
+ * @param blocks. Blocks of the filter (can be unaligned).
+ * @param blocks_count. Number of blocks, power of two.
+ * @param values_count. Number of values in the blocks.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_filter_load(sslog_store_filter_t *filter, const void *blocks, uint32_t blocks_count, int values_count);
+
+
+/**
+ * @brief Checks whether the filter needs the rebuilding.
+ * @param filter. Filter to check.
+ * @return true if many values are removed or the filter is overfilled, false otherwise.
+ */
+bool sslog_store_filter_is_stale(const sslog_store_filter_t *filter);
+
+
+/**
+ * @brief Builds a segment image from triples.
+ * Duplicates are removed, triples are not changed.
+ * The filter of rows is built and stored in the image.
+ * @param triples. Array of triples.
+ * @param count. Number of triples.
+ * @param data. Returns the image (must be freed with free()).
+ * @param size. Returns size of the image.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_segment_build(const sslog_triple_t *triples, int count, void **data, size_t *size);
+
+
+/**
+ * @brief Creates a segment from the image.
+ * Only the header is validated (checksum and bounds of sections),
+ * the image is not parsed or copied. The segment owns the image after success.
+ * @param data. Image of the segment.
+ * @param size. Size of the image.
+ * @param is_mapped. Image is a mapped file (unmapped on free) or memory (freed on free).
+ * @return segment on success or NULL otherwise.
+ */
+sslog_store_segment_t *sslog_store_segment_new(void *data, size_t size, bool is_mapped);
+
+
+/**
+ * @brief Maps a segment file to the memory.
+ * Besides the header, all identifiers, offsets and positions of the image
+ * are checked once, so a damaged file is not opened.
+ * @param path. Path to the file.
+ * @return segment on success or NULL otherwise.
+ */
+sslog_store_segment_t *sslog_store_segment_open(const char *path);
+
+
+/**
+ * @brief Writes the segment image to the file.
+ * The image is written to the temporary file, that replaces the given file.
+ * @param data. Image of the segment.
+ * @param size. Size of the image.
+ * @param path. Path to the file.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_segment_write(const void *data, size_t size, const char *path);
+
+
+/**
+ * @brief Frees the segment and its image.
+ * Materialized triples are not freed, they are owned by the store.
+ * @param segment. Segment to free.
+ */
+void sslog_store_segment_free(sslog_store_segment_t *segment);
+
+
+/**
+ * @brief Finds an identifier of the term.
+ * @param segment. Segment to search.
+ * @param value. Value of the term.
+ * @return identifier of the term or -1 if there is no such term.
+ */
+long sslog_store_segment_find_term(const sslog_store_segment_t *segment, const char *value);
+
+
+/**
+ * @brief Selects the shortest range of rows for the template.
+ * @param segment. Segment to search.
+ * @param values. Values of elements, NULL for any value.
+ * @param terms. Returns identifiers of bound elements (-1 for not bound).
+ * @param field. Returns element of the range order (-1 for all rows).
+ * @param begin. Returns first position of the range.
+ * @param end. Returns position after the range.
+ * @return true if the range is not empty, false otherwise.
+ */
+bool sslog_store_segment_plan(const sslog_store_segment_t *segment, const char *values[SSLOG_STORE_FIELDS_COUNT],
+                              long terms[SSLOG_STORE_FIELDS_COUNT], int *field, uint32_t *begin, uint32_t *end);
+
+
+/**
+ * @brief Gets a row identifier by the position in the order of element.
+ * @param segment. Segment.
+ * @param field. Element of the order (-1 for all rows).
+ * @param position. Position in the order.
+ * @return row identifier.
+ */
+uint32_t sslog_store_segment_row_at(const sslog_store_segment_t *segment, int field, uint32_t position);
+
+
+/**
+ * @brief Fills the triple with values of the row without copying.
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @param data. Triple to fill, values point to the segment pool.
+ */
+void sslog_store_segment_row_data(const sslog_store_segment_t *segment, uint32_t row, sslog_triple_t *data);
+
+
+/**
+ * @brief Finds a row equal to the triple in the snapshot.
+ * @param segment. Segment to search.
+ * @param triple. Triple to find.
+ * @param snapshot. Version of the snapshot, SSLOG_STORE_LATEST for not removed rows.
+ * @return row identifier or -1 if there is no such row.
+ */
+long sslog_store_segment_find_row(const sslog_store_segment_t *segment, sslog_triple_t *triple, unsigned long snapshot);
+
+
+/**
+ * @brief Gets a triple of the row.
+ * The triple is created on the first access and is marked as stored.
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @return triple on success or NULL otherwise.
+ */
+sslog_triple_t *sslog_store_segment_get_triple(sslog_store_segment_t *segment, uint32_t row);
+
+
+/**
+ * @brief Gets the array of materialized triples, it is allocated on the first call.
+ * @param segment. Segment.
+ * @return array with a triple (or NULL) for each row on success or NULL otherwise.
+ */
+sslog_triple_t **sslog_store_segment_init_triples(sslog_store_segment_t *segment);
+
+
+/**
+ * @brief Allocates marks for removed rows, if they are not allocated.
+ * It is called before removing rows, so removing is not failed in the middle.
+ * @param segment. Segment.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+int sslog_store_segment_init_removed(sslog_store_segment_t *segment);
+
+
+/**
+ * @brief Marks the row as removed, marks must be allocated.
+ * Materialized triple of the row is kept for older snapshots, it is freed by the store.
+ * @see sslog_store_segment_init_removed
+ * @param segment. Segment.
+ * @param row. Row identifier.
+ * @param version. Store version of removing.
+ */
+void sslog_store_segment_remove_row(sslog_store_segment_t *segment, uint32_t row, unsigned long version);
+
+
+/**
+ * @brief Evaluates conjunctive triples patterns over the store.
+ * @param store. Store with triples.
+ * @param patterns. Triples-patterns.
+ * @param max_rows_count. Maximum number of rows, negative value - no limits.
+ * @return result on success or NULL otherwise.
+ * @see sslog_session_select
+ */
+sslog_sparql_result_t *sslog_store_select(sslog_store_t *store, list_t *patterns, int max_rows_count);
+
+/// @endcond
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif	/* _SSLOG_TRIPLESTORE_INTERNAL_H */
@@ -0,0 +1,832 @@
+/**
+ * @file   triplestore_segment.c
+ * @brief  Immutable segment of the triple-store.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Segment is a position-independent image of triples:
+ * header, sorted dictionary of terms, triples (rows) as identifiers of terms
+ * sorted by subject, predicate and object, rows grouped by predicate and by object,
+ * positions of the first row for each term, the filter of rows and the pool with strings.
+ * The image can be written to a file and mapped back without parsing.
+ * Images that are built in memory and generated schemas are checked by the header,
+ * mapped files are also checked once by all identifiers, offsets and positions,
+ * so a damaged file is not opened instead of reading out of its bounds.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "triplestore_internal.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "triple_internal.h"
+
+#include "utils/errors.h"
+#include "utils/errors_internal.h"
+#include "utils/util_func.h"
+
+
+/******************************************************************************/
+/*************************** Static functions list ****************************/
+static int sslog_store_segment_compare_terms(const void *a, const void *b);
+static int sslog_store_segment_compare_rows(const void *a, const void *b);
+static long sslog_store_segment_find_sorted_term(const char **terms, uint32_t terms_count, const char *value);
+static void sslog_store_segment_group_rows(const sslog_store_segment_row_t *rows, uint32_t rows_count, uint32_t terms_count,
+                                           sslog_store_field field, uint32_t *order, uint32_t *index);
+static bool sslog_store_segment_check_section(uint64_t offset, uint64_t size, size_t segment_size);
+static bool sslog_store_segment_check_body(const sslog_store_segment_t *segment);
+static uint32_t sslog_store_segment_checksum(const sslog_store_segment_header_t *header);
+
+
+
+/******************************************************************************/
+/****************************** Implementations *******************************/
+/**************************** Internal functions ******************************/
+/// @cond DOXY_INTERNAL
+int sslog_store_segment_build(const sslog_triple_t *triples, int count, void **data, size_t *size)
+{
+    *data = NULL;
+    *size = 0;
+
+    uint32_t rows_count = (count < 0) ? 0 : (uint32_t) count;
+
+    // Dictionary: all values of elements, sorted and without duplicates.
+    const char **terms = (const char **) malloc((rows_count * SSLOG_STORE_FIELDS_COUNT + 1) * sizeof(char *));
+    sslog_store_segment_row_t *rows = (sslog_store_segment_row_t *) malloc((rows_count + 1) * sizeof(sslog_store_segment_row_t));
+
+    if (terms == NULL || rows == NULL) {
+        free(terms);
+        free(rows);
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    uint32_t terms_count = 0;
+
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        terms[terms_count++] = triples[i].subject;
+        terms[terms_count++] = triples[i].predicate;
+        terms[terms_count++] = triples[i].object;
+    }
+
+    qsort(terms, terms_count, sizeof(char *), sslog_store_segment_compare_terms);
+
+    uint32_t unique_count = 0;
+
+    for (uint32_t i = 0; i < terms_count; ++i) {
+        if (unique_count == 0 || strcmp(terms[unique_count - 1], terms[i]) != 0) {
+            terms[unique_count++] = terms[i];
+        }
+    }
+
+    terms_count = unique_count;
+
+    // Rows are sorted by identifiers, the order of identifiers is the order of values.
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        rows[i].terms[SSLOG_STORE_FIELD_SUBJECT] = (uint32_t) sslog_store_segment_find_sorted_term(terms, terms_count, triples[i].subject);
+        rows[i].terms[SSLOG_STORE_FIELD_PREDICATE] = (uint32_t) sslog_store_segment_find_sorted_term(terms, terms_count, triples[i].predicate);
+        rows[i].terms[SSLOG_STORE_FIELD_OBJECT] = (uint32_t) sslog_store_segment_find_sorted_term(terms, terms_count, triples[i].object);
+        rows[i].subject_type = (uint8_t) triples[i].subject_type;
+        rows[i].object_type = (uint8_t) triples[i].object_type;
+        rows[i].reserved = 0;
+    }
+
+    qsort(rows, rows_count, sizeof(sslog_store_segment_row_t), sslog_store_segment_compare_rows);
+
+    unique_count = 0;
+
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        if (unique_count == 0 || sslog_store_segment_compare_rows(&rows[unique_count - 1], &rows[i]) != 0) {
+            rows[unique_count++] = rows[i];
+        }
+    }
+
+    rows_count = unique_count;
+
+    uint64_t pool_size = 0;
+
+    for (uint32_t i = 0; i < terms_count; ++i) {
+        pool_size += strlen(terms[i]) + 1;
+    }
+
+    // Filter is stored in the image, so the store does not hash all rows on loading.
+    sslog_store_filter_t filter;
+
+    if (sslog_store_filter_init(&filter, 2 * rows_count) != SSLOG_ERROR_NO) {
+        free(terms);
+        free(rows);
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        const char *subject = terms[rows[i].terms[SSLOG_STORE_FIELD_SUBJECT]];
+        const char *predicate = terms[rows[i].terms[SSLOG_STORE_FIELD_PREDICATE]];
+
+        sslog_store_filter_add(&filter, sslog_store_filter_hash(subject, NULL));
+        sslog_store_filter_add(&filter, sslog_store_filter_hash(subject, predicate));
+    }
+
+    uint64_t filter_size = (uint64_t) filter.blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS * sizeof(uint64_t);
+
+    // Layout: header, terms, rows, orders, indexes, filter, pool.
+    sslog_store_segment_header_t header;
+    memset(&header, 0, sizeof(sslog_store_segment_header_t));
+    memcpy(header.magic, SSLOG_STORE_SEGMENT_MAGIC, SSLOG_STORE_SEGMENT_MAGIC_LEN);
+
+    header.version = SSLOG_STORE_SEGMENT_VERSION;
+    header.terms_count = terms_count;
+    header.rows_count = rows_count;
+    header.pool_size = (uint32_t) pool_size;
+
+    uint64_t offset = sizeof(sslog_store_segment_header_t);
+
+    header.terms_offset = (uint32_t) offset;
+    offset += (uint64_t) terms_count * sizeof(uint32_t);
+
+    header.rows_offset = (uint32_t) offset;
+    offset += (uint64_t) rows_count * sizeof(sslog_store_segment_row_t);
+
+    for (int field = SSLOG_STORE_FIELD_PREDICATE; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        header.orders_offsets[field] = (uint32_t) offset;
+        offset += (uint64_t) rows_count * sizeof(uint32_t);
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        header.indexes_offsets[field] = (uint32_t) offset;
+        offset += (uint64_t) (terms_count + 1) * sizeof(uint32_t);
+    }
+
+    offset = (offset + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t);
+
+    header.filter_offset = (uint32_t) offset;
+    header.filter_blocks_count = filter.blocks_count;
+    header.filter_values_count = (uint32_t) filter.values_count;
+    offset += filter_size;
+
+    header.pool_offset = (uint32_t) offset;
+    offset += pool_size;
+
+    if (offset > UINT32_MAX) {
+        sslog_store_filter_free(&filter);
+        free(terms);
+        free(rows);
+        return SSLOG_ERROR_INCORRECT_ARGUMENT;
+    }
+
+    header.size = (uint32_t) offset;
+    header.checksum = sslog_store_segment_checksum(&header);
+
+    char *image = (char *) calloc(1, (size_t) offset);
+
+    if (image == NULL) {
+        sslog_store_filter_free(&filter);
+        free(terms);
+        free(rows);
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    memcpy(image, &header, sizeof(sslog_store_segment_header_t));
+    memcpy(image + header.rows_offset, rows, rows_count * sizeof(sslog_store_segment_row_t));
+    memcpy(image + header.filter_offset, filter.blocks, (size_t) filter_size);
+
+    sslog_store_filter_free(&filter);
+
+    uint32_t *term_offsets = (uint32_t *) (image + header.terms_offset);
+    char *pool = image + header.pool_offset;
+    uint32_t pool_position = 0;
+
+    for (uint32_t i = 0; i < terms_count; ++i) {
+        size_t len = strlen(terms[i]) + 1;
+
+        term_offsets[i] = pool_position;
+        memcpy(pool + pool_position, terms[i], len);
+        pool_position += (uint32_t) len;
+    }
+
+    // Subject index: rows are already sorted by subjects.
+    uint32_t *subject_index = (uint32_t *) (image + header.indexes_offsets[SSLOG_STORE_FIELD_SUBJECT]);
+    sslog_store_segment_group_rows(rows, rows_count, terms_count, SSLOG_STORE_FIELD_SUBJECT, NULL, subject_index);
+
+    for (int field = SSLOG_STORE_FIELD_PREDICATE; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        sslog_store_segment_group_rows(rows, rows_count, terms_count, (sslog_store_field) field,
+                                       (uint32_t *) (image + header.orders_offsets[field]),
+                                       (uint32_t *) (image + header.indexes_offsets[field]));
+    }
+
+    free(terms);
+    free(rows);
+
+    *data = image;
+    *size = (size_t) offset;
+
+    return SSLOG_ERROR_NO;
+}
+
+
+sslog_store_segment_t *sslog_store_segment_new(void *data, size_t size, bool is_mapped)
+{
+    const sslog_store_segment_header_t *header = (const sslog_store_segment_header_t *) data;
+
+    if (data == NULL || size < sizeof(sslog_store_segment_header_t)
+            || memcmp(header->magic, SSLOG_STORE_SEGMENT_MAGIC, SSLOG_STORE_SEGMENT_MAGIC_LEN) != 0
+            || header->version != SSLOG_STORE_SEGMENT_VERSION
+            || header->size > size
+            || header->checksum != sslog_store_segment_checksum(header)) {
+        sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_FILE, SSLOG_ERROR_TEXT_INCORRECT_FILE "header");
+        return NULL;
+    }
+
+    // Only the header is checked: rows and terms of files are checked by sslog_store_segment_open.
+    uint64_t terms_count = header->terms_count;
+    uint64_t rows_count = header->rows_count;
+    uint64_t filter_size = (uint64_t) header->filter_blocks_count * SSLOG_STORE_FILTER_BLOCK_WORDS * sizeof(uint64_t);
+    size_t image_size = header->size;
+
+    bool is_correct = sslog_store_segment_check_section(header->terms_offset, terms_count * sizeof(uint32_t), image_size)
+            && sslog_store_segment_check_section(header->rows_offset, rows_count * sizeof(sslog_store_segment_row_t), image_size)
+            && sslog_store_segment_check_section(header->filter_offset, filter_size, image_size)
+            && sslog_store_segment_check_section(header->pool_offset, header->pool_size, image_size)
+            && (header->filter_blocks_count & (header->filter_blocks_count - 1)) == 0;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT && is_correct == true; ++field) {
+        is_correct = sslog_store_segment_check_section(header->indexes_offsets[field], (terms_count + 1) * sizeof(uint32_t), image_size);
+
+        if (field != SSLOG_STORE_FIELD_SUBJECT && is_correct == true) {
+            is_correct = sslog_store_segment_check_section(header->orders_offsets[field], rows_count * sizeof(uint32_t), image_size);
+        }
+    }
+
+    const char *image = (const char *) data;
+
+    if (is_correct == true && header->pool_size != 0) {
+        is_correct = (image[header->pool_offset + header->pool_size - 1] == '\0');
+    }
+
+    if (is_correct != true) {
+        sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_FILE, SSLOG_ERROR_TEXT_INCORRECT_FILE "sections");
+        return NULL;
+    }
+
+    sslog_store_segment_t *segment = (sslog_store_segment_t *) calloc(1, sizeof(sslog_store_segment_t));
+
+    if (segment == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    segment->data = data;
+    segment->size = size;
+    segment->is_mapped = is_mapped;
+    segment->header = header;
+    segment->terms = (const uint32_t *) (image + header->terms_offset);
+    segment->rows = (const sslog_store_segment_row_t *) (image + header->rows_offset);
+    segment->pool = image + header->pool_offset;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        segment->indexes[field] = (const uint32_t *) (image + header->indexes_offsets[field]);
+        segment->orders[field] = (field == SSLOG_STORE_FIELD_SUBJECT) ?
+                    NULL : (const uint32_t *) (image + header->orders_offsets[field]);
+    }
+
+    // Arrays of rows are allocated on the first materializing and removing.
+    segment->triples = NULL;
+    segment->removed = NULL;
+    segment->born = 0;
+    segment->live_count = (int) header->rows_count;
+
+    return segment;
+}
+
+
+sslog_store_segment_t *sslog_store_segment_open(const char *path)
+{
+    int file = open(path, O_RDONLY);
+
+    if (file < 0) {
+        sslog_error_set(NULL, SSLOG_ERROR_FILE, SSLOG_ERROR_TEXT_FILE "can't open file");
+        return NULL;
+    }
+
+    struct stat file_info;
+
+    if (fstat(file, &file_info) != 0 || file_info.st_size <= 0) {
+        close(file);
+        sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_FILE, SSLOG_ERROR_TEXT_INCORRECT_FILE "empty file");
+        return NULL;
+    }
+
+    size_t size = (size_t) file_info.st_size;
+    void *data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+    // Mapping is valid after closing the file.
+    close(file);
+
+    if (data == MAP_FAILED) {
+        sslog_error_set(NULL, SSLOG_ERROR_FILE, SSLOG_ERROR_TEXT_FILE "can't map file");
+        return NULL;
+    }
+
+    sslog_store_segment_t *segment = sslog_store_segment_new(data, size, true);
+
+    if (segment == NULL) {
+        munmap(data, size);
+        return NULL;
+    }
+
+    // Files are written under a temporary name and renamed, but they can be damaged later.
+    if (sslog_store_segment_check_body(segment) != true) {
+        sslog_store_segment_free(segment);
+        sslog_error_set(NULL, SSLOG_ERROR_INCORRECT_FILE, SSLOG_ERROR_TEXT_INCORRECT_FILE "rows or terms");
+        return NULL;
+    }
+
+    return segment;
+}
+
+
+int sslog_store_segment_write(const void *data, size_t size, const char *path)
+{
+    // File is written under a temporary name and renamed,
+    // so readers never see a partially written file.
+    size_t path_len = strlen(path);
+    char *temp_path = (char *) malloc(path_len + sizeof(".tmp"));
+
+    if (temp_path == NULL) {
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    memcpy(temp_path, path, path_len);
+    memcpy(temp_path + path_len, ".tmp", sizeof(".tmp"));
+
+    FILE *file = fopen(temp_path, "wb");
+
+    if (file == NULL) {
+        free(temp_path);
+        return SSLOG_ERROR_FILE;
+    }
+
+    bool is_written = (fwrite(data, 1, size, file) == size);
+    is_written = (fclose(file) == 0) && is_written;
+
+    if (is_written != true || rename(temp_path, path) != 0) {
+        remove(temp_path);
+        free(temp_path);
+        return SSLOG_ERROR_FILE;
+    }
+
+    free(temp_path);
+
+    return SSLOG_ERROR_NO;
+}
+
+
+void sslog_store_segment_free(sslog_store_segment_t *segment)
+{
+    if (segment == NULL) {
+        return;
+    }
+
+    if (segment->is_mapped == true) {
+        munmap(segment->data, segment->size);
+    } else if (segment->is_static == false) {
+        free(segment->data);
+    }
+
+    free(segment->triples);
+    free(segment->removed);
+    free(segment);
+}
+
+
+long sslog_store_segment_find_term(const sslog_store_segment_t *segment, const char *value)
+{
+    long low = 0;
+    long high = (long) segment->header->terms_count - 1;
+
+    while (low <= high) {
+        long middle = low + (high - low) / 2;
+        int result = strcmp(segment->pool + segment->terms[middle], value);
+
+        if (result == 0) {
+            return middle;
+        }
+
+        if (result < 0) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    return -1;
+}
+
+
+bool sslog_store_segment_plan(const sslog_store_segment_t *segment, const char *values[SSLOG_STORE_FIELDS_COUNT],
+                              long terms[SSLOG_STORE_FIELDS_COUNT], int *field, uint32_t *begin, uint32_t *end)
+{
+    *field = -1;
+    *begin = 0;
+    *end = segment->header->rows_count;
+
+    for (int i = 0; i < SSLOG_STORE_FIELDS_COUNT; ++i) {
+        terms[i] = -1;
+
+        if (values[i] == NULL) {
+            continue;
+        }
+
+        terms[i] = sslog_store_segment_find_term(segment, values[i]);
+
+        if (terms[i] < 0) {
+            return false;
+        }
+
+        uint32_t term_begin = segment->indexes[i][terms[i]];
+        uint32_t term_end = segment->indexes[i][terms[i] + 1];
+
+        if (*field < 0 || term_end - term_begin < *end - *begin) {
+            *field = i;
+            *begin = term_begin;
+            *end = term_end;
+        }
+    }
+
+    return (*begin < *end) ? true : false;
+}
+
+
+uint32_t sslog_store_segment_row_at(const sslog_store_segment_t *segment, int field, uint32_t position)
+{
+    if (field < 0 || segment->orders[field] == NULL) {
+        return position;
+    }
+
+    return segment->orders[field][position];
+}
+
+
+void sslog_store_segment_row_data(const sslog_store_segment_t *segment, uint32_t row, sslog_triple_t *data)
+{
+    const sslog_store_segment_row_t *segment_row = &segment->rows[row];
+
+    data->subject = (char *) segment->pool + segment->terms[segment_row->terms[SSLOG_STORE_FIELD_SUBJECT]];
+    data->predicate = (char *) segment->pool + segment->terms[segment_row->terms[SSLOG_STORE_FIELD_PREDICATE]];
+    data->object = (char *) segment->pool + segment->terms[segment_row->terms[SSLOG_STORE_FIELD_OBJECT]];
+    data->subject_type = segment_row->subject_type;
+    data->object_type = segment_row->object_type;
+}
+
+
+long sslog_store_segment_find_row(const sslog_store_segment_t *segment, sslog_triple_t *triple, unsigned long snapshot)
+{
+    long subject = sslog_store_segment_find_term(segment, triple->subject);
+    long predicate = (subject < 0) ? -1 : sslog_store_segment_find_term(segment, triple->predicate);
+    long object = (predicate < 0) ? -1 : sslog_store_segment_find_term(segment, triple->object);
+
+    if (object < 0) {
+        return -1;
+    }
+
+    // Rows of the subject are sorted by predicate and object, find the first one.
+    uint32_t low = segment->indexes[SSLOG_STORE_FIELD_SUBJECT][subject];
+    uint32_t high = segment->indexes[SSLOG_STORE_FIELD_SUBJECT][subject + 1];
+
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        const sslog_store_segment_row_t *row = &segment->rows[middle];
+
+        if (row->terms[SSLOG_STORE_FIELD_PREDICATE] < (uint32_t) predicate
+                || (row->terms[SSLOG_STORE_FIELD_PREDICATE] == (uint32_t) predicate
+                    && row->terms[SSLOG_STORE_FIELD_OBJECT] < (uint32_t) object)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    uint32_t subject_end = segment->indexes[SSLOG_STORE_FIELD_SUBJECT][subject + 1];
+
+    for (; low < subject_end; ++low) {
+        const sslog_store_segment_row_t *row = &segment->rows[low];
+
+        if (row->terms[SSLOG_STORE_FIELD_PREDICATE] != (uint32_t) predicate
+                || row->terms[SSLOG_STORE_FIELD_OBJECT] != (uint32_t) object) {
+            break;
+        }
+
+        if (row->subject_type == triple->subject_type && row->object_type == triple->object_type
+                && sslog_store_segment_is_visible(segment, low, snapshot) == true) {
+            return (long) low;
+        }
+    }
+
+    return -1;
+}
+
+
+sslog_triple_t **sslog_store_segment_init_triples(sslog_store_segment_t *segment)
+{
+#ifdef MTENABLE
+    sslog_triple_t **triples = __atomic_load_n(&segment->triples, __ATOMIC_ACQUIRE);
+#else
+    sslog_triple_t **triples = segment->triples;
+#endif
+
+    if (triples != NULL) {
+        return triples;
+    }
+
+    triples = (sslog_triple_t **) calloc(segment->header->rows_count + 1, sizeof(sslog_triple_t *));
+
+    if (triples == NULL) {
+        sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    // Readers can materialize the first rows at the same time.
+#ifdef MTENABLE
+    sslog_triple_t **old_triples = __sync_val_compare_and_swap(&segment->triples, NULL, triples);
+
+    if (old_triples != NULL) {
+        free(triples);
+        return old_triples;
+    }
+#else
+    segment->triples = triples;
+#endif
+
+    return triples;
+}
+
+
+int sslog_store_segment_init_removed(sslog_store_segment_t *segment)
+{
+    if (segment->removed != NULL) {
+        return SSLOG_ERROR_NO;
+    }
+
+    segment->removed = (unsigned long *) calloc(segment->header->rows_count + 1, sizeof(unsigned long));
+
+    if (segment->removed == NULL) {
+        return sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+sslog_triple_t *sslog_store_segment_get_triple(sslog_store_segment_t *segment, uint32_t row)
+{
+    sslog_triple_t **triples = sslog_store_segment_init_triples(segment);
+
+    if (triples == NULL) {
+        return NULL;
+    }
+
+    sslog_triple_t *triple = triples[row];
+
+    if (triple != NULL) {
+        return triple;
+    }
+
+    sslog_triple_t data;
+    sslog_store_segment_row_data(segment, row, &data);
+
+    triple = sslog_triple_copy(&data);
+
+    if (triple == NULL) {
+        return NULL;
+    }
+
+    sslog_triple_stored(triple, true);
+
+    // Rows are materialized by readers, so several threads can do it at the same time.
+#ifdef MTENABLE
+    sslog_triple_t *old_triple = __sync_val_compare_and_swap(&triples[row], NULL, triple);
+
+    if (old_triple != NULL) {
+        sslog_free_triple_force(triple);
+        return old_triple;
+    }
+#else
+    triples[row] = triple;
+#endif
+
+    return triple;
+}
+
+
+void sslog_store_segment_remove_row(sslog_store_segment_t *segment, uint32_t row, unsigned long version)
+{
+    if (segment->removed == NULL || segment->removed[row] != 0) {
+        return;
+    }
+
+    segment->removed[row] = version;
+    --segment->live_count;
+}
+
+/// @endcond
+
+
+
+/******************************************************************************/
+/***************************** Static functions *******************************/
+static int sslog_store_segment_compare_terms(const void *a, const void *b)
+{
+    return strcmp(*(const char **) a, *(const char **) b);
+}
+
+
+static int sslog_store_segment_compare_rows(const void *a, const void *b)
+{
+    const sslog_store_segment_row_t *row_a = (const sslog_store_segment_row_t *) a;
+    const sslog_store_segment_row_t *row_b = (const sslog_store_segment_row_t *) b;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        if (row_a->terms[field] != row_b->terms[field]) {
+            return (row_a->terms[field] < row_b->terms[field]) ? -1 : 1;
+        }
+    }
+
+    if (row_a->subject_type != row_b->subject_type) {
+        return (row_a->subject_type < row_b->subject_type) ? -1 : 1;
+    }
+
+    if (row_a->object_type != row_b->object_type) {
+        return (row_a->object_type < row_b->object_type) ? -1 : 1;
+    }
+
+    return 0;
+}
+
+
+static long sslog_store_segment_find_sorted_term(const char **terms, uint32_t terms_count, const char *value)
+{
+    long low = 0;
+    long high = (long) terms_count - 1;
+
+    while (low <= high) {
+        long middle = low + (high - low) / 2;
+        int result = strcmp(terms[middle], value);
+
+        if (result == 0) {
+            return middle;
+        }
+
+        if (result < 0) {
+            low = middle + 1;
+        } else {
+            high = middle - 1;
+        }
+    }
+
+    return -1;
+}
+
+
+/**
+ * @brief Groups rows by terms of the element (counting sort).
+ * Rows with the same term keep their order (sorted by subject, predicate, object).
+ * @param rows. Sorted rows.
+ * @param rows_count. Number of rows.
+ * @param terms_count. Number of terms.
+ * @param field. Element to group rows.
+ * @param order. Identifiers of rows in the grouped order, NULL if the rows are already grouped.
+ * @param index. Position of the first row for each term (terms_count + 1 positions).
+ */
+static void sslog_store_segment_group_rows(const sslog_store_segment_row_t *rows, uint32_t rows_count, uint32_t terms_count,
+                                           sslog_store_field field, uint32_t *order, uint32_t *index)
+{
+    memset(index, 0, (terms_count + 1) * sizeof(uint32_t));
+
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        ++index[rows[i].terms[field] + 1];
+    }
+
+    for (uint32_t i = 0; i < terms_count; ++i) {
+        index[i + 1] += index[i];
+    }
+
+    if (order == NULL) {
+        return;
+    }
+
+    // Positions are taken from the index and restored after filling.
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        order[index[rows[i].terms[field]]++] = i;
+    }
+
+    for (uint32_t i = terms_count; i > 0; --i) {
+        index[i] = index[i - 1];
+    }
+
+    index[0] = 0;
+}
+
+
+static bool sslog_store_segment_check_section(uint64_t offset, uint64_t size, size_t segment_size)
+{
+    return (offset % sizeof(uint32_t) == 0 && offset + size <= segment_size) ? true : false;
+}
+
+
+/**
+ * @brief Checks values that are used as indexes of the image.
+ * Offsets of terms are in the pool (it ends with '\0'), identifiers of terms in rows
+ * are in the dictionary, indexes are not decreasing and orders point to rows.
+ * @param segment. Segment with the checked header.
+ * @return true if the image can be read without bounds checks, false otherwise.
+ */
+static bool sslog_store_segment_check_body(const sslog_store_segment_t *segment)
+{
+    uint32_t terms_count = segment->header->terms_count;
+    uint32_t rows_count = segment->header->rows_count;
+
+    for (uint32_t i = 0; i < terms_count; ++i) {
+        if (segment->terms[i] >= segment->header->pool_size) {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0; i < rows_count; ++i) {
+        for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+            if (segment->rows[i].terms[field] >= terms_count) {
+                return false;
+            }
+        }
+    }
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        const uint32_t *index = segment->indexes[field];
+
+        for (uint32_t i = 0; i < terms_count; ++i) {
+            if (index[i] > index[i + 1]) {
+                return false;
+            }
+        }
+
+        if (index[terms_count] > rows_count) {
+            return false;
+        }
+
+        for (uint32_t i = 0; segment->orders[field] != NULL && i < rows_count; ++i) {
+            if (segment->orders[field][i] >= rows_count) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Calculates the checksum of the header.
+ * @param header. Header, its checksum field is not used.
+ * @return FNV-1a (32 bits) of the header with zero checksum.
+ */
+static uint32_t sslog_store_segment_checksum(const sslog_store_segment_header_t *header)
+{
+    sslog_store_segment_header_t data = *header;
+    data.checksum = 0;
+
+    uint32_t hash = 2166136261u;
+    const unsigned char *bytes = (const unsigned char *) &data;
+
+    for (size_t i = 0; i < sizeof(sslog_store_segment_header_t); ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
@@ -0,0 +1,559 @@
+/**
+ * @file   triplestore_select.c
+ * @brief  Local evaluation of basic graph patterns over the triple-store.
+ *
+ *
+ * @section LICENSE
+ *
+ * SmartSlog is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * SmartSlog is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with SmartSlog KP Library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin St, Fifth Floor,
+ * Boston, MA  02110-1301  USA
+ *
+ *
+ * @section DESCRIPTION
+ *
+ * Patterns are joined with index nested loops: on each step the pattern
+ * with the most selective bound element (constant or already bound variable)
+ * is evaluated through the index key of this element, values of its free
+ * variables are bound and the rest patterns are evaluated with new bindings.
+ *
+ * This file is part of SmartSlog KP Library.
+ *
+ * Copyright (C) 2015 - SmartSlog. All rights reserved.
+ *
+ */
+
+#include "triplestore_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "kpi_api.h"
+#include "low_api_internal.h"
+
+#include "utils/errors.h"
+#include "utils/errors_internal.h"
+#include "utils/list.h"
+#include "utils/util_func.h"
+
+
+/******************************************************************************/
+/************************** Definitions and structures ************************/
+
+/** @brief Prefix of variables in patterns. */
+#define SSLOG_STORE_VARIABLE_PREFIX '?'
+
+/** @brief Initial capacity of the array with rows. */
+#define SSLOG_STORE_ROWS_INITIAL_CAPACITY 16
+
+/** @brief Term of the pattern that is not a variable. */
+#define SSLOG_STORE_TERM_CONSTANT -1
+
+/** @brief Term of the pattern that matches any value (SSLOG_TRIPLE_ANY). */
+#define SSLOG_STORE_TERM_ANY -2
+
+
+/**
+ * @brief Compiled pattern: each element is a constant, a variable or 'any' value.
+ */
+typedef struct sslog_store_pattern_s {
+    const char *values[SSLOG_STORE_FIELDS_COUNT];   /**< Values of constants. */
+    int variables[SSLOG_STORE_FIELDS_COUNT];        /**< Variable index or SSLOG_STORE_TERM_* value. */
+    bool is_evaluated;                              /**< Pattern is used in the current join step. */
+} sslog_store_pattern_t;
+
+
+/**
+ * @brief Candidates of the pattern: records of the key and range of segment rows.
+ */
+typedef struct sslog_store_candidates_s {
+    sslog_store_key_t *key;             /**< Key with records, NULL for all records. */
+    sslog_store_field field;            /**< Field of the key. */
+    bool has_records;                   /**< There are records to check. */
+    int order_field;                    /**< Order of segment rows, -1 for all rows. */
+    uint32_t begin;                     /**< First position of segment rows. */
+    uint32_t end;                       /**< Position after segment rows, equal to begin if there are no rows. */
+    long count;                         /**< Estimated number of candidates. */
+} sslog_store_candidates_t;
+
+
+/**
+ * @brief State of the evaluation.
+ */
+typedef struct sslog_store_select_s {
+    sslog_store_t *store;               /**< Store with triples. */
+    sslog_store_pattern_t *patterns;    /**< Compiled patterns. */
+    int patterns_count;                 /**< Number of patterns. */
+    const char **names;                 /**< Names of variables (without prefix). */
+    const char **values;                /**< Current values of variables, NULL for unbound. */
+    int *types;                         /**< Current types of values. */
+    int variables_count;                /**< Number of variables. */
+    sslog_sparql_result_row_t **rows;   /**< Founded rows. */
+    int rows_count;                     /**< Number of rows. */
+    int rows_capacity;                  /**< Size of the rows array. */
+    int max_rows_count;                 /**< Maximum number of rows, negative value - no limits. */
+    unsigned long snapshot;             /**< Version of the store snapshot. */
+    int error;                          /**< Error code. */
+} sslog_store_select_t;
+
+
+
+/******************************************************************************/
+/*************************** Static functions list ****************************/
+static int sslog_store_select_compile(sslog_store_select_t *select, list_t *patterns);
+static int sslog_store_select_variable(sslog_store_select_t *select, const char *name);
+static const char *sslog_store_select_term_value(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                                 sslog_store_field field);
+static bool sslog_store_select_candidates(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                          sslog_store_candidates_t *candidates);
+static void sslog_store_select_join(sslog_store_select_t *select, int evaluated_count);
+static void sslog_store_select_match(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                     sslog_triple_t *triple, int evaluated_count);
+static void sslog_store_select_add_row(sslog_store_select_t *select);
+static bool sslog_store_select_is_completed(sslog_store_select_t *select);
+static void sslog_store_select_free(sslog_store_select_t *select);
+
+
+
+/******************************************************************************/
+/****************************** Implementations *******************************/
+/**************************** Internal functions ******************************/
+/// @cond DOXY_INTERNAL
+sslog_sparql_result_t *sslog_store_select(sslog_store_t *store, list_t *patterns, int max_rows_count)
+{
+    sslog_store_select_t select;
+    memset(&select, 0, sizeof(sslog_store_select_t));
+
+    select.store = store;
+    select.max_rows_count = max_rows_count;
+
+    int result = sslog_store_select_compile(&select, patterns);
+
+    if (result != SSLOG_ERROR_NO) {
+        sslog_store_select_free(&select);
+        sslog_error_set(NULL, result, SSLOG_ERROR_TEXT_INCORRECT_ARGUMENT "patterns");
+        return NULL;
+    }
+
+    if (max_rows_count != 0 && select.patterns_count > 0) {
+        sslog_store_lock_read(store);
+        select.snapshot = sslog_store_read_snapshot(store);
+        sslog_store_select_join(&select, 0);
+        sslog_store_unlock_read(store);
+    }
+
+    if (select.error != SSLOG_ERROR_NO) {
+        sslog_store_select_free(&select);
+        sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    sslog_sparql_result_t *select_result = sslog_new_sparql_result(select.names, select.variables_count, select.rows_count);
+
+    if (select_result == NULL) {
+        sslog_store_select_free(&select);
+        sslog_error_set(NULL, SSLOG_ERROR_OUT_OF_MEMORY, SSLOG_ERROR_TEXT_OUT_OF_MEMORY);
+        return NULL;
+    }
+
+    // Rows are moved to the result.
+    for (int i = 0; i < select.rows_count; ++i) {
+        select_result->rows[i] = select.rows[i];
+    }
+
+    select.rows_count = 0;
+    sslog_store_select_free(&select);
+
+    sslog_error_reset(NULL);
+
+    return select_result;
+}
+
+/// @endcond
+
+
+
+/******************************************************************************/
+/***************************** Static functions *******************************/
+
+/**
+ * @brief Converts patterns triples to compiled patterns and collects variables.
+ * @param select. Evaluation state.
+ * @param patterns. List with triples-patterns.
+ * @return SSLOG_ERROR_NO on success or error code otherwise.
+ */
+static int sslog_store_select_compile(sslog_store_select_t *select, list_t *patterns)
+{
+    int patterns_count = list_count(patterns);
+
+    if (patterns_count == 0) {
+        return SSLOG_ERROR_NO;
+    }
+
+    select->patterns = (sslog_store_pattern_t *) calloc(patterns_count, sizeof(sslog_store_pattern_t));
+
+    // Each pattern can have no more than 3 variables.
+    select->names = (const char **) calloc(patterns_count * SSLOG_STORE_FIELDS_COUNT, sizeof(char *));
+
+    if (select->patterns == NULL || select->names == NULL) {
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    list_head_t *list_walker = NULL;
+    list_for_each(list_walker, &patterns->links) {
+        list_t *node = list_entry(list_walker, list_t, links);
+        sslog_triple_t *triple = (sslog_triple_t *) node->data;
+        sslog_store_pattern_t *pattern = &select->patterns[select->patterns_count++];
+
+        if (triple == NULL) {
+            return SSLOG_ERROR_INCORRECT_ARGUMENT;
+        }
+
+        for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+            const char *value = sslog_store_field_value(triple, (sslog_store_field) field);
+
+            if (value == NULL) {
+                return SSLOG_ERROR_INCORRECT_ARGUMENT;
+            }
+
+            pattern->values[field] = value;
+
+            if (strcmp(value, SSLOG_TRIPLE_ANY) == 0) {
+                pattern->variables[field] = SSLOG_STORE_TERM_ANY;
+            } else if (value[0] == SSLOG_STORE_VARIABLE_PREFIX && value[1] != '\0') {
+                pattern->variables[field] = sslog_store_select_variable(select, value + 1);
+            } else {
+                pattern->variables[field] = SSLOG_STORE_TERM_CONSTANT;
+            }
+        }
+    }
+
+    select->values = (const char **) calloc(select->variables_count + 1, sizeof(char *));
+    select->types = (int *) calloc(select->variables_count + 1, sizeof(int));
+
+    if (select->values == NULL || select->types == NULL) {
+        return SSLOG_ERROR_OUT_OF_MEMORY;
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+/**
+ * @brief Gets an index of the variable, new variables are added to the end.
+ * @param select. Evaluation state.
+ * @param name. Name of the variable without prefix.
+ * @return index of the variable.
+ */
+static int sslog_store_select_variable(sslog_store_select_t *select, const char *name)
+{
+    for (int i = 0; i < select->variables_count; ++i) {
+        if (strcmp(select->names[i], name) == 0) {
+            return i;
+        }
+    }
+
+    select->names[select->variables_count] = name;
+
+    return select->variables_count++;
+}
+
+
+/**
+ * @brief Gets a value of the pattern element for current bindings.
+ * @return value of constant or bound variable, NULL if element is not bound.
+ */
+static const char *sslog_store_select_term_value(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                                 sslog_store_field field)
+{
+    int variable = pattern->variables[field];
+
+    if (variable == SSLOG_STORE_TERM_CONSTANT) {
+        return pattern->values[field];
+    }
+
+    if (variable == SSLOG_STORE_TERM_ANY) {
+        return NULL;
+    }
+
+    return select->values[variable];
+}
+
+
+/**
+ * @brief Gets candidates of the pattern with current bindings.
+ * Records are taken from the most selective key, rows of the segment are
+ * taken from the shortest range.
+ * @param select. Evaluation state.
+ * @param pattern. Pattern to evaluate.
+ * @param candidates. Founded candidates.
+ * @return false if the pattern can't be matched (no candidates), true otherwise.
+ */
+static bool sslog_store_select_candidates(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                          sslog_store_candidates_t *candidates)
+{
+    sslog_store_t *store = select->store;
+    const char *values[SSLOG_STORE_FIELDS_COUNT];
+
+    candidates->key = NULL;
+    candidates->field = SSLOG_STORE_FIELD_SUBJECT;
+    candidates->has_records = true;
+    candidates->order_field = -1;
+    candidates->begin = 0;
+    candidates->end = 0;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT; ++field) {
+        values[field] = sslog_store_select_term_value(select, pattern, (sslog_store_field) field);
+
+        if (values[field] == NULL || candidates->has_records == false) {
+            continue;
+        }
+
+        sslog_store_key_t *key = sslog_store_index_get_key(&store->indexes[field], values[field]);
+
+        if (key == NULL) {
+            candidates->has_records = false;
+            continue;
+        }
+
+        if (candidates->key == NULL || key->count < candidates->key->count) {
+            candidates->key = key;
+            candidates->field = (sslog_store_field) field;
+        }
+    }
+
+    candidates->count = 0;
+
+    if (candidates->has_records == true) {
+        candidates->count = (candidates->key == NULL) ? store->triples_count : candidates->key->count;
+    }
+
+    // Rows that are removed after the snapshot are not counted as live.
+    if (store->segment != NULL && store->segment->born <= select->snapshot) {
+        long terms[SSLOG_STORE_FIELDS_COUNT];
+
+        if (sslog_store_segment_plan(store->segment, values, terms, &candidates->order_field,
+                                     &candidates->begin, &candidates->end) != true) {
+            candidates->end = candidates->begin;
+        }
+
+        candidates->count += candidates->end - candidates->begin;
+    }
+
+    return (candidates->has_records == true || candidates->end > candidates->begin) ? true : false;
+}
+
+
+/**
+ * @brief Evaluates not evaluated patterns with current bindings.
+ * The next pattern is the pattern with the smallest number of candidates.
+ * @param select. Evaluation state.
+ * @param evaluated_count. Number of evaluated patterns.
+ */
+static void sslog_store_select_join(sslog_store_select_t *select, int evaluated_count)
+{
+    if (evaluated_count == select->patterns_count) {
+        sslog_store_select_add_row(select);
+        return;
+    }
+
+    sslog_store_pattern_t *next_pattern = NULL;
+    sslog_store_candidates_t next_candidates;
+
+    for (int i = 0; i < select->patterns_count; ++i) {
+        sslog_store_pattern_t *pattern = &select->patterns[i];
+
+        if (pattern->is_evaluated == true) {
+            continue;
+        }
+
+        sslog_store_candidates_t candidates;
+
+        // One of patterns has no triples, so there are no solutions.
+        if (sslog_store_select_candidates(select, pattern, &candidates) != true) {
+            return;
+        }
+
+        if (next_pattern == NULL || candidates.count < next_candidates.count) {
+            next_pattern = pattern;
+            next_candidates = candidates;
+        }
+    }
+
+    next_pattern->is_evaluated = true;
+
+    if (next_candidates.has_records == true) {
+        list_head_t *records_head = (next_candidates.key == NULL) ?
+                    &select->store->records : &next_candidates.key->records;
+
+        list_head_t *list_walker = NULL;
+        list_for_each(list_walker, records_head) {
+            sslog_store_record_t *record = (next_candidates.key == NULL) ?
+                        list_entry(list_walker, sslog_store_record_t, store_links)
+                      : sslog_store_record_from_links(list_walker, next_candidates.field);
+
+            if (sslog_store_record_is_visible(record, select->snapshot) == false) {
+                continue;
+            }
+
+            sslog_store_select_match(select, next_pattern, record->triple, evaluated_count);
+
+            if (sslog_store_select_is_completed(select) == true) {
+                break;
+            }
+        }
+    }
+
+    // Rows are matched by values from the pool, without materialization.
+    for (uint32_t position = next_candidates.end; position > next_candidates.begin
+         && sslog_store_select_is_completed(select) == false; --position) {
+        sslog_store_segment_t *segment = select->store->segment;
+        uint32_t row = sslog_store_segment_row_at(segment, next_candidates.order_field, position - 1);
+
+        if (sslog_store_segment_is_visible(segment, row, select->snapshot) == false) {
+            continue;
+        }
+
+        sslog_triple_t data;
+        sslog_store_segment_row_data(segment, row, &data);
+
+        sslog_store_select_match(select, next_pattern, &data, evaluated_count);
+    }
+
+    next_pattern->is_evaluated = false;
+}
+
+
+/**
+ * @brief Matches the triple with the pattern, binds free variables and continues the join.
+ * @param select. Evaluation state.
+ * @param pattern. Pattern to match.
+ * @param triple. Stored triple.
+ * @param evaluated_count. Number of evaluated patterns (without given pattern).
+ */
+static void sslog_store_select_match(sslog_store_select_t *select, sslog_store_pattern_t *pattern,
+                                     sslog_triple_t *triple, int evaluated_count)
+{
+    int bound_variables[SSLOG_STORE_FIELDS_COUNT];
+    int bound_count = 0;
+    bool is_matched = true;
+
+    for (int field = 0; field < SSLOG_STORE_FIELDS_COUNT && is_matched == true; ++field) {
+        int variable = pattern->variables[field];
+        const char *triple_value = sslog_store_field_value(triple, (sslog_store_field) field);
+
+        if (variable == SSLOG_STORE_TERM_ANY) {
+            continue;
+        }
+
+        const char *value = sslog_store_select_term_value(select, pattern, (sslog_store_field) field);
+
+        if (value != NULL) {
+            is_matched = (strcmp(value, triple_value) == 0) ? true : false;
+            continue;
+        }
+
+        select->values[variable] = triple_value;
+
+        switch (field) {
+        case SSLOG_STORE_FIELD_SUBJECT:
+            select->types[variable] = triple->subject_type;
+            break;
+        case SSLOG_STORE_FIELD_OBJECT:
+            select->types[variable] = triple->object_type;
+            break;
+        default:
+            select->types[variable] = SSLOG_RDF_TYPE_URI;
+            break;
+        }
+
+        bound_variables[bound_count++] = variable;
+    }
+
+    if (is_matched == true) {
+        sslog_store_select_join(select, evaluated_count + 1);
+    }
+
+    for (int i = 0; i < bound_count; ++i) {
+        select->values[bound_variables[i]] = NULL;
+    }
+}
+
+
+/**
+ * @brief Adds a row with copies of current values.
+ * @param select. Evaluation state.
+ */
+static void sslog_store_select_add_row(sslog_store_select_t *select)
+{
+    if (select->rows_count == select->rows_capacity) {
+        int new_capacity = (select->rows_capacity == 0) ? SSLOG_STORE_ROWS_INITIAL_CAPACITY : select->rows_capacity * 2;
+        sslog_sparql_result_row_t **new_rows = (sslog_sparql_result_row_t **) realloc(select->rows,
+                                                                                     new_capacity * sizeof(sslog_sparql_result_row_t *));
+
+        if (new_rows == NULL) {
+            select->error = SSLOG_ERROR_OUT_OF_MEMORY;
+            return;
+        }
+
+        select->rows = new_rows;
+        select->rows_capacity = new_capacity;
+    }
+
+    sslog_sparql_result_row_t *row = sslog_new_sparql_result_row(select->variables_count);
+
+    if (row == NULL) {
+        select->error = SSLOG_ERROR_OUT_OF_MEMORY;
+        return;
+    }
+
+    for (int i = 0; i < select->variables_count; ++i) {
+        row->values[i] = sslog_strndup(select->values[i], strlen(select->values[i]));
+        row->types[i] = select->types[i];
+    }
+
+    select->rows[select->rows_count++] = row;
+}
+
+
+static bool sslog_store_select_is_completed(sslog_store_select_t *select)
+{
+    if (select->error != SSLOG_ERROR_NO) {
+        return true;
+    }
+
+    return (select->max_rows_count > 0 && select->rows_count >= select->max_rows_count) ? true : false;
+}
+
+
+static void sslog_store_select_free(sslog_store_select_t *select)
+{
+    for (int row_index = 0; row_index < select->rows_count; ++row_index) {
+        sslog_sparql_result_row_t *row = select->rows[row_index];
+
+        for (int i = 0; i < select->variables_count; ++i) {
+            free(row->values[i]);
+        }
+
+        free(row->values);
+        free(row->types);
+        free(row);
+    }
+
+    free(select->rows);
+    free(select->patterns);
+    free(select->names);
+    free((void *) select->values);
+    free(select->types);
+}
@@ -35,6 +35,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifdef MTENABLE
+#include <pthread.h>
+#endif
+
 #include "errors_internal.h"
 #include "errors_decl.h"
 #include "util_func.h"
@@ -44,13 +48,20 @@
 
 /******************************* Definitions **********************************/
 /************************ Static and global entities **************************/
+#ifdef MTENABLE
+/** @brief Key of the last error of the thread (it is created on the first error). */
+static pthread_key_t g_last_error_key;
+static pthread_once_t g_last_error_once = PTHREAD_ONCE_INIT;
+#else
 /** @brief Contains information about last error. */
-static sslog_error_t g_last_error = { 0, "\0" };
+static sslog_error_t g_last_error = { 0, NULL };
+#endif
 
 
 /******************************* Definitions **********************************/
 /***************************** Static functions *******************************/
-static inline void sslog_copy_comment(char* buffer, const char *comment);
+static sslog_error_t *sslog_get_last_error(bool is_created);
+static inline const char *sslog_get_comment(const sslog_error_t *error);
 
 
 /****************************** Implementation ********************************/
@@ -59,13 +70,15 @@ static inline void sslog_copy_comment(char* buffer, const char *comment);
 
 SSLOG_EXTERN int sslog_error_get_last_code()
 {
-    return g_last_error.code;
+    sslog_error_t *last_error = sslog_get_last_error(false);
+
+    return (last_error == NULL) ? SSLOG_ERROR_NO : last_error->code;
 }
 
 
 SSLOG_EXTERN const char* sslog_error_get_last_text()
 {
-    return g_last_error.text;
+    return sslog_get_comment(sslog_get_last_error(false));
 }
 
 /**
@@ -86,7 +99,7 @@ SSLOG_EXTERN int sslog_error_get_code(sslog_node_t *node)
  */
 SSLOG_EXTERN const char* sslog_error_get_text(sslog_node_t *node)
 {
-    return node->last_error.text;
+    return sslog_get_comment(&node->last_error);
 }
 
 /// @endcond
@@ -99,12 +112,17 @@ SSLOG_EXTERN const char* sslog_error_get_text(sslog_node_t *node)
 
 int sslog_error_set(sslog_error_t *error, int error_code, const char *comment)
 {
-    g_last_error.code = error_code;
-    sslog_copy_comment(g_last_error.text, comment);
+    // Threads without errors have no state, success does not create it.
+    sslog_error_t *last_error = sslog_get_last_error(error_code != SSLOG_ERROR_NO);
+
+    if (last_error != NULL) {
+        last_error->code = error_code;
+        last_error->comment = comment;
+    }
 
     if (error != NULL) {
         error->code = error_code;
-        sslog_copy_comment(error->text, comment);
+        error->comment = comment;
     }
 
     return error_code;
@@ -113,15 +131,7 @@ int sslog_error_set(sslog_error_t *error, int error_code, const char *comment)
 
 int sslog_error_reset(sslog_error_t *error)
 {
-    g_last_error.code = SSLOG_ERROR_NO;
-    strncpy(g_last_error.text, SSLOG_ERROR_TEXT_NO, SSLOG_ERROR_MAX_COMMENT_LEN);
-
-    if (error != NULL) {
-        error->code = SSLOG_ERROR_NO;
-        strncpy(error->text, SSLOG_ERROR_TEXT_NO, SSLOG_ERROR_MAX_COMMENT_LEN);
-    }
-
-    return SSLOG_ERROR_NO;
+    return sslog_error_set(error, SSLOG_ERROR_NO, NULL);
 }
 
 /// @endcond
@@ -133,20 +143,57 @@ int sslog_error_reset(sslog_error_t *error)
 /****************************** Implementation ********************************/
 /***************************** static functions *******************************/
 
+#ifdef MTENABLE
+static void sslog_create_last_error_key()
+{
+    pthread_key_create(&g_last_error_key, free);
+}
+#endif
+
+
 /**
- * @brief Update buffer with given comment.
- * Copies comment to buffer, if the comment is null, then the buffer will be empty
- * string (first element will null-terminated char - '\0').
- * @param[in,out] buffer to copy comment.
- * @param[in] comment to copy.
+ * @brief Gets the last error of the calling thread.
+ * @param is_created. Creates the error of the thread if it does not exist.
+ * @return last error or NULL if the thread has no error state
+ * (it is not created or there is no memory).
  */
-static inline void sslog_copy_comment(char* buffer, const char *comment)
+static sslog_error_t *sslog_get_last_error(bool is_created)
 {
-    if (comment == NULL) {
-        buffer[0] = '\0';
-    } else {
-        strncpy(buffer, comment, SSLOG_ERROR_MAX_COMMENT_LEN);
+#ifdef MTENABLE
+    pthread_once(&g_last_error_once, sslog_create_last_error_key);
+
+    sslog_error_t *last_error = (sslog_error_t *) pthread_getspecific(g_last_error_key);
+
+    if (last_error == NULL && is_created == true) {
+        last_error = (sslog_error_t *) malloc(sizeof(sslog_error_t));
+
+        if (last_error != NULL) {
+            last_error->code = SSLOG_ERROR_NO;
+            last_error->comment = NULL;
+            pthread_setspecific(g_last_error_key, last_error);
+        }
+    }
+
+    return last_error;
+#else
+    return &g_last_error;
+#endif
+}
+
+
+/**
+ * @brief Gets the text of the error.
+ * Comments are not copied when errors are set, text is taken only on request.
+ * @param error. Error to get text (can be NULL - no error).
+ * @return comment of the error or empty string if there is no comment.
+ */
+static inline const char *sslog_get_comment(const sslog_error_t *error)
+{
+    if (error == NULL || error->comment == NULL) {
+        return SSLOG_ERROR_TEXT_NO;
     }
+
+    return error->comment;
 }
 
 
@@ -31,6 +31,7 @@
  * works with Node then it sets error information for node ('node error').
  * When the functions works without error it resets error information for the 'last error'
  * and for the 'node error' (if it works with node).
+ * The 'last error' is stored for each thread (with MTENABLE).
  *
  * This file is part of SmartSlog.
  *
@@ -76,6 +77,8 @@ enum sslog_errors {
     SSLOG_ERROR_OUT_OF_MEMORY,      /**< Memory allocation error. */
     SSLOG_ERROR_ALREADY_EXISTS,     /**< Some data is already exists. */
     SSLOG_ERROR_NOT_FOUND,          /**< Some data cannot be founs. */
+    SSLOG_ERROR_FILE,               /**< File cannot be read or written. */
+    SSLOG_ERROR_INCORRECT_FILE,     /**< File has incorrect format. */
 
     /* Errors for OWL-entities */
     SSLOG_ERROR_INCORRECT_CLASS = 100,  /**< Incorrect structure of OWL-class. */
@@ -125,8 +128,9 @@ enum sslog_errors {
 
 /**
  * @brief Gets a code of an error that occured in last calling function.
+ * Each thread has its own last error.
  * @return code of the error or SSLOG_ERROR_NO if the last calling function
- * completes successfully.
+ * of the thread completes successfully.
  */
 SSLOG_EXTERN int sslog_error_get_last_code();
 
@@ -34,6 +34,8 @@
 #define SSLOG_ERROR_TEXT_NULL_ARGUMENT "Argument is null: "
 #define SSLOG_ERROR_TEXT_NOT_IMPLEMENTED "Not implemented."
 #define SSLOG_ERROR_TEXT_NOT_FOUND "Not found: "
+#define SSLOG_ERROR_TEXT_FILE "File error: "
+#define SSLOG_ERROR_TEXT_INCORRECT_FILE "Incorrect file format: "
 
 /* Memory errors */
 #define SSLOG_ERROR_TEXT_OUT_OF_MEMORY "Out of memory."
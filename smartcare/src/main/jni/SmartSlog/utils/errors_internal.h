@@ -50,16 +50,14 @@ extern "C" {
 /************************** Structs and constants *****************************/
 /// @cond DOXY_INTERNAL_API
 
-/** @brief Max length for error comment buffer. */
-#define SSLOG_ERROR_MAX_COMMENT_LEN 255
-
-
 /**
  * @brief Structure for error informations.
+ * Comment is not copied, it is a static string (SSLOG_ERROR_TEXT_* or
+ * sslog_kpi_get_error_text), so setting the error costs two stores.
  */
 typedef struct sslog_error_s {
-    int code;   /**< Error code. */
-    char text[SSLOG_ERROR_MAX_COMMENT_LEN + 1]; /**< Error comment, specifiers the error. */
+    int code;               /**< Error code. */
+    const char *comment;    /**< Error comment, specifiers the error (can be NULL - no comment). */
 } sslog_error_t;
 
 /// @endcond
@@ -73,11 +71,14 @@ typedef struct sslog_error_s {
 //TODO: make extern only for test
 /**
  * @brief Sets error code and comment.
- * This function sets code and comment for the last error (#g_last_error) and for the
- * given error structure. If the given error structure is NULL, then it sets only #g_last_error.
+ * This function sets code and comment for the last error of the calling thread
+ * and for the given error structure. If the given error structure is NULL,
+ * then it sets only the last error of the thread.
  * @param error. Structure to store information about error (can be NULL).
  * @param error_code. Code of an error.
- * @param comment. Text that describes an error (can be NULL).
+ * @param comment. Static text that describes an error (can be NULL). It is not copied
+ * and is read after the call, so it must be a string literal or a text of
+ * sslog_kpi_get_error_text, never an allocated or a stack buffer.
  * @return given error_code (useful for the end of function: return sslog_error_set(...)).
  */
 SSLOG_EXTERN int sslog_error_set(sslog_error_t *error, int error_code, const char *comment);
@@ -86,8 +87,8 @@ SSLOG_EXTERN int sslog_error_set(sslog_error_t *error, int error_code, const cha
 /**
  * @brief Reset an error.
  * Sets code of error to SSLOG_ERROR_NO and comment to SSLOG_ERROR_TEXT_NO.
- * Function reset the last error (#g_last_error) and the given error structure.
- * If the given error structure is NULL, then only #g_last_error will be reseted.
+ * Function reset the last error of the calling thread and the given error structure.
+ * If the given error structure is NULL, then only the last error of the thread will be reseted.
  * @param error. Structure to reset information about error (can be NULL).
  * @return SSLOG_ERROR_NO code, useful for ending of function, if no errors (return sslog_error_reset(...)).
  */
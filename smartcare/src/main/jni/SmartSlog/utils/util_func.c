@@ -36,8 +36,11 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <sys/types.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "list.h"
 #include "util_func.h"
@@ -47,7 +50,7 @@
 #include "../triple_internal.h"
 
 
-#define SSLOG_URI_GENPART_LENGTH 5
+#define SSLOG_URI_GENPART_LENGTH 32
 #define SSLOG_NULL_BYTE_LENGTH 1
 
 typedef struct memory_object_s {
@@ -461,16 +464,35 @@ static int string_to_sharp_length(char *uri)
 }
 
 
-// TODO: Write better code, find uuid library.
+// 128 random bits from the system, rand() is seeded by time and repeats on devices
+// that are started in the same second. Without /dev/urandom the bits are mixed
+// from the time, the process and the counter of generated hashes.
 static char* sslog_generate_hash()
 {
-    int rnd_num = rand() % 100000;
+    static uint32_t counter = 0;
+    uint32_t bits[4];
 
     char *hash = (char *) malloc(sizeof(char) * (SSLOG_URI_GENPART_LENGTH + SSLOG_NULL_BYTE_LENGTH));
 
     if (hash == NULL) return NULL;
 
-    sprintf(hash, "%i", rnd_num);
+    FILE *urandom = fopen("/dev/urandom", "rb");
+
+    if (urandom == NULL || fread(bits, sizeof(bits), 1, urandom) != 1) {
+        struct timespec now;
+        clock_gettime(CLOCK_REALTIME, &now);
+
+        bits[0] = (uint32_t) now.tv_sec;
+        bits[1] = (uint32_t) now.tv_nsec;
+        bits[2] = ((uint32_t) getpid() << 16) ^ __sync_add_and_fetch(&counter, 1);
+        bits[3] = (uint32_t) rand() ^ (uint32_t) (uintptr_t) hash;
+    }
+
+    if (urandom != NULL) {
+        fclose(urandom);
+    }
+
+    sprintf(hash, "%08x%08x%08x%08x", bits[0], bits[1], bits[2], bits[3]);
 
     return hash;
 }
@@ -0,0 +1,320 @@
+#!/usr/bin/env python3
+#
+# Generator of the derived tables of the static ontology (smartcare.c).
+#
+# Classes and properties (SMARTCARE_PROPERTIES, SMARTCARE_CLASSES and the
+# order of SMARTCARE_ENTITIES) are the input. The script computes from them:
+#   - the perfect hash of URIs (SMARTCARE_HASH_SEEDS, SMARTCARE_HASH_SLOTS),
+#     see sslog_ontology_hash and sslog_ontology_find in SmartSlog/ontology.c;
+#   - the schema segment (SMARTCARE_SCHEMA) with rdf:type triples of classes
+#     and properties, see sslog_store_segment_build in SmartSlog/triplestore_segment.c;
+#   - sizes of the tables in SMARTCARE_ONTOLOGY.
+#
+# Usage:
+#   gen_ontology.py FILE...          rewrite the derived tables of the files
+#   gen_ontology.py --check FILE...  check that every URI is found at its index
+#                                    and the tables are up to date (exit code 1 if not)
+#
+# The hash, the segment format and the filter must be changed here
+# together with the library.
+#
+
+import re
+import struct
+import sys
+
+MASK32 = 0xffffffff
+MASK64 = 0xffffffffffffffff
+
+RDF_TYPE = "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"
+RDF_PROPERTY = "http://www.w3.org/1999/02/22-rdf-syntax-ns#Property"
+RDFS_CLASS = "http://www.w3.org/2000/01/rdf-schema#Class"
+
+# SSLOG_RDF_TYPE_URI
+RDF_TYPE_URI = 1
+
+# triplestore_internal.h
+SEGMENT_MAGIC = b"SSLOGSEG"
+SEGMENT_VERSION = 2
+FILTER_BLOCK_WORDS = 8
+FILTER_HASHES = 6
+FILTER_BITS_PER_VALUE = 10
+FILTER_MIN_BLOCKS = 16
+
+# Header: magic, 18 fields (see sslog_store_segment_header_t).
+HEADER_FORMAT = "<8s18I"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+
+
+def ontology_hash(uri, seed):
+    """FNV-1a (32 bits) with the seed and the finalizer of MurmurHash3."""
+    value = 2166136261 ^ seed
+    for byte in uri.encode():
+        value = ((value ^ byte) * 16777619) & MASK32
+    value ^= value >> 16
+    value = (value * 0x85ebca6b) & MASK32
+    value ^= value >> 13
+    value = (value * 0xc2b2ae35) & MASK32
+    value ^= value >> 16
+    return value
+
+
+def build_hash(uris):
+    """Buckets get seeds in order of their size, so all URIs get free slots."""
+    count = len(uris)
+    buckets_count = max(1, (count + 3) // 4)
+    slots_count = count + count // 4
+
+    buckets = [[] for _ in range(buckets_count)]
+    for index, uri in enumerate(uris):
+        buckets[ontology_hash(uri, 0) % buckets_count].append(index)
+
+    seeds = [0] * buckets_count
+    slots = [-1] * slots_count
+
+    for bucket in sorted(range(buckets_count), key=lambda b: -len(buckets[b])):
+        if not buckets[bucket]:
+            continue
+        for seed in range(1, 1 << 20):
+            bucket_slots = [ontology_hash(uris[i], seed) % slots_count for i in buckets[bucket]]
+            if len(set(bucket_slots)) == len(bucket_slots) and all(slots[s] < 0 for s in bucket_slots):
+                for index, slot in zip(buckets[bucket], bucket_slots):
+                    slots[slot] = index
+                seeds[bucket] = seed
+                break
+        else:
+            raise SystemExit("no seed for the bucket %d" % bucket)
+
+    return seeds, slots
+
+
+def find(uri, seeds, slots):
+    """Same lookup as sslog_ontology_find: index of the entity or -1."""
+    bucket = ontology_hash(uri, 0) % len(seeds)
+    return slots[ontology_hash(uri, seeds[bucket]) % len(slots)]
+
+
+def filter_hash(subject, predicate):
+    """sslog_store_filter_hash: FNV-1a (64 bits) and the finalizer of MurmurHash3."""
+    value = 14695981039346656037
+    for byte in subject.encode():
+        value = ((value ^ byte) * 1099511628211) & MASK64
+    if predicate is not None:
+        value = ((value ^ 0xff) * 1099511628211) & MASK64
+        for byte in predicate.encode():
+            value = ((value ^ byte) * 1099511628211) & MASK64
+    value ^= value >> 33
+    value = (value * 0xff51afd7ed558ccd) & MASK64
+    value ^= value >> 33
+    value = (value * 0xc4ceb9fe1a85ec53) & MASK64
+    value ^= value >> 33
+    return value
+
+
+def build_filter(values):
+    blocks_count = FILTER_MIN_BLOCKS
+    while blocks_count * FILTER_BLOCK_WORDS * 64 < len(values) * FILTER_BITS_PER_VALUE:
+        blocks_count *= 2
+
+    words = [0] * (blocks_count * FILTER_BLOCK_WORDS)
+    for value in values:
+        block = ((value >> 32) & (blocks_count - 1)) * FILTER_BLOCK_WORDS
+        bits = (value * 0x9e3779b97f4a7c15) & MASK64
+        for _ in range(FILTER_HASHES):
+            bit = bits & (FILTER_BLOCK_WORDS * 64 - 1)
+            words[block + bit // 64] |= 1 << (bit % 64)
+            bits >>= 9
+
+    return blocks_count, struct.pack("<%dQ" % len(words), *words)
+
+
+def group_rows(rows, terms_count, field):
+    """Counting sort of rows by the term of the field (sslog_store_segment_group_rows)."""
+    index = [0] * (terms_count + 1)
+    for row in rows:
+        index[row[field] + 1] += 1
+    for i in range(terms_count):
+        index[i + 1] += index[i]
+
+    order = [0] * len(rows)
+    positions = index[:]
+    for i, row in enumerate(rows):
+        order[positions[row[field]]] = i
+        positions[row[field]] += 1
+
+    return order, index
+
+
+def build_segment(triples):
+    """Image of the segment, the same as sslog_store_segment_build makes (little-endian)."""
+    terms = sorted(set(value.encode() for triple in triples for value in triple[:3]))
+    term_ids = dict((term, i) for i, term in enumerate(terms))
+
+    rows = sorted(set((term_ids[s.encode()], term_ids[p.encode()], term_ids[o.encode()], st, ot)
+                      for (s, p, o, st, ot) in triples))
+
+    values = []
+    for row in rows:
+        subject = terms[row[0]].decode()
+        values.append(filter_hash(subject, None))
+        values.append(filter_hash(subject, terms[row[1]].decode()))
+    filter_blocks_count, filter_data = build_filter(values)
+
+    pool = b"".join(term + b"\0" for term in terms)
+    term_offsets = []
+    position = 0
+    for term in terms:
+        term_offsets.append(position)
+        position += len(term) + 1
+
+    offset = HEADER_SIZE
+    terms_offset = offset
+    offset += 4 * len(terms)
+    rows_offset = offset
+    offset += 16 * len(rows)
+    orders_offsets = [0, 0, 0]
+    for field in (1, 2):
+        orders_offsets[field] = offset
+        offset += 4 * len(rows)
+    indexes_offsets = [0, 0, 0]
+    for field in (0, 1, 2):
+        indexes_offsets[field] = offset
+        offset += 4 * (len(terms) + 1)
+    offset = (offset + 7) // 8 * 8
+    filter_offset = offset
+    offset += len(filter_data)
+    pool_offset = offset
+    offset += len(pool)
+    size = offset
+
+    fields = [SEGMENT_VERSION, len(terms), len(rows), len(pool), terms_offset, rows_offset]
+    fields += orders_offsets + indexes_offsets
+    fields += [pool_offset, filter_offset, filter_blocks_count, len(values), size]
+
+    checksum = 2166136261
+    for byte in struct.pack(HEADER_FORMAT, SEGMENT_MAGIC, *(fields + [0])):
+        checksum = ((checksum ^ byte) * 16777619) & MASK32
+
+    image = bytearray(size)
+    struct.pack_into(HEADER_FORMAT, image, 0, SEGMENT_MAGIC, *(fields + [checksum]))
+    struct.pack_into("<%dI" % len(terms), image, terms_offset, *term_offsets)
+    for i, row in enumerate(rows):
+        struct.pack_into("<3IBBH", image, rows_offset + 16 * i, row[0], row[1], row[2], row[3], row[4], 0)
+
+    for field in (0, 1, 2):
+        order, index = group_rows(rows, len(terms), field)
+        if field != 0:
+            struct.pack_into("<%dI" % len(order), image, orders_offsets[field], *order)
+        struct.pack_into("<%dI" % len(index), image, indexes_offsets[field], *index)
+
+    image[filter_offset:filter_offset + len(filter_data)] = filter_data
+    image[pool_offset:pool_offset + len(pool)] = pool
+
+    image += b"\0" * (-len(image) % 4)
+    return list(struct.unpack("<%dI" % (len(image) // 4), bytes(image)))
+
+
+def parse_entities(text):
+    """URIs of SMARTCARE_ENTITIES in their order and the rdf:type of each one."""
+    properties = re.findall(r'SSLOG_ONTOLOGY_PROPERTY\("([^"]+)"', text)
+    classes = re.findall(r'SSLOG_ONTOLOGY_CLASS\("([^"]+)"\)', text)
+    entities = re.findall(r'&SMARTCARE_(PROPERTIES|CLASSES)\[(\d+)\]\.entity', text)
+
+    uris = []
+    types = []
+    for (table, index) in entities:
+        if table == "PROPERTIES":
+            uris.append(properties[int(index)])
+            types.append(RDF_PROPERTY)
+        else:
+            uris.append(classes[int(index)])
+            types.append(RDFS_CLASS)
+
+    if len(uris) != len(properties) + len(classes) or len(set(uris)) != len(uris):
+        raise SystemExit("entities are not the same as classes and properties")
+
+    return uris, types
+
+
+def parse_table(text, name):
+    match = re.search(r"%s\[(\d+)\] = \{(.*?)\};" % name, text, re.S)
+    if match is None:
+        raise SystemExit("there is no table %s" % name)
+    values = [int(v, 0) for v in re.findall(r"-?(?:0x)?[0-9a-fA-F]+", match.group(2))]
+    if len(values) != int(match.group(1)):
+        raise SystemExit("size of %s is not the number of its values" % name)
+    return values
+
+
+def format_table(values, per_line, value_format):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(value_format % v for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def replace_table(text, declaration, name, values, per_line, value_format):
+    table = "%s %s[%d] = {\n%s\n};" % (declaration, name, len(values), format_table(values, per_line, value_format))
+    return re.sub(r"%s %s\[\d+\] = \{.*?\};" % (re.escape(declaration), name), lambda m: table, text, count=1, flags=re.S)
+
+
+def generate(text):
+    uris, types = parse_entities(text)
+    seeds, slots = build_hash(uris)
+    schema = build_segment([(uri, RDF_TYPE, rdf_class, RDF_TYPE_URI, RDF_TYPE_URI)
+                            for (uri, rdf_class) in zip(uris, types)])
+
+    text = replace_table(text, "static const uint32_t", "SMARTCARE_HASH_SEEDS", seeds, 8, "%u")
+    text = replace_table(text, "static const int16_t", "SMARTCARE_HASH_SLOTS", slots, 12, "%d")
+    text = replace_table(text, "static const uint32_t", "SMARTCARE_SCHEMA", schema, 6, "0x%08x")
+    text = re.sub(r"SMARTCARE_ENTITIES, \d+,", "SMARTCARE_ENTITIES, %d," % len(uris), text)
+    text = re.sub(r"SMARTCARE_HASH_SEEDS, \d+,", "SMARTCARE_HASH_SEEDS, %d," % len(seeds), text)
+    text = re.sub(r"SMARTCARE_HASH_SLOTS, \d+,", "SMARTCARE_HASH_SLOTS, %d," % len(slots), text)
+    return text
+
+
+def check(path, text):
+    uris, _ = parse_entities(text)
+    seeds = parse_table(text, "SMARTCARE_HASH_SEEDS")
+    slots = parse_table(text, "SMARTCARE_HASH_SLOTS")
+
+    errors = ["%s: %s is not found at %d" % (path, uri, index)
+              for index, uri in enumerate(uris) if find(uri, seeds, slots) != index]
+
+    if sorted(s for s in slots if s >= 0) != list(range(len(uris))):
+        errors.append("%s: slots are not the entities" % path)
+
+    if generate(text) != text:
+        errors.append("%s: tables are not up to date, run gen_ontology.py %s" % (path, path))
+
+    for error in errors:
+        print(error, file=sys.stderr)
+
+    if not errors:
+        print("%s: %d entities are found, tables are up to date" % (path, len(uris)))
+
+    return not errors
+
+
+def main(args):
+    is_check = len(args) > 0 and args[0] == "--check"
+    paths = args[1:] if is_check else args
+
+    if not paths:
+        raise SystemExit("usage: gen_ontology.py [--check] FILE...")
+
+    is_correct = True
+    for path in paths:
+        with open(path) as source:
+            text = source.read()
+        if is_check:
+            is_correct = check(path, text) and is_correct
+        else:
+            with open(path, "w") as target:
+                target.write(generate(text))
+
+    return 0 if is_correct else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
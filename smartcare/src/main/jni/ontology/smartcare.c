@@ -1,185 +1,604 @@
 #include "smartcare.h"
 
+#include "entity_internal.h"
+
+
+/* Classes and properties, they are not created at runtime. */
+static sslog_property_t SMARTCARE_PROPERTIES[] = {
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#responseFileUri", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsSubResponse", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#nextQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasFeedback", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#description", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#leftBipolar", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsFile", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#responseText", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#rangingItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#multipleItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasResponse", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#respondedTo", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#anweredTo", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#itemScore", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#code", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#dichotomousItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#firstQuestion", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasAnswer", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#hasResponseItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#linkedWithItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#containsText", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#itemText", NULL, SSLOG_PROPERTY_TYPE_DATA),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#singleItem", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#subAnswer", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+    SSLOG_ONTOLOGY_PROPERTY("http://oss.fruct.org/smartcare#rightBipolar", NULL, SSLOG_PROPERTY_TYPE_OBJECT),
+};
+
+static sslog_class_t SMARTCARE_CLASSES[] = {
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#RangingScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Questionnaire"),
+    SSLOG_ONTOLOGY_CLASS("http://www.w3.org/2002/07/owl#Thing"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Photo"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseText"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#LikertScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Audio"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Dichotomous"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ContinuousScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#File"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Choise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Text"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Feedback"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Answer"),
+    SSLOG_ONTOLOGY_CLASS("http://www.w3.org/2002/07/owl#Nothing"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#MultipleChoise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#GuttmanScale"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Item"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseFile"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Number"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Response"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Video"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Document"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#OpenAnswer"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Question"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ClosedAnswer"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Phone"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#ResponseItem"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Person"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#SingleChoise"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Validated"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#Email"),
+    SSLOG_ONTOLOGY_CLASS("http://oss.fruct.org/smartcare#BipolarQuestion"),
+};
+
+static sslog_entity_t *const SMARTCARE_ENTITIES[] = {
+    &SMARTCARE_PROPERTIES[0].entity,
+    &SMARTCARE_PROPERTIES[1].entity,
+    &SMARTCARE_PROPERTIES[2].entity,
+    &SMARTCARE_PROPERTIES[3].entity,
+    &SMARTCARE_PROPERTIES[4].entity,
+    &SMARTCARE_PROPERTIES[5].entity,
+    &SMARTCARE_PROPERTIES[6].entity,
+    &SMARTCARE_PROPERTIES[7].entity,
+    &SMARTCARE_PROPERTIES[8].entity,
+    &SMARTCARE_PROPERTIES[9].entity,
+    &SMARTCARE_PROPERTIES[10].entity,
+    &SMARTCARE_PROPERTIES[11].entity,
+    &SMARTCARE_PROPERTIES[12].entity,
+    &SMARTCARE_PROPERTIES[13].entity,
+    &SMARTCARE_PROPERTIES[14].entity,
+    &SMARTCARE_PROPERTIES[15].entity,
+    &SMARTCARE_PROPERTIES[16].entity,
+    &SMARTCARE_PROPERTIES[17].entity,
+    &SMARTCARE_PROPERTIES[18].entity,
+    &SMARTCARE_PROPERTIES[19].entity,
+    &SMARTCARE_PROPERTIES[20].entity,
+    &SMARTCARE_PROPERTIES[21].entity,
+    &SMARTCARE_PROPERTIES[22].entity,
+    &SMARTCARE_PROPERTIES[23].entity,
+    &SMARTCARE_PROPERTIES[24].entity,
+    &SMARTCARE_PROPERTIES[25].entity,
+    &SMARTCARE_CLASSES[0].entity,
+    &SMARTCARE_CLASSES[1].entity,
+    &SMARTCARE_CLASSES[2].entity,
+    &SMARTCARE_CLASSES[3].entity,
+    &SMARTCARE_CLASSES[4].entity,
+    &SMARTCARE_CLASSES[5].entity,
+    &SMARTCARE_CLASSES[6].entity,
+    &SMARTCARE_CLASSES[7].entity,
+    &SMARTCARE_CLASSES[8].entity,
+    &SMARTCARE_CLASSES[9].entity,
+    &SMARTCARE_CLASSES[10].entity,
+    &SMARTCARE_CLASSES[11].entity,
+    &SMARTCARE_CLASSES[12].entity,
+    &SMARTCARE_CLASSES[13].entity,
+    &SMARTCARE_CLASSES[14].entity,
+    &SMARTCARE_CLASSES[15].entity,
+    &SMARTCARE_CLASSES[16].entity,
+    &SMARTCARE_CLASSES[17].entity,
+    &SMARTCARE_CLASSES[18].entity,
+    &SMARTCARE_CLASSES[19].entity,
+    &SMARTCARE_CLASSES[20].entity,
+    &SMARTCARE_CLASSES[21].entity,
+    &SMARTCARE_CLASSES[22].entity,
+    &SMARTCARE_CLASSES[23].entity,
+    &SMARTCARE_CLASSES[24].entity,
+    &SMARTCARE_CLASSES[25].entity,
+    &SMARTCARE_CLASSES[26].entity,
+    &SMARTCARE_CLASSES[27].entity,
+    &SMARTCARE_CLASSES[28].entity,
+    &SMARTCARE_CLASSES[29].entity,
+    &SMARTCARE_CLASSES[30].entity,
+    &SMARTCARE_CLASSES[31].entity,
+    &SMARTCARE_CLASSES[32].entity,
+};
+
+
+/* Perfect hash of URIs (see sslog_ontology_t). This and the following tables
+ * are made by ontology/gen_ontology.py from the tables above, check them with
+ * "gen_ontology.py --check". */
+static const uint32_t SMARTCARE_HASH_SEEDS[15] = {
+    6, 1, 18, 8, 1, 5, 20, 13,
+    26, 5, 1, 5, 2, 18, 20,
+};
+
+static const int16_t SMARTCARE_HASH_SLOTS[73] = {
+    34, 6, 24, 51, 0, 17, -1, 28, 58, 20, 53, 29,
+    36, 1, 31, 42, -1, 48, 9, 16, 56, -1, 26, 10,
+    54, 25, -1, 37, 21, 8, -1, 2, 30, 18, 14, 52,
+    4, 12, 3, -1, 5, 38, -1, -1, -1, 45, 11, 35,
+    33, 44, 13, 41, -1, 55, 27, 7, 23, 49, -1, 22,
+    47, -1, -1, 40, 43, 39, 50, -1, 46, 15, 19, 32,
+    57,
+};
+
+
+/* Segment image with rdf:type triples of classes and properties (little-endian). */
+static const uint32_t SMARTCARE_SCHEMA[1536] = {
+    0x4f4c5353, 0x47455347, 0x00000002, 0x0000003e, 0x0000003b, 0x00000a36,
+    0x00000050, 0x00000148, 0x00000000, 0x000004f8, 0x000005e4, 0x000006d0,
+    0x000007cc, 0x000008c8, 0x00000dc8, 0x000009c8, 0x00000010, 0x00000076,
+    0x000017fe, 0xc4d531e1, 0x00000000, 0x00000026, 0x0000004b, 0x0000007a,
+    0x000000a0, 0x000000cc, 0x000000fb, 0x00000126, 0x0000014e, 0x00000173,
+    0x0000019b, 0x000001bf, 0x000001eb, 0x0000020f, 0x0000023a, 0x00000268,
+    0x0000028e, 0x000002b8, 0x000002de, 0x00000303, 0x00000328, 0x00000350,
+    0x0000037d, 0x000003a9, 0x000003d1, 0x000003fd, 0x00000429, 0x00000455,
+    0x00000481, 0x000004a5, 0x000004ce, 0x000004f3, 0x0000051c, 0x00000540,
+    0x0000056c, 0x0000059f, 0x000005cb, 0x000005f6, 0x00000625, 0x00000652,
+    0x0000067b, 0x000006a6, 0x000006d1, 0x000006fc, 0x0000072b, 0x00000754,
+    0x0000077c, 0x000007a7, 0x000007d5, 0x00000801, 0x0000082d, 0x00000858,
+    0x00000883, 0x000008b2, 0x000008de, 0x0000090a, 0x00000934, 0x0000095d,
+    0x00000991, 0x000009c1, 0x000009ec, 0x00000a12, 0x00000000, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000001, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000002, 0x0000003a, 0x0000003b, 0x00000101, 0x00000003, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000004, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000005, 0x0000003a, 0x0000003b, 0x00000101, 0x00000006, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000007, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000008, 0x0000003a, 0x0000003b, 0x00000101, 0x00000009, 0x0000003a,
+    0x0000003b, 0x00000101, 0x0000000a, 0x0000003a, 0x0000003b, 0x00000101,
+    0x0000000b, 0x0000003a, 0x0000003b, 0x00000101, 0x0000000c, 0x0000003a,
+    0x0000003b, 0x00000101, 0x0000000d, 0x0000003a, 0x0000003b, 0x00000101,
+    0x0000000e, 0x0000003a, 0x0000003b, 0x00000101, 0x0000000f, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000010, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000011, 0x0000003a, 0x0000003b, 0x00000101, 0x00000012, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000013, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000014, 0x0000003a, 0x0000003b, 0x00000101, 0x00000015, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000016, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000017, 0x0000003a, 0x0000003b, 0x00000101, 0x00000018, 0x0000003a,
+    0x0000003b, 0x00000101, 0x00000019, 0x0000003a, 0x0000003b, 0x00000101,
+    0x0000001a, 0x0000003a, 0x0000003b, 0x00000101, 0x0000001b, 0x0000003a,
+    0x0000003b, 0x00000101, 0x0000001c, 0x0000003a, 0x0000003b, 0x00000101,
+    0x0000001d, 0x0000003a, 0x0000003b, 0x00000101, 0x0000001e, 0x0000003a,
+    0x0000003b, 0x00000101, 0x0000001f, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000020, 0x0000003a, 0x00000039, 0x00000101, 0x00000021, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000022, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000023, 0x0000003a, 0x00000039, 0x00000101, 0x00000024, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000025, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000026, 0x0000003a, 0x00000039, 0x00000101, 0x00000027, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000028, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000029, 0x0000003a, 0x00000039, 0x00000101, 0x0000002a, 0x0000003a,
+    0x00000039, 0x00000101, 0x0000002b, 0x0000003a, 0x00000039, 0x00000101,
+    0x0000002c, 0x0000003a, 0x00000039, 0x00000101, 0x0000002d, 0x0000003a,
+    0x00000039, 0x00000101, 0x0000002e, 0x0000003a, 0x00000039, 0x00000101,
+    0x0000002f, 0x0000003a, 0x00000039, 0x00000101, 0x00000030, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000031, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000032, 0x0000003a, 0x00000039, 0x00000101, 0x00000033, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000034, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000035, 0x0000003a, 0x00000039, 0x00000101, 0x00000036, 0x0000003a,
+    0x00000039, 0x00000101, 0x00000037, 0x0000003a, 0x00000039, 0x00000101,
+    0x00000038, 0x0000003a, 0x00000039, 0x00000101, 0x0000003c, 0x0000003a,
+    0x0000003b, 0x00000101, 0x0000003d, 0x0000003a, 0x0000003b, 0x00000101,
+    0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004, 0x00000005,
+    0x00000006, 0x00000007, 0x00000008, 0x00000009, 0x0000000a, 0x0000000b,
+    0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f, 0x00000010, 0x00000011,
+    0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016, 0x00000017,
+    0x00000018, 0x00000019, 0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d,
+    0x0000001e, 0x0000001f, 0x00000020, 0x00000021, 0x00000022, 0x00000023,
+    0x00000024, 0x00000025, 0x00000026, 0x00000027, 0x00000028, 0x00000029,
+    0x0000002a, 0x0000002b, 0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f,
+    0x00000030, 0x00000031, 0x00000032, 0x00000033, 0x00000034, 0x00000035,
+    0x00000036, 0x00000037, 0x00000038, 0x00000039, 0x0000003a, 0x0000001f,
+    0x00000020, 0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025,
+    0x00000026, 0x00000027, 0x00000028, 0x00000029, 0x0000002a, 0x0000002b,
+    0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030, 0x00000031,
+    0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000000, 0x00000001, 0x00000002, 0x00000003, 0x00000004,
+    0x00000005, 0x00000006, 0x00000007, 0x00000008, 0x00000009, 0x0000000a,
+    0x0000000b, 0x0000000c, 0x0000000d, 0x0000000e, 0x0000000f, 0x00000010,
+    0x00000011, 0x00000012, 0x00000013, 0x00000014, 0x00000015, 0x00000016,
+    0x00000017, 0x00000018, 0x00000019, 0x0000001a, 0x0000001b, 0x0000001c,
+    0x0000001d, 0x0000001e, 0x00000039, 0x0000003a, 0x00000000, 0x00000001,
+    0x00000002, 0x00000003, 0x00000004, 0x00000005, 0x00000006, 0x00000007,
+    0x00000008, 0x00000009, 0x0000000a, 0x0000000b, 0x0000000c, 0x0000000d,
+    0x0000000e, 0x0000000f, 0x00000010, 0x00000011, 0x00000012, 0x00000013,
+    0x00000014, 0x00000015, 0x00000016, 0x00000017, 0x00000018, 0x00000019,
+    0x0000001a, 0x0000001b, 0x0000001c, 0x0000001d, 0x0000001e, 0x0000001f,
+    0x00000020, 0x00000021, 0x00000022, 0x00000023, 0x00000024, 0x00000025,
+    0x00000026, 0x00000027, 0x00000028, 0x00000029, 0x0000002a, 0x0000002b,
+    0x0000002c, 0x0000002d, 0x0000002e, 0x0000002f, 0x00000030, 0x00000031,
+    0x00000032, 0x00000033, 0x00000034, 0x00000035, 0x00000036, 0x00000037,
+    0x00000038, 0x00000039, 0x00000039, 0x00000039, 0x00000039, 0x0000003a,
+    0x0000003b, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x0000003b, 0x0000003b, 0x0000003b, 0x0000003b, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x0000001a, 0x0000001a, 0x0000003b, 0x0000003b,
+    0x0000003b, 0x00000000, 0x20040088, 0x00000000, 0x80000120, 0x00220c01,
+    0x00004000, 0x00800000, 0x00010004, 0x00000001, 0x00400000, 0x00000000,
+    0x00008020, 0x00008100, 0x00000000, 0x28000000, 0x00000000, 0x00000000,
+    0x10014020, 0x04080080, 0x30110804, 0x84080020, 0x80420812, 0x12000020,
+    0x00210000, 0x00004c10, 0x24008020, 0x210400e1, 0x01000060, 0x08800024,
+    0x002800c0, 0x20002400, 0x02200000, 0x02001900, 0x41220086, 0x80028001,
+    0x0900a010, 0x02182104, 0x05001010, 0x4a001300, 0x2a000080, 0x24100408,
+    0x0000a080, 0x04801000, 0x9200a200, 0x06000018, 0x00010002, 0x12420101,
+    0x10091003, 0x000c0080, 0x00400002, 0x00021008, 0x00000000, 0x00048000,
+    0x00200100, 0x01008000, 0x001000c0, 0x00044000, 0x09028400, 0x00002000,
+    0x00021108, 0x00000000, 0x00000091, 0x2000aa80, 0x00822000, 0x20100010,
+    0x00000000, 0x00004004, 0x00000020, 0x80000000, 0x00000040, 0x00008000,
+    0x00000400, 0x00001001, 0x00008000, 0x04000400, 0x00001004, 0x00008000,
+    0x00000400, 0x00a01020, 0x00040001, 0x00200000, 0x08000004, 0x01004010,
+    0x00001000, 0x41020000, 0x00023002, 0x000040a0, 0x00400100, 0x00000800,
+    0x20010000, 0x20800380, 0x00000000, 0x00002420, 0x80002000, 0x14028000,
+    0x40900100, 0x00030000, 0x00101000, 0x00002201, 0x05100400, 0x00044020,
+    0x00500083, 0x60001000, 0x00200400, 0x01800000, 0x00000024, 0x00100400,
+    0x00000401, 0x00400800, 0x02000400, 0x00002002, 0x42009000, 0x02000024,
+    0x03220808, 0x00200110, 0x003804e0, 0x031a0400, 0x02002088, 0x00008000,
+    0x0182808c, 0x20020008, 0x84010030, 0x51280018, 0x04044230, 0x20060000,
+    0x0010040d, 0x29000090, 0x00400006, 0x00000800, 0x00800000, 0x00000020,
+    0x00000002, 0x00000000, 0x00000040, 0x00000000, 0x08000000, 0x00000000,
+    0x00020000, 0x00080000, 0x80008000, 0x01000400, 0x00000000, 0x00000010,
+    0x00000000, 0x00000000, 0x00000000, 0x00000400, 0x00000000, 0x00400000,
+    0x40100000, 0x00000200, 0x00010010, 0x080a0000, 0x00001020, 0x00004000,
+    0x00020400, 0x04000000, 0x00000400, 0x00000080, 0x00080000, 0x80218002,
+    0x00290800, 0x00000140, 0x00000100, 0x00000024, 0x00004000, 0x00002402,
+    0x00210080, 0x00080002, 0x00020000, 0x10000210, 0x02440002, 0x01018120,
+    0x00000020, 0x00000080, 0x00000002, 0x00008000, 0x80000008, 0x00040040,
+    0x0000001c, 0x020040e0, 0x00080000, 0x00000000, 0x00000a00, 0x02000008,
+    0x00200002, 0x00189094, 0x00000000, 0x000010c8, 0x00000010, 0x68004000,
+    0x00281020, 0x00008000, 0x10001110, 0x20080020, 0x40001004, 0x1a001100,
+    0x00000044, 0x80060206, 0x60102000, 0x00000480, 0x00002000, 0x00000302,
+    0x10020000, 0x00008210, 0x10100081, 0x00000000, 0x00200000, 0x00000000,
+    0x00010000, 0x00001908, 0x00000020, 0x01000220, 0x18042880, 0x60404000,
+    0x18010400, 0x10090080, 0x80000802, 0x00002000, 0x00004000, 0x08822040,
+    0x08008000, 0x00014021, 0x00040004, 0x64082004, 0x20020400, 0x00020402,
+    0x00140000, 0x00200000, 0x05004800, 0x00000000, 0x24000811, 0x20080000,
+    0x00400000, 0x00000000, 0x08040000, 0x20080810, 0x20044010, 0x02011000,
+    0x00000000, 0x00400000, 0x00940440, 0x60010480, 0x00008000, 0x00042400,
+    0x00400000, 0x10400008, 0x00080804, 0x00000090, 0x80040000, 0x00600000,
+    0x25000000, 0x08004040, 0x0000a002, 0x08010128, 0x02200000, 0x00000200,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x41236572, 0x6577736e, 0x74680072, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x64754123,
+    0x68006f69, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x69422365, 0x616c6f70, 0x65755172, 0x6f697473,
+    0x7468006e, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772,
+    0x7472616d, 0x65726163, 0x6f684323, 0x00657369, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x43236572,
+    0x65736f6c, 0x736e4164, 0x00726577, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x43236572, 0x69746e6f,
+    0x756f756e, 0x61635373, 0x6800656c, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x69442365, 0x746f6863,
+    0x756f6d6f, 0x74680073, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x636f4423, 0x6e656d75, 0x74680074,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x616d4523, 0x68006c69, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x65462365, 0x61626465,
+    0x68006b63, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x69462365, 0x6800656c, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x75472365,
+    0x616d7474, 0x6163536e, 0x6800656c, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x74492365, 0x68006d65,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x694c2365, 0x7472656b, 0x6c616353, 0x74680065, 0x2f3a7074,
+    0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163,
+    0x6c754d23, 0x6c706974, 0x6f684365, 0x00657369, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x4e236572,
+    0x65626d75, 0x74680072, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x65704f23, 0x736e416e, 0x00726577,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x50236572, 0x6f737265, 0x7468006e, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6f685023,
+    0x6800656e, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x68502365, 0x006f746f, 0x70747468, 0x6f2f2f3a,
+    0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x51236572,
+    0x74736575, 0x006e6f69, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572,
+    0x67726f2e, 0x616d732f, 0x61637472, 0x51236572, 0x74736575, 0x6e6e6f69,
+    0x65726961, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x676e6152, 0x53676e69, 0x656c6163,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x70736552, 0x65736e6f, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x70736552, 0x65736e6f, 0x656c6946, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x70736552,
+    0x65736e6f, 0x6d657449, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x70736552, 0x65736e6f,
+    0x74786554, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x676e6953, 0x6843656c, 0x6573696f,
+    0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67,
+    0x63747261, 0x23657261, 0x74786554, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x696c6156,
+    0x65746164, 0x74680064, 0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463,
+    0x732f6772, 0x7472616d, 0x65726163, 0x64695623, 0x68006f65, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x6e612365, 0x65726577, 0x006f5464, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x63236572, 0x0065646f,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x63236572, 0x61746e6f, 0x46736e69, 0x00656c69, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x63236572, 0x61746e6f, 0x53736e69, 0x65526275, 0x6e6f7073, 0x68006573,
+    0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73,
+    0x72616374, 0x6f632365, 0x6961746e, 0x6554736e, 0x68007478, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x65642365, 0x69726373, 0x6f697470, 0x7468006e, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x63696423,
+    0x6f746f68, 0x73756f6d, 0x6d657449, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x73726966,
+    0x65755174, 0x6f697473, 0x7468006e, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x73616823, 0x77736e41,
+    0x68007265, 0x3a707474, 0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f,
+    0x72616d73, 0x72616374, 0x61682365, 0x65654673, 0x63616264, 0x7468006b,
+    0x2f3a7074, 0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d,
+    0x65726163, 0x73616823, 0x73657551, 0x6e6f6974, 0x74746800, 0x2f2f3a70,
+    0x2e73736f, 0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261,
+    0x52736168, 0x6f707365, 0x0065736e, 0x70747468, 0x6f2f2f3a, 0x662e7373,
+    0x74637572, 0x67726f2e, 0x616d732f, 0x61637472, 0x68236572, 0x65527361,
+    0x6e6f7073, 0x74496573, 0x68006d65, 0x3a707474, 0x736f2f2f, 0x72662e73,
+    0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x74692365, 0x63536d65,
+    0x0065726f, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x69236572, 0x546d6574, 0x00747865, 0x70747468,
+    0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f, 0x61637472,
+    0x6c236572, 0x42746665, 0x6c6f7069, 0x68007261, 0x3a707474, 0x736f2f2f,
+    0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374, 0x696c2365,
+    0x64656b6e, 0x68746957, 0x6d657449, 0x74746800, 0x2f2f3a70, 0x2e73736f,
+    0x63757266, 0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x746c756d,
+    0x656c7069, 0x6d657449, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266,
+    0x726f2e74, 0x6d732f67, 0x63747261, 0x23657261, 0x7478656e, 0x73657551,
+    0x6e6f6974, 0x74746800, 0x2f2f3a70, 0x2e73736f, 0x63757266, 0x726f2e74,
+    0x6d732f67, 0x63747261, 0x23657261, 0x676e6172, 0x49676e69, 0x006d6574,
+    0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e, 0x616d732f,
+    0x61637472, 0x72236572, 0x6f707365, 0x6465646e, 0x68006f54, 0x3a707474,
+    0x736f2f2f, 0x72662e73, 0x2e746375, 0x2f67726f, 0x72616d73, 0x72616374,
+    0x65722365, 0x6e6f7073, 0x69466573, 0x7255656c, 0x74680069, 0x2f3a7074,
+    0x73736f2f, 0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163,
+    0x73657223, 0x736e6f70, 0x78655465, 0x74680074, 0x2f3a7074, 0x73736f2f,
+    0x7572662e, 0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x67697223,
+    0x69427468, 0x616c6f70, 0x74680072, 0x2f3a7074, 0x73736f2f, 0x7572662e,
+    0x6f2e7463, 0x732f6772, 0x7472616d, 0x65726163, 0x6e697323, 0x49656c67,
+    0x006d6574, 0x70747468, 0x6f2f2f3a, 0x662e7373, 0x74637572, 0x67726f2e,
+    0x616d732f, 0x61637472, 0x73236572, 0x6e416275, 0x72657773, 0x74746800,
+    0x2f2f3a70, 0x2e777777, 0x6f2e3377, 0x312f6772, 0x2f393939, 0x322f3230,
+    0x64722d32, 0x79732d66, 0x7861746e, 0x23736e2d, 0x706f7250, 0x79747265,
+    0x74746800, 0x2f2f3a70, 0x2e777777, 0x6f2e3377, 0x312f6772, 0x2f393939,
+    0x322f3230, 0x64722d32, 0x79732d66, 0x7861746e, 0x23736e2d, 0x65707974,
+    0x74746800, 0x2f2f3a70, 0x2e777777, 0x6f2e3377, 0x322f6772, 0x2f303030,
+    0x722f3130, 0x732d6664, 0x6d656863, 0x6c432361, 0x00737361, 0x70747468,
+    0x772f2f3a, 0x772e7777, 0x726f2e33, 0x30322f67, 0x302f3230, 0x776f2f37,
+    0x6f4e236c, 0x6e696874, 0x74680067, 0x2f3a7074, 0x7777772f, 0x2e33772e,
+    0x2f67726f, 0x32303032, 0x2f37302f, 0x236c776f, 0x6e696854, 0x00000067,
+};
+
+
+const sslog_ontology_t SMARTCARE_ONTOLOGY = {
+    "smartcare",
+    SMARTCARE_ENTITIES, 59,
+    SMARTCARE_HASH_SEEDS, 15,
+    SMARTCARE_HASH_SLOTS, 73,
+    SMARTCARE_SCHEMA, sizeof(SMARTCARE_SCHEMA)
+};
 
 
 #if INCLUDE_CLASS_RANGINGSCALE
-sslog_class_t *CLASS_RANGINGSCALE;
+sslog_class_t *CLASS_RANGINGSCALE = &SMARTCARE_CLASSES[0];
 #endif
 #if INCLUDE_CLASS_QUESTIONNAIRE
-sslog_class_t *CLASS_QUESTIONNAIRE;
+sslog_class_t *CLASS_QUESTIONNAIRE = &SMARTCARE_CLASSES[1];
 #endif
 #if INCLUDE_CLASS_THING
-sslog_class_t *CLASS_THING;
+sslog_class_t *CLASS_THING = &SMARTCARE_CLASSES[2];
 #endif
 #if INCLUDE_CLASS_PHOTO
-sslog_class_t *CLASS_PHOTO;
+sslog_class_t *CLASS_PHOTO = &SMARTCARE_CLASSES[3];
 #endif
 #if INCLUDE_CLASS_RESPONSETEXT
-sslog_class_t *CLASS_RESPONSETEXT;
+sslog_class_t *CLASS_RESPONSETEXT = &SMARTCARE_CLASSES[4];
 #endif
 #if INCLUDE_CLASS_LIKERTSCALE
-sslog_class_t *CLASS_LIKERTSCALE;
+sslog_class_t *CLASS_LIKERTSCALE = &SMARTCARE_CLASSES[5];
 #endif
 #if INCLUDE_CLASS_AUDIO
-sslog_class_t *CLASS_AUDIO;
+sslog_class_t *CLASS_AUDIO = &SMARTCARE_CLASSES[6];
 #endif
 #if INCLUDE_CLASS_DICHOTOMOUS
-sslog_class_t *CLASS_DICHOTOMOUS;
+sslog_class_t *CLASS_DICHOTOMOUS = &SMARTCARE_CLASSES[7];
 #endif
 #if INCLUDE_CLASS_CONTINUOUSSCALE
-sslog_class_t *CLASS_CONTINUOUSSCALE;
+sslog_class_t *CLASS_CONTINUOUSSCALE = &SMARTCARE_CLASSES[8];
 #endif
 #if INCLUDE_CLASS_FILE
-sslog_class_t *CLASS_FILE;
+sslog_class_t *CLASS_FILE = &SMARTCARE_CLASSES[9];
 #endif
 #if INCLUDE_CLASS_CHOISE
-sslog_class_t *CLASS_CHOISE;
+sslog_class_t *CLASS_CHOISE = &SMARTCARE_CLASSES[10];
 #endif
 #if INCLUDE_CLASS_TEXT
-sslog_class_t *CLASS_TEXT;
+sslog_class_t *CLASS_TEXT = &SMARTCARE_CLASSES[11];
 #endif
 #if INCLUDE_CLASS_FEEDBACK
-sslog_class_t *CLASS_FEEDBACK;
+sslog_class_t *CLASS_FEEDBACK = &SMARTCARE_CLASSES[12];
 #endif
 #if INCLUDE_CLASS_ANSWER
-sslog_class_t *CLASS_ANSWER;
+sslog_class_t *CLASS_ANSWER = &SMARTCARE_CLASSES[13];
 #endif
 #if INCLUDE_CLASS_NOTHING
-sslog_class_t *CLASS_NOTHING;
+sslog_class_t *CLASS_NOTHING = &SMARTCARE_CLASSES[14];
 #endif
 #if INCLUDE_CLASS_MULTIPLECHOISE
-sslog_class_t *CLASS_MULTIPLECHOISE;
+sslog_class_t *CLASS_MULTIPLECHOISE = &SMARTCARE_CLASSES[15];
 #endif
 #if INCLUDE_CLASS_GUTTMANSCALE
-sslog_class_t *CLASS_GUTTMANSCALE;
+sslog_class_t *CLASS_GUTTMANSCALE = &SMARTCARE_CLASSES[16];
 #endif
 #if INCLUDE_CLASS_ITEM
-sslog_class_t *CLASS_ITEM;
+sslog_class_t *CLASS_ITEM = &SMARTCARE_CLASSES[17];
 #endif
 #if INCLUDE_CLASS_RESPONSEFILE
-sslog_class_t *CLASS_RESPONSEFILE;
+sslog_class_t *CLASS_RESPONSEFILE = &SMARTCARE_CLASSES[18];
 #endif
 #if INCLUDE_CLASS_NUMBER
-sslog_class_t *CLASS_NUMBER;
+sslog_class_t *CLASS_NUMBER = &SMARTCARE_CLASSES[19];
 #endif
 #if INCLUDE_CLASS_RESPONSE
-sslog_class_t *CLASS_RESPONSE;
+sslog_class_t *CLASS_RESPONSE = &SMARTCARE_CLASSES[20];
 #endif
 #if INCLUDE_CLASS_VIDEO
-sslog_class_t *CLASS_VIDEO;
+sslog_class_t *CLASS_VIDEO = &SMARTCARE_CLASSES[21];
 #endif
 #if INCLUDE_CLASS_DOCUMENT
-sslog_class_t *CLASS_DOCUMENT;
+sslog_class_t *CLASS_DOCUMENT = &SMARTCARE_CLASSES[22];
 #endif
 #if INCLUDE_CLASS_OPENANSWER
-sslog_class_t *CLASS_OPENANSWER;
+sslog_class_t *CLASS_OPENANSWER = &SMARTCARE_CLASSES[23];
 #endif
 #if INCLUDE_CLASS_QUESTION
-sslog_class_t *CLASS_QUESTION;
+sslog_class_t *CLASS_QUESTION = &SMARTCARE_CLASSES[24];
 #endif
 #if INCLUDE_CLASS_CLOSEDANSWER
-sslog_class_t *CLASS_CLOSEDANSWER;
+sslog_class_t *CLASS_CLOSEDANSWER = &SMARTCARE_CLASSES[25];
 #endif
 #if INCLUDE_CLASS_PHONE
-sslog_class_t *CLASS_PHONE;
+sslog_class_t *CLASS_PHONE = &SMARTCARE_CLASSES[26];
 #endif
 #if INCLUDE_CLASS_RESPONSEITEM
-sslog_class_t *CLASS_RESPONSEITEM;
+sslog_class_t *CLASS_RESPONSEITEM = &SMARTCARE_CLASSES[27];
 #endif
 #if INCLUDE_CLASS_PERSON
-sslog_class_t *CLASS_PERSON;
+sslog_class_t *CLASS_PERSON = &SMARTCARE_CLASSES[28];
 #endif
 #if INCLUDE_CLASS_SINGLECHOISE
-sslog_class_t *CLASS_SINGLECHOISE;
+sslog_class_t *CLASS_SINGLECHOISE = &SMARTCARE_CLASSES[29];
 #endif
 #if INCLUDE_CLASS_VALIDATED
-sslog_class_t *CLASS_VALIDATED;
+sslog_class_t *CLASS_VALIDATED = &SMARTCARE_CLASSES[30];
 #endif
 #if INCLUDE_CLASS_EMAIL
-sslog_class_t *CLASS_EMAIL;
+sslog_class_t *CLASS_EMAIL = &SMARTCARE_CLASSES[31];
 #endif
 #if INCLUDE_CLASS_BIPOLARQUESTION
-sslog_class_t *CLASS_BIPOLARQUESTION;
+sslog_class_t *CLASS_BIPOLARQUESTION = &SMARTCARE_CLASSES[32];
 #endif
 
 
 #if INCLUDE_PROPERTY_RESPONSEFILEURI
-sslog_property_t *PROPERTY_RESPONSEFILEURI;
+sslog_property_t *PROPERTY_RESPONSEFILEURI = &SMARTCARE_PROPERTIES[0];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSSUBRESPONSE
-sslog_property_t *PROPERTY_CONTAINSSUBRESPONSE;
+sslog_property_t *PROPERTY_CONTAINSSUBRESPONSE = &SMARTCARE_PROPERTIES[1];
 #endif
 #if INCLUDE_PROPERTY_NEXTQUESTION
-sslog_property_t *PROPERTY_NEXTQUESTION;
+sslog_property_t *PROPERTY_NEXTQUESTION = &SMARTCARE_PROPERTIES[2];
 #endif
 #if INCLUDE_PROPERTY_HASFEEDBACK
-sslog_property_t *PROPERTY_HASFEEDBACK;
+sslog_property_t *PROPERTY_HASFEEDBACK = &SMARTCARE_PROPERTIES[3];
 #endif
 #if INCLUDE_PROPERTY_HASQUESTION
-sslog_property_t *PROPERTY_HASQUESTION;
+sslog_property_t *PROPERTY_HASQUESTION = &SMARTCARE_PROPERTIES[4];
 #endif
 #if INCLUDE_PROPERTY_DESCRIPTION
-sslog_property_t *PROPERTY_DESCRIPTION;
+sslog_property_t *PROPERTY_DESCRIPTION = &SMARTCARE_PROPERTIES[5];
 #endif
 #if INCLUDE_PROPERTY_LEFTBIPOLAR
-sslog_property_t *PROPERTY_LEFTBIPOLAR;
+sslog_property_t *PROPERTY_LEFTBIPOLAR = &SMARTCARE_PROPERTIES[6];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSFILE
-sslog_property_t *PROPERTY_CONTAINSFILE;
+sslog_property_t *PROPERTY_CONTAINSFILE = &SMARTCARE_PROPERTIES[7];
 #endif
 #if INCLUDE_PROPERTY_RESPONSETEXT
-sslog_property_t *PROPERTY_RESPONSETEXT;
+sslog_property_t *PROPERTY_RESPONSETEXT = &SMARTCARE_PROPERTIES[8];
 #endif
 #if INCLUDE_PROPERTY_RANGINGITEM
-sslog_property_t *PROPERTY_RANGINGITEM;
+sslog_property_t *PROPERTY_RANGINGITEM = &SMARTCARE_PROPERTIES[9];
 #endif
 #if INCLUDE_PROPERTY_MULTIPLEITEM
-sslog_property_t *PROPERTY_MULTIPLEITEM;
+sslog_property_t *PROPERTY_MULTIPLEITEM = &SMARTCARE_PROPERTIES[10];
 #endif
 #if INCLUDE_PROPERTY_HASRESPONSE
-sslog_property_t *PROPERTY_HASRESPONSE;
+sslog_property_t *PROPERTY_HASRESPONSE = &SMARTCARE_PROPERTIES[11];
 #endif
 #if INCLUDE_PROPERTY_RESPONDEDTO
-sslog_property_t *PROPERTY_RESPONDEDTO;
+sslog_property_t *PROPERTY_RESPONDEDTO = &SMARTCARE_PROPERTIES[12];
 #endif
 #if INCLUDE_PROPERTY_ANWEREDTO
-sslog_property_t *PROPERTY_ANWEREDTO;
+sslog_property_t *PROPERTY_ANWEREDTO = &SMARTCARE_PROPERTIES[13];
 #endif
 #if INCLUDE_PROPERTY_ITEMSCORE
-sslog_property_t *PROPERTY_ITEMSCORE;
+sslog_property_t *PROPERTY_ITEMSCORE = &SMARTCARE_PROPERTIES[14];
 #endif
 #if INCLUDE_PROPERTY_CODE
-sslog_property_t *PROPERTY_CODE;
+sslog_property_t *PROPERTY_CODE = &SMARTCARE_PROPERTIES[15];
 #endif
 #if INCLUDE_PROPERTY_DICHOTOMOUSITEM
-sslog_property_t *PROPERTY_DICHOTOMOUSITEM;
+sslog_property_t *PROPERTY_DICHOTOMOUSITEM = &SMARTCARE_PROPERTIES[16];
 #endif
 #if INCLUDE_PROPERTY_FIRSTQUESTION
-sslog_property_t *PROPERTY_FIRSTQUESTION;
+sslog_property_t *PROPERTY_FIRSTQUESTION = &SMARTCARE_PROPERTIES[17];
 #endif
 #if INCLUDE_PROPERTY_HASANSWER
-sslog_property_t *PROPERTY_HASANSWER;
+sslog_property_t *PROPERTY_HASANSWER = &SMARTCARE_PROPERTIES[18];
 #endif
 #if INCLUDE_PROPERTY_HASRESPONSEITEM
-sslog_property_t *PROPERTY_HASRESPONSEITEM;
+sslog_property_t *PROPERTY_HASRESPONSEITEM = &SMARTCARE_PROPERTIES[19];
 #endif
 #if INCLUDE_PROPERTY_LINKEDWITHITEM
-sslog_property_t *PROPERTY_LINKEDWITHITEM;
+sslog_property_t *PROPERTY_LINKEDWITHITEM = &SMARTCARE_PROPERTIES[20];
 #endif
 #if INCLUDE_PROPERTY_CONTAINSTEXT
-sslog_property_t *PROPERTY_CONTAINSTEXT;
+sslog_property_t *PROPERTY_CONTAINSTEXT = &SMARTCARE_PROPERTIES[21];
 #endif
 #if INCLUDE_PROPERTY_ITEMTEXT
-sslog_property_t *PROPERTY_ITEMTEXT;
+sslog_property_t *PROPERTY_ITEMTEXT = &SMARTCARE_PROPERTIES[22];
 #endif
 #if INCLUDE_PROPERTY_SINGLEITEM
-sslog_property_t *PROPERTY_SINGLEITEM;
+sslog_property_t *PROPERTY_SINGLEITEM = &SMARTCARE_PROPERTIES[23];
 #endif
 #if INCLUDE_PROPERTY_SUBANSWER
-sslog_property_t *PROPERTY_SUBANSWER;
+sslog_property_t *PROPERTY_SUBANSWER = &SMARTCARE_PROPERTIES[24];
 #endif
 #if INCLUDE_PROPERTY_RIGHTBIPOLAR
-sslog_property_t *PROPERTY_RIGHTBIPOLAR;
+sslog_property_t *PROPERTY_RIGHTBIPOLAR = &SMARTCARE_PROPERTIES[25];
 #endif
 
 
@@ -187,193 +606,13 @@ sslog_property_t *PROPERTY_RIGHTBIPOLAR;
 /**
  * @brief Register ontology.
  *
- * It creates all structures, such as classes and properties. Use it firs in your propgramm.
+ * Classes and properties are static, it attaches them and schema triples
+ * to the store of the default session. Use it first in your program.
  */
 void register_ontology()
-{    
-#if INCLUDE_PROPERTY_RESPONSEFILEURI
-PROPERTY_RESPONSEFILEURI =  sslog_new_property("http://oss.fruct.org/smartcare#responseFileUri", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSSUBRESPONSE
-PROPERTY_CONTAINSSUBRESPONSE =  sslog_new_property("http://oss.fruct.org/smartcare#containsSubResponse", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_NEXTQUESTION
-PROPERTY_NEXTQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#nextQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASFEEDBACK
-PROPERTY_HASFEEDBACK =  sslog_new_property("http://oss.fruct.org/smartcare#hasFeedback", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASQUESTION
-PROPERTY_HASQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#hasQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_DESCRIPTION
-PROPERTY_DESCRIPTION =  sslog_new_property("http://oss.fruct.org/smartcare#description", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_LEFTBIPOLAR
-PROPERTY_LEFTBIPOLAR =  sslog_new_property("http://oss.fruct.org/smartcare#leftBipolar", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSFILE
-PROPERTY_CONTAINSFILE =  sslog_new_property("http://oss.fruct.org/smartcare#containsFile", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RESPONSETEXT
-PROPERTY_RESPONSETEXT =  sslog_new_property("http://oss.fruct.org/smartcare#responseText", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_RANGINGITEM
-PROPERTY_RANGINGITEM =  sslog_new_property("http://oss.fruct.org/smartcare#rangingItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_MULTIPLEITEM
-PROPERTY_MULTIPLEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#multipleItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASRESPONSE
-PROPERTY_HASRESPONSE =  sslog_new_property("http://oss.fruct.org/smartcare#hasResponse", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RESPONDEDTO
-PROPERTY_RESPONDEDTO =  sslog_new_property("http://oss.fruct.org/smartcare#respondedTo", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ANWEREDTO
-PROPERTY_ANWEREDTO =  sslog_new_property("http://oss.fruct.org/smartcare#anweredTo", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ITEMSCORE
-PROPERTY_ITEMSCORE =  sslog_new_property("http://oss.fruct.org/smartcare#itemScore", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_CODE
-PROPERTY_CODE =  sslog_new_property("http://oss.fruct.org/smartcare#code", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_DICHOTOMOUSITEM
-PROPERTY_DICHOTOMOUSITEM =  sslog_new_property("http://oss.fruct.org/smartcare#dichotomousItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_FIRSTQUESTION
-PROPERTY_FIRSTQUESTION =  sslog_new_property("http://oss.fruct.org/smartcare#firstQuestion", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASANSWER
-PROPERTY_HASANSWER =  sslog_new_property("http://oss.fruct.org/smartcare#hasAnswer", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_HASRESPONSEITEM
-PROPERTY_HASRESPONSEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#hasResponseItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_LINKEDWITHITEM
-PROPERTY_LINKEDWITHITEM =  sslog_new_property("http://oss.fruct.org/smartcare#linkedWithItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_CONTAINSTEXT
-PROPERTY_CONTAINSTEXT =  sslog_new_property("http://oss.fruct.org/smartcare#containsText", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_ITEMTEXT
-PROPERTY_ITEMTEXT =  sslog_new_property("http://oss.fruct.org/smartcare#itemText", SSLOG_PROPERTY_TYPE_DATA);
-#endif
-#if INCLUDE_PROPERTY_SINGLEITEM
-PROPERTY_SINGLEITEM =  sslog_new_property("http://oss.fruct.org/smartcare#singleItem", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_SUBANSWER
-PROPERTY_SUBANSWER =  sslog_new_property("http://oss.fruct.org/smartcare#subAnswer", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-#if INCLUDE_PROPERTY_RIGHTBIPOLAR
-PROPERTY_RIGHTBIPOLAR =  sslog_new_property("http://oss.fruct.org/smartcare#rightBipolar", SSLOG_PROPERTY_TYPE_OBJECT);
-#endif
-
-
-
-#if INCLUDE_CLASS_RANGINGSCALE
-CLASS_RANGINGSCALE = sslog_new_class("http://oss.fruct.org/smartcare#RangingScale");
-#endif
-#if INCLUDE_CLASS_QUESTIONNAIRE
-CLASS_QUESTIONNAIRE = sslog_new_class("http://oss.fruct.org/smartcare#Questionnaire");
-#endif
-#if INCLUDE_CLASS_THING
-CLASS_THING = sslog_new_class("http://www.w3.org/2002/07/owl#Thing");
-#endif
-#if INCLUDE_CLASS_PHOTO
-CLASS_PHOTO = sslog_new_class("http://oss.fruct.org/smartcare#Photo");
-#endif
-#if INCLUDE_CLASS_RESPONSETEXT
-CLASS_RESPONSETEXT = sslog_new_class("http://oss.fruct.org/smartcare#ResponseText");
-#endif
-#if INCLUDE_CLASS_LIKERTSCALE
-CLASS_LIKERTSCALE = sslog_new_class("http://oss.fruct.org/smartcare#LikertScale");
-#endif
-#if INCLUDE_CLASS_AUDIO
-CLASS_AUDIO = sslog_new_class("http://oss.fruct.org/smartcare#Audio");
-#endif
-#if INCLUDE_CLASS_DICHOTOMOUS
-CLASS_DICHOTOMOUS = sslog_new_class("http://oss.fruct.org/smartcare#Dichotomous");
-#endif
-#if INCLUDE_CLASS_CONTINUOUSSCALE
-CLASS_CONTINUOUSSCALE = sslog_new_class("http://oss.fruct.org/smartcare#ContinuousScale");
-#endif
-#if INCLUDE_CLASS_FILE
-CLASS_FILE = sslog_new_class("http://oss.fruct.org/smartcare#File");
-#endif
-#if INCLUDE_CLASS_CHOISE
-CLASS_CHOISE = sslog_new_class("http://oss.fruct.org/smartcare#Choise");
-#endif
-#if INCLUDE_CLASS_TEXT
-CLASS_TEXT = sslog_new_class("http://oss.fruct.org/smartcare#Text");
-#endif
-#if INCLUDE_CLASS_FEEDBACK
-CLASS_FEEDBACK = sslog_new_class("http://oss.fruct.org/smartcare#Feedback");
-#endif
-#if INCLUDE_CLASS_ANSWER
-CLASS_ANSWER = sslog_new_class("http://oss.fruct.org/smartcare#Answer");
-#endif
-#if INCLUDE_CLASS_NOTHING
-CLASS_NOTHING = sslog_new_class("http://www.w3.org/2002/07/owl#Nothing");
-#endif
-#if INCLUDE_CLASS_MULTIPLECHOISE
-CLASS_MULTIPLECHOISE = sslog_new_class("http://oss.fruct.org/smartcare#MultipleChoise");
-#endif
-#if INCLUDE_CLASS_GUTTMANSCALE
-CLASS_GUTTMANSCALE = sslog_new_class("http://oss.fruct.org/smartcare#GuttmanScale");
-#endif
-#if INCLUDE_CLASS_ITEM
-CLASS_ITEM = sslog_new_class("http://oss.fruct.org/smartcare#Item");
-#endif
-#if INCLUDE_CLASS_RESPONSEFILE
-CLASS_RESPONSEFILE = sslog_new_class("http://oss.fruct.org/smartcare#ResponseFile");
-#endif
-#if INCLUDE_CLASS_NUMBER
-CLASS_NUMBER = sslog_new_class("http://oss.fruct.org/smartcare#Number");
-#endif
-#if INCLUDE_CLASS_RESPONSE
-CLASS_RESPONSE = sslog_new_class("http://oss.fruct.org/smartcare#Response");
-#endif
-#if INCLUDE_CLASS_VIDEO
-CLASS_VIDEO = sslog_new_class("http://oss.fruct.org/smartcare#Video");
-#endif
-#if INCLUDE_CLASS_DOCUMENT
-CLASS_DOCUMENT = sslog_new_class("http://oss.fruct.org/smartcare#Document");
-#endif
-#if INCLUDE_CLASS_OPENANSWER
-CLASS_OPENANSWER = sslog_new_class("http://oss.fruct.org/smartcare#OpenAnswer");
-#endif
-#if INCLUDE_CLASS_QUESTION
-CLASS_QUESTION = sslog_new_class("http://oss.fruct.org/smartcare#Question");
-#endif
-#if INCLUDE_CLASS_CLOSEDANSWER
-CLASS_CLOSEDANSWER = sslog_new_class("http://oss.fruct.org/smartcare#ClosedAnswer");
-#endif
-#if INCLUDE_CLASS_PHONE
-CLASS_PHONE = sslog_new_class("http://oss.fruct.org/smartcare#Phone");
-#endif
-#if INCLUDE_CLASS_RESPONSEITEM
-CLASS_RESPONSEITEM = sslog_new_class("http://oss.fruct.org/smartcare#ResponseItem");
-#endif
-#if INCLUDE_CLASS_PERSON
-CLASS_PERSON = sslog_new_class("http://oss.fruct.org/smartcare#Person");
-#endif
-#if INCLUDE_CLASS_SINGLECHOISE
-CLASS_SINGLECHOISE = sslog_new_class("http://oss.fruct.org/smartcare#SingleChoise");
-#endif
-#if INCLUDE_CLASS_VALIDATED
-CLASS_VALIDATED = sslog_new_class("http://oss.fruct.org/smartcare#Validated");
-#endif
-#if INCLUDE_CLASS_EMAIL
-CLASS_EMAIL = sslog_new_class("http://oss.fruct.org/smartcare#Email");
-#endif
-#if INCLUDE_CLASS_BIPOLARQUESTION
-CLASS_BIPOLARQUESTION = sslog_new_class("http://oss.fruct.org/smartcare#BipolarQuestion");
-#endif
-
-
-
+{
+    sslog_session_register_ontology(NULL, &SMARTCARE_ONTOLOGY);
 }
 
 
+
@@ -323,6 +323,9 @@ extern sslog_property_t *PROPERTY_RIGHTBIPOLAR;
 
 
 
+/** @brief Generated ontology: static classes, properties and schema triples. */
+extern const sslog_ontology_t SMARTCARE_ONTOLOGY;
+
 void register_ontology();
 
 	
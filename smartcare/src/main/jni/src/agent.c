@@ -6,57 +6,164 @@
 #include <errno.h>
 #include <string.h>
 #include <unistd.h>
+#include <pthread.h>
 
 #include <android/log.h>
 
 #include <jni.h>
 
 #include "agent.h"
+#include "handles.h"
 #include "handlers.h"
 #include "globals.h"
+#include "tasks.h"
+#include "marshal.h"
+#include "answer_types.h"
 
 #define TAG "SS"
 
 #define RDF_TYPE "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"
+
+/* Questionnaire graph is prefetched without limit of links (question chain can be long) */
+#define KP_PREFETCH_MAX_DEPTH (-1)
+
+/* Individuals of the questionnaire graph: all individuals that are reachable by links */
+#define KP_QUESTIONNAIRE_PATH \
+    "<%s> (sc:firstQuestion|sc:nextQuestion|sc:hasAnswer|sc:singleItem|sc:multipleItem" \
+    "|sc:dichotomousItem|sc:rangingItem|sc:leftBipolar|sc:rightBipolar|sc:subAnswer)* ?s . "
+
+/* Whole questionnaire graph with one request */
+#define KP_QUESTIONNAIRE_CONSTRUCT \
+    "PREFIX sc: <http://oss.fruct.org/smartcare#> " \
+    "CONSTRUCT { ?s ?p ?o } WHERE { " KP_QUESTIONNAIRE_PATH "?s ?p ?o }"
+
+/*
+ * Version of the individual, it is changed by the editor of the questionnaire
+ * when data properties are changed (links are compared without versions).
+ * Questionnaires of smart spaces without versions are not synchronized
+ */
+#define KP_VERSION_URI "http://oss.fruct.org/smartcare#version"
+
+/* Fingerprints of the questionnaire graph: links and versions only */
+#define KP_QUESTIONNAIRE_FINGERPRINT \
+    "PREFIX sc: <http://oss.fruct.org/smartcare#> " \
+    "CONSTRUCT { ?s ?p ?o } WHERE { " KP_QUESTIONNAIRE_PATH "?s ?p ?o . " \
+    "FILTER (?p = sc:firstQuestion || ?p = sc:nextQuestion || ?p = sc:hasAnswer || ?p = sc:singleItem" \
+    " || ?p = sc:multipleItem || ?p = sc:dichotomousItem || ?p = sc:rangingItem || ?p = sc:leftBipolar" \
+    " || ?p = sc:rightBipolar || ?p = sc:subAnswer || ?p = sc:version) }"
+/* Identifier of the node in the smart space, the number of the connection is added */
+#define KP_NODE_ID "KP_Volunteer"
+
+/* Maximum number of connections that construct questionnaires at the same time */
+#define KP_FETCH_WORKERS_MAX 8
+
+/*
+ * Memory limit of the local store, least recently used individuals are evicted
+ * and they are got again from the smart space when the questionnaire is read
+ */
+#define KP_STORE_LIMIT (4 * 1024 * 1024)
+
 /*
- * Connecting to smartspace
+ * Questionnaires that are constructed by workers, each worker has its own node
+ * and takes the next questionnaire until all of them are constructed
  */
-long kp_connect_smartspace(char *hostname_,char *ip_, int port){
+typedef struct kp_fetch_s {
     sslog_node_t *node;
-    sslog_init();
+    char **queries;
+    /* Constructed triples of each questionnaire, NULL - error */
+    list_t **triples;
+    int count;
+    volatile int next;
+} kp_fetch_t;
+
+static void kp_fetch_questionnaires(kp_fetch_t *fetch, sslog_node_t *node);
+static void* kp_fetch_run(void *data);
+
+/* Library is initialized once, nodes can be created by any thread */
+static pthread_once_t kp_library_once = PTHREAD_ONCE_INIT;
+static int kp_library_result = -1;
+static int kp_node_index = 0;
+
+static void kp_init_library(){
+    if (sslog_init() != SSLOG_ERROR_NO){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Can't init the library: %s", sslog_error_get_last_text());
+        return;
+    }
+    register_ontology();
+    kp_init_answer_types();
+    sslog_session_set_store_limit(NULL, KP_STORE_LIMIT);
+    kp_library_result = 0;
+}
 
-    //__android_log_print(ANDROID_LOG_INFO, TAG, "sslog_init");
+/* Additional connection to the smart space of the node, NULL if it can't join */
+/* Node leaves the smartspace when its handle is removed and it is not used */
+static void kp_free_node(JNIEnv* env, void *node){
+    sslog_node_leave((sslog_node_t *) node);
+    sslog_free_node((sslog_node_t *) node);
+}
 
-    node = sslog_new_node("KP_Volunteer", hostname_, ip_, port);
-    /*
-     * Delete this line when test
-     */
-    GlobalNode = node;
+static sslog_node_t* kp_new_worker_node(sslog_node_t *node){
+    char *node_id = NULL;
+    if (asprintf(&node_id, "%s_%d", KP_NODE_ID, __sync_add_and_fetch(&kp_node_index, 1)) == -1){
+        return NULL;
+    }
 
-    register_ontology(node);
+    sslog_node_t *worker_node = sslog_new_node_copy(node, node_id);
+    free(node_id);
 
-    //__android_log_print(ANDROID_LOG_INFO, TAG, "register_ontology");
+    if (worker_node != NULL && sslog_node_join(worker_node) != SSLOG_ERROR_NO){
+        sslog_free_node(worker_node);
+        return NULL;
+    }
+    return worker_node;
+}
 
-    if (sslog_node_join(node) != SSLOG_ERROR_NO) {
-        //__android_log_print(ANDROID_LOG_INFO, TAG, "Can't join to SS");
+/*
+ * Connecting to smartspace, returns the handle of the node (see handles.h) or -1,
+ * several nodes can be connected at the same time
+ */
+jlong kp_connect_smartspace(const char *hostname_, const char *ip_, int port){
+    pthread_once(&kp_library_once, kp_init_library);
+    if (kp_library_result != 0){
         return -1;
     }
-    else{
-        //__android_log_print(ANDROID_LOG_INFO, TAG, "KP joins to SS.");
-        return (long) node;
+
+    char *node_id = NULL;
+    if (asprintf(&node_id, "%s_%d", KP_NODE_ID, __sync_add_and_fetch(&kp_node_index, 1)) == -1){
+        return -1;
     }
-}
 
-int kp_disconnect_smartspace(long nodeDescriptor){
-    sslog_node_t *node = (sslog_node_t *) nodeDescriptor;
+    sslog_node_t *node = sslog_new_node(node_id, hostname_, ip_, port);
+    free(node_id);
+
     if (node == NULL){
         return -1;
     }
 
-    //sslog_sbcr_unsubscribe_all(node, true);
-    sslog_node_leave(node);
-    sslog_shutdown();
-    return 0;
+    if (sslog_node_join(node) != SSLOG_ERROR_NO) {
+        //__android_log_print(ANDROID_LOG_INFO, TAG, "Can't join to SS");
+        sslog_free_node(node);
+        return -1;
+    }
+
+    jlong handle = kp_handles_add(KP_HANDLE_NODE, node, kp_free_node);
+    if (handle == -1){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Too many nodes");
+        sslog_node_leave(node);
+        sslog_free_node(node);
+        return -1;
+    }
+
+    //__android_log_print(ANDROID_LOG_INFO, TAG, "KP joins to SS.");
+    return handle;
+}
+
+/*
+ * Node leaves the smartspace and it is freed, the library and other nodes are not changed.
+ * Tasks and subscriptions of the node keep it until they are finished or unsubscribed
+ */
+int kp_disconnect_smartspace(JNIEnv* env, jlong nodeDescriptor){
+    return kp_handles_remove(env, nodeDescriptor, KP_HANDLE_NODE);
 }
 
 static int uri_index = 0;
@@ -65,12 +172,75 @@ char* generate_uri(char *uri){
     uri_index++;
     int result;
     char *newstring;
-    char *c;
     result = asprintf(&newstring, "%s%d", uri, uri_index);
     if (result == -1) newstring = NULL;
     return newstring;
 }
 
+/*
+ * Adds records of the questionnaire with all questions to the data, the task (can be NULL)
+ * gets the data after each question and clears it, -1 is returned if there is
+ * no questionnaire or the task is cancelled
+ */
+int kp_build_questionnaire(JNIEnv* env, sslog_node_t *node, kp_data_t *data, kp_task_t *task){
+    char* questionnaire_uri;
+    sslog_individual_t *questionnaire_ss =  kp_get_questionnaire(node, &questionnaire_uri);
+    if (questionnaire_ss == NULL){
+        return -1;
+    }
+
+    bool is_cached = (kp_prefetch_questionnaire(node, questionnaire_ss) == 0);
+    return kp_add_questionnaire(env, node, questionnaire_ss, data, task, is_cached);
+}
+
+/*
+ * Adds records of the questionnaire that is loaded to the local store
+ * (see kp_prefetch_questionnaire). Answers are kept in the store if it is
+ * synchronized with the smart space by changes (is_cached), they are removed otherwise.
+ * Store is read in one section, so subscriptions don't block it and
+ * URIs of the next questions are not freed by their changes or by eviction.
+ * Evicted individuals are got again with the node
+ */
+int kp_add_questionnaire(JNIEnv* env, sslog_node_t *node, sslog_individual_t *questionnaire_ss, kp_data_t *data, kp_task_t *task, bool is_cached){
+    const char *questionnaire_uri = sslog_entity_get_uri(questionnaire_ss);
+
+    /**************/
+    kp_data_add(data, KP_RECORD_QUESTIONNAIRE, -1, questionnaire_uri, NULL, NULL);
+
+    char* question_uri;
+    char* next_question_uri = NULL;
+    /*
+     * Answers and subanswers of all questions are removed from the local store in one pass,
+     * links to them are compared by the next synchronization, so cached answers are kept
+     */
+    list_t *answers = list_new();
+    int result = 0;
+
+    sslog_session_begin_read(NULL);
+    sslog_node_set_default(node);
+    kp_get_first_question(data, node, questionnaire_ss, &next_question_uri, answers);
+    question_uri = next_question_uri;
+    kp_task_notify_data(env, task, data);
+
+    while (next_question_uri != NULL) {
+        if (kp_task_is_cancelled(task) == true){
+            result = -1;
+            break;
+        }
+        kp_get_next_question(data, node, questionnaire_ss, question_uri, &next_question_uri, answers);
+        kp_task_notify_data(env, task, data);
+        question_uri = next_question_uri;
+    }
+    /**************/
+    if (is_cached == false){
+        sslog_remove_individuals(answers);
+    }
+    sslog_node_set_default(NULL);
+    sslog_session_end_read(NULL);
+    list_free_with_nodes(answers, NULL);
+    return result;
+}
+
 sslog_individual_t* kp_get_questionnaire(sslog_node_t *node, char **questionnaire_uri){
     list_t* questionnaires;
 
@@ -86,19 +256,288 @@ sslog_individual_t* kp_get_questionnaire(sslog_node_t *node, char **questionnair
     char* uri;
     list_for_each(pos, &questionnaires->links)
     {
-        list_t *node = list_entry(pos, list_t, links);
-        questionnaire_ss = (sslog_individual_t *) node->data;
+        list_t *list_node = list_entry(pos, list_t, links);
+        questionnaire_ss = (sslog_individual_t *) list_node->data;
         sslog_triple_t *questionnaire_uri_from_triple = sslog_individual_to_triple (questionnaire_ss);
         uri  = questionnaire_uri_from_triple->subject;
         *questionnaire_uri = uri;
         return questionnaire_ss;
     }
+    return NULL;
+}
+
+/*
+ * Adds records of all questionnaires (or of the first limit questionnaires if limit > 0).
+ * Questionnaires that are not in the local store are constructed at the same time
+ * by several connections, triples are added to the store with one call per questionnaire.
+ * Stored questionnaires are synchronized by the calling thread meanwhile.
+ */
+int kp_build_questionnaires(JNIEnv* env, sslog_node_t *node, kp_data_t *data, int limit){
+    list_t *questionnaires = sslog_node_get_individuals_by_class(node, CLASS_QUESTIONNAIRE);
+    if (list_is_null_or_empty(questionnaires) == true){
+        __android_log_print(ANDROID_LOG_INFO, TAG,"There are no such individuals.");
+        list_free_with_nodes(questionnaires, NULL);
+        return -1;
+    }
+
+    int count = list_count(questionnaires);
+    if (limit > 0 && limit < count){
+        count = limit;
+    }
+
+    sslog_individual_t **individuals = (sslog_individual_t **) calloc(count, sizeof(sslog_individual_t *));
+    int *fetched = (int *) calloc(count, sizeof(int));
+    /* Results of kp_prefetch_questionnaire, constructed questionnaires are cached (0) */
+    int *prefetched = (int *) calloc(count, sizeof(int));
+    kp_fetch_t fetch = {node, (char **) calloc(count, sizeof(char *)), (list_t **) calloc(count, sizeof(list_t *)), 0, 0};
+    if (individuals == NULL || fetched == NULL || prefetched == NULL || fetch.queries == NULL || fetch.triples == NULL){
+        free(individuals);
+        free(fetched);
+        free(prefetched);
+        free(fetch.queries);
+        free(fetch.triples);
+        list_free_with_nodes(questionnaires, NULL);
+        return -1;
+    }
+
+    int index = 0;
+    list_head_t *pos = NULL;
+    list_for_each(pos, &questionnaires->links){
+        if (index == count){
+            break;
+        }
+        sslog_individual_t *questionnaire_ss = (sslog_individual_t *) list_entry(pos, list_t, links)->data;
+        individuals[index] = questionnaire_ss;
+
+        /* Stored questionnaires are synchronized, others are constructed by workers */
+        if (sslog_get_property(questionnaire_ss, PROPERTY_FIRSTQUESTION) == NULL
+            && asprintf(&fetch.queries[fetch.count], KP_QUESTIONNAIRE_CONSTRUCT, sslog_entity_get_uri(questionnaire_ss)) != -1){
+            fetched[index] = fetch.count;
+            ++fetch.count;
+        } else {
+            fetched[index] = -1;
+        }
+        ++index;
+    }
+
+    /* The calling thread is a worker too, its node constructs questionnaires after synchronization */
+    pthread_t workers[KP_FETCH_WORKERS_MAX];
+    int workers_count = 0;
+    while (workers_count < fetch.count - 1 && workers_count < KP_FETCH_WORKERS_MAX - 1){
+        if (pthread_create(&workers[workers_count], NULL, kp_fetch_run, &fetch) != 0){
+            break;
+        }
+        ++workers_count;
+    }
+
+    for (int i = 0; i < count; ++i){
+        if (fetched[i] == -1){
+            prefetched[i] = kp_prefetch_questionnaire(node, individuals[i]);
+        }
+    }
+    kp_fetch_questionnaires(&fetch, node);
+
+    for (int i = 0; i < workers_count; ++i){
+        pthread_join(workers[i], NULL);
+    }
+
+    int result = 0;
+    for (int i = 0; i < count; ++i){
+        if (fetched[i] != -1){
+            list_t *triples = fetch.triples[fetched[i]];
+            if (list_is_null_or_empty(triples) == false){
+                sslog_insert_triples(triples);
+            } else {
+                /* The smart space can't construct the questionnaire */
+                prefetched[i] = kp_prefetch_questionnaire(node, individuals[i]);
+            }
+        }
+
+        if (kp_add_questionnaire(env, node, individuals[i], data, NULL, prefetched[i] == 0) != 0){
+            result = -1;
+        }
+    }
+
+    for (int i = 0; i < fetch.count; ++i){
+        free(fetch.queries[i]);
+        if (fetch.triples[i] != NULL){
+            sslog_free_triples(fetch.triples[i]);
+        }
+    }
+    free(fetch.queries);
+    free(fetch.triples);
+    free(fetched);
+    free(prefetched);
+    free(individuals);
+    /* Individuals are got from the list, so it is kept until records are added */
+    list_free_with_nodes(questionnaires, NULL);
+    return result;
+}
+
+/* Takes questionnaires until all of them are taken */
+static void kp_fetch_questionnaires(kp_fetch_t *fetch, sslog_node_t *node){
+    int i;
+    while ((i = __sync_fetch_and_add(&fetch->next, 1)) < fetch->count){
+        fetch->triples[i] = sslog_node_sparql_construct_triples(node, fetch->queries[i]);
+    }
+}
+
+/* Worker with its own connection, questionnaires are left to other workers if it can't join */
+static void* kp_fetch_run(void *data){
+    kp_fetch_t *fetch = (kp_fetch_t *) data;
+
+    sslog_node_t *node = kp_new_worker_node(fetch->node);
+    if (node == NULL){
+        return NULL;
+    }
+
+    kp_fetch_questionnaires(fetch, node);
+
+    sslog_node_leave(node);
+    sslog_free_node(node);
+    return NULL;
+}
+
+/*
+ * Gets questions, answers, items and subanswers of the questionnaire
+ * with one SPARQL CONSTRUCT request (or with one request per level if the
+ * smart space can't construct them), then they are got from the local store.
+ * Stored questionnaire is synchronized by changes only.
+ * Returns 0 if the local store is kept for the next synchronization, 1 if the smart space
+ * can't synchronize the stored questionnaire (it is loaded again) or -1 on errors
+ */
+int kp_prefetch_questionnaire(sslog_node_t *node, sslog_individual_t *questionnaire_ss){
+    bool is_stored = (sslog_get_property(questionnaire_ss, PROPERTY_FIRSTQUESTION) != NULL);
+
+    if (is_stored == true && kp_sync_questionnaire(node, questionnaire_ss) == 0){
+        return 0;
+    }
+
+    if (kp_construct_questionnaire(node, questionnaire_ss) == 0){
+        return (is_stored == true) ? 1 : 0;
+    }
+
+    list_t *properties = list_new();
+    list_add_data(properties, PROPERTY_FIRSTQUESTION);
+    list_add_data(properties, PROPERTY_NEXTQUESTION);
+    list_add_data(properties, PROPERTY_HASANSWER);
+    list_add_data(properties, PROPERTY_SINGLEITEM);
+    list_add_data(properties, PROPERTY_MULTIPLEITEM);
+    list_add_data(properties, PROPERTY_DICHOTOMOUSITEM);
+    list_add_data(properties, PROPERTY_RANGINGITEM);
+    list_add_data(properties, PROPERTY_LEFTBIPOLAR);
+    list_add_data(properties, PROPERTY_RIGHTBIPOLAR);
+    list_add_data(properties, PROPERTY_SUBANSWER);
+
+    int result = sslog_node_prefetch(node, questionnaire_ss, properties, KP_PREFETCH_MAX_DEPTH);
+    list_free_with_nodes(properties, NULL);
+
+    if (result != SSLOG_ERROR_NO){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Prefetch error: %s", sslog_error_get_last_text());
+        return -1;
+    }
+    return (is_stored == true) ? 1 : 0;
+}
+
+/*
+ * Constructed triples are stored locally by the library,
+ * returns -1 if the query fails or there are no triples
+ */
+int kp_construct_questionnaire(sslog_node_t *node, sslog_individual_t *questionnaire_ss){
+    char *query = NULL;
+    if (asprintf(&query, KP_QUESTIONNAIRE_CONSTRUCT, sslog_entity_get_uri(questionnaire_ss)) == -1){
+        return -1;
+    }
+
+    list_t *triples = sslog_node_sparql_construct(node, query);
+    free(query);
+
+    if (list_is_null_or_empty(triples) == true){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Questionnaire is not constructed: %s", sslog_error_get_last_text());
+        list_free_with_nodes(triples, NULL);
+        return -1;
+    }
+
+    __android_log_print(ANDROID_LOG_INFO, TAG, "Questionnaire is constructed: %d triples", list_count(triples));
+    list_free_with_nodes(triples, NULL);
+    return 0;
+}
+
+/*
+ * Individuals with changed links or versions are got from the smart space again,
+ * returns -1 if the smart space can't compare them or some of its individuals
+ * have no versions (full loading is needed)
+ */
+int kp_sync_questionnaire(sslog_node_t *node, sslog_individual_t *questionnaire_ss){
+    char *query = NULL;
+    if (asprintf(&query, KP_QUESTIONNAIRE_FINGERPRINT, sslog_entity_get_uri(questionnaire_ss)) == -1){
+        return -1;
+    }
+
+    list_t *properties = list_new();
+    list_add_data(properties, PROPERTY_FIRSTQUESTION);
+    list_add_data(properties, PROPERTY_NEXTQUESTION);
+    list_add_data(properties, PROPERTY_HASANSWER);
+    list_add_data(properties, PROPERTY_SINGLEITEM);
+    list_add_data(properties, PROPERTY_MULTIPLEITEM);
+    list_add_data(properties, PROPERTY_DICHOTOMOUSITEM);
+    list_add_data(properties, PROPERTY_RANGINGITEM);
+    list_add_data(properties, PROPERTY_LEFTBIPOLAR);
+    list_add_data(properties, PROPERTY_RIGHTBIPOLAR);
+    list_add_data(properties, PROPERTY_SUBANSWER);
+    sslog_property_t *version = sslog_new_property(KP_VERSION_URI, SSLOG_PROPERTY_TYPE_DATA);
+    list_add_data(properties, version);
+
+    /* Smart space without versions can't be synchronized, the questionnaire is constructed again */
+    int changed_count = 0;
+    int result = sslog_node_sync(node, query, properties, version, &changed_count);
+
+    free(query);
+    list_free_with_nodes(properties, NULL);
+
+    if (result != SSLOG_ERROR_NO){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Questionnaire is not synchronized: %s", sslog_error_get_last_text());
+        return -1;
+    }
+
+    __android_log_print(ANDROID_LOG_INFO, TAG, "Questionnaire is synchronized: %d changed individuals", changed_count);
+    return 0;
+}
+
+/*
+ * Local data is used if the individual was prefetched,
+ * the smart space is queried otherwise
+ */
+sslog_individual_t* kp_get_individual(sslog_node_t *node_ss, char *uri){
+    sslog_individual_t *individual = sslog_get_individual(uri);
+    if (individual == NULL){
+        individual = sslog_node_get_individual_by_uri(node_ss, uri);
+        sslog_node_populate(node_ss, individual);
+    }
+    return individual;
+}
+
+sslog_individual_t* kp_get_linked_individual(sslog_node_t *node_ss, sslog_individual_t *individual, sslog_property_t *property){
+    sslog_individual_t *linked = (sslog_individual_t *) sslog_get_property(individual, property);
+    if (linked == NULL){
+        linked = (sslog_individual_t *) sslog_node_get_property(node_ss, individual, property);
+        sslog_node_populate(node_ss, linked);
+    }
+    return linked;
+}
 
+list_t* kp_query_triple(sslog_node_t *node_ss, sslog_triple_t *req_triple){
+    list_t *triples = sslog_query_triple(req_triple);
+    if (list_is_null_or_empty(triples) == true){
+        list_free_with_nodes(triples, NULL);
+        triples = sslog_node_query_triple(node_ss, req_triple);
+    }
+    return triples;
 }
 
-jobject kp_get_first_question(JNIEnv* env, jobject *questionnaire, sslog_node_t *node_ss, sslog_individual_t *questionnaire_ss, char** next_question_uri){
+int kp_get_first_question(kp_data_t *data, sslog_node_t *node_ss, sslog_individual_t *questionnaire_ss, char** next_question_uri, list_t *answers){
 
-    sslog_individual_t *first_question = (sslog_individual_t *) sslog_node_get_property(node_ss, questionnaire_ss, PROPERTY_FIRSTQUESTION);
+    sslog_individual_t *first_question = kp_get_linked_individual(node_ss, questionnaire_ss, PROPERTY_FIRSTQUESTION);
     if(first_question == NULL){
         return -1;
     }
@@ -107,8 +546,6 @@ jobject kp_get_first_question(JNIEnv* env, jobject *questionnaire, sslog_node_t
     sslog_triple_t *question_uri_from_triple = sslog_individual_to_triple (first_question);
     question_uri  =  question_uri_from_triple->subject;
 
-    sslog_node_populate(node_ss, first_question);
-
     char *description_ss;
     description_ss = (char *) sslog_get_property(first_question, PROPERTY_DESCRIPTION);
 
@@ -118,19 +555,16 @@ jobject kp_get_first_question(JNIEnv* env, jobject *questionnaire, sslog_node_t
         *next_question_uri  =  next_question_uri_from_triple->subject;
     }
     /**************/
-    jobject *question;
-    question = (*env)->NewObject(env, class_question, question_constructor, (*env)->NewStringUTF(env, question_uri), (*env)->NewStringUTF(env, description_ss));
-    kp_get_answer(env, question, node_ss, first_question);
+    int question = kp_data_add(data, KP_RECORD_QUESTION, -1, question_uri, description_ss, NULL);
+    kp_get_answer(data, question, node_ss, first_question, answers);
     /**************/
 
     return question;
 }
 
-jobject kp_get_next_question(JNIEnv* env, jobject *questionnaire, sslog_node_t *node_ss, sslog_individual_t *questionnaire_ss, char* question_uri, char** next_question_uri){
-
-    sslog_individual_t *question_ss = sslog_node_get_individual_by_uri(node_ss,  question_uri);
+int kp_get_next_question(kp_data_t *data, sslog_node_t *node_ss, sslog_individual_t *questionnaire_ss, char* question_uri, char** next_question_uri, list_t *answers){
 
-    sslog_node_populate(node_ss, question_ss);
+    sslog_individual_t *question_ss = kp_get_individual(node_ss, question_uri);
 
     char *description_ss;
     description_ss = (char *) sslog_get_property(question_ss, PROPERTY_DESCRIPTION);
@@ -143,49 +577,45 @@ jobject kp_get_next_question(JNIEnv* env, jobject *questionnaire, sslog_node_t *
     else *next_question_uri  = NULL;
 
     /**************/
-    jobject *question;
-    question = (*env)->NewObject(env, class_question, question_constructor, (*env)->NewStringUTF(env, question_uri), (*env)->NewStringUTF(env, description_ss));
-    kp_get_answer(env, question, node_ss, question_ss);
+    int question = kp_data_add(data, KP_RECORD_QUESTION, -1, question_uri, description_ss, NULL);
+    kp_get_answer(data, question, node_ss, question_ss, answers);
     /**************/
 
     return question;
 }
 
-int kp_get_answer(JNIEnv* env, jobject *question, sslog_node_t *node_ss, sslog_individual_t* question_ss){
+/*
+ * Answer is added to the answers list, they are removed from the local store
+ * when the questionnaire is added
+ */
+int kp_get_answer(kp_data_t *data, int question, sslog_node_t *node_ss, sslog_individual_t* question_ss, list_t *answers){
 
     sslog_individual_t *answer_ss;
-    answer_ss = (sslog_individual_t *)  sslog_node_get_property (node_ss, question_ss, PROPERTY_HASANSWER);
-
-    sslog_node_populate(node_ss, answer_ss);
-
-        char *subclass_name_uri = NULL;
-        char *subclass_name = NULL;
-    char* answer_uri = sslog_entity_get_uri(answer_ss);
-        get_subclasses(node_ss, answer_uri, &subclass_name_uri);
-
-        __android_log_print(ANDROID_LOG_INFO, TAG, "kp_get_answer");
-        /**************/
-        jobject *answer;
-        answer = (*env)->NewObject(env, class_answer, answer_constructor, (*env)->NewStringUTF(env, answer_uri), (*env)->NewStringUTF(env, subclass_name_uri));
-        kp_get_answer_items_by_type(env, answer, node_ss, answer_ss, subclass_name_uri);
-        (*env)->CallVoidMethod(env, question, add_answer, answer);
-        /**************/
-
-        subclass_name_uri = NULL;
-        answer = NULL;
-        sslog_remove_individual(answer_ss);
+    answer_ss = kp_get_linked_individual(node_ss, question_ss, PROPERTY_HASANSWER);
+
+    char *subclass_name_uri = NULL;
+    const char* answer_uri = sslog_entity_get_uri(answer_ss);
+    get_subclasses(node_ss, answer_uri, &subclass_name_uri);
+
+    __android_log_print(ANDROID_LOG_INFO, TAG, "kp_get_answer");
+    /**************/
+    int answer = kp_data_add(data, KP_RECORD_ANSWER, question, answer_uri, subclass_name_uri, NULL);
+    kp_get_answer_items_by_type(data, answer, node_ss, answer_ss, subclass_name_uri, answers);
+    /**************/
+
+    list_add_data(answers, answer_ss);
     return 0;
 }
 
-int kp_get_subanswer(JNIEnv* env, jobject *answer_item, sslog_node_t *node_ss, sslog_individual_t* item){
-    char* uri = sslog_entity_get_uri(item);
+int kp_get_subanswer(kp_data_t *data, int answer_item, sslog_node_t *node_ss, sslog_individual_t* item, list_t *answers){
+    const char* uri = sslog_entity_get_uri(item);
     sslog_triple_t *req_triple = sslog_new_triple_detached(
             uri,
             "http://oss.fruct.org/smartcare#subAnswer",
             SS_RDF_SIB_ANY,
             SS_RDF_TYPE_URI, SS_RDF_TYPE_URI);
 
-    list_t *uris = sslog_node_query_triple(node_ss, req_triple);
+    list_t *uris = kp_query_triple(node_ss, req_triple);
     sslog_free_triple(req_triple);
 
     list_head_t *iterator = NULL;
@@ -196,25 +626,19 @@ int kp_get_subanswer(JNIEnv* env, jobject *answer_item, sslog_node_t *node_ss, s
         char *_answer_class_uri = (char *) ((sslog_triple_t *) list_node->data)->object;
         if (_answer_class_uri != NULL) {
             answer_class_uri = _answer_class_uri;
-            sslog_individual_t *answer_ss = sslog_node_get_individual_by_uri(node_ss,
-                                                                             answer_class_uri);
-            sslog_node_populate(node_ss, answer_ss);
+            sslog_individual_t *answer_ss = kp_get_individual(node_ss, answer_class_uri);
 
             char *subclass_name_uri = NULL;
-            char *answer_uri = sslog_entity_get_uri(answer_ss);
+            const char *answer_uri = sslog_entity_get_uri(answer_ss);
             get_subclasses(node_ss, answer_uri, &subclass_name_uri);
 
             __android_log_print(ANDROID_LOG_INFO, TAG, "kp_get_subanswer");
             /**************/
-            jobject *answer;
-            answer = (*env)->NewObject(env, class_answer, answer_constructor,
-                                       (*env)->NewStringUTF(env, answer_uri),
-                                       (*env)->NewStringUTF(env, subclass_name_uri));
-            kp_get_answer_items_by_type(env, answer, node_ss, answer_ss, subclass_name_uri);
-            (*env)->CallVoidMethod(env, answer_item, add_subanswer, answer);
+            int answer = kp_data_add(data, KP_RECORD_ANSWER, answer_item, answer_uri, subclass_name_uri, NULL);
+            kp_get_answer_items_by_type(data, answer, node_ss, answer_ss, subclass_name_uri, answers);
             /**************/
 
-            sslog_remove_individual(answer_ss);
+            list_add_data(answers, answer_ss);
             subclass_name_uri = NULL;
         }
     }
@@ -222,18 +646,18 @@ int kp_get_subanswer(JNIEnv* env, jobject *answer_item, sslog_node_t *node_ss, s
     return 0;
 }
 
-int get_subclasses(sslog_node_t *node, char *uri, char** subclass){
+int get_subclasses(sslog_node_t *node, const char *uri, char** subclass){
     sslog_triple_t *req_triple = sslog_new_triple_detached(
             uri,
             RDF_TYPE,
             SS_RDF_SIB_ANY,
             SS_RDF_TYPE_URI, SS_RDF_TYPE_URI);
 
-    list_t *uris = sslog_node_query_triple(node, req_triple);
+    list_t *uris = kp_query_triple(node, req_triple);
     sslog_free_triple(req_triple);
 
     list_head_t *iterator = NULL;
-    char *answer_class_uri;
+    char *answer_class_uri = NULL;
     list_for_each(iterator, &uris->links){
         list_t *list_node = list_entry(iterator, list_t, links);
         char *_answer_class_uri = (char *) ((sslog_triple_t*) list_node->data)->object;
@@ -246,66 +670,35 @@ int get_subclasses(sslog_node_t *node, char *uri, char** subclass){
     }
     *subclass = answer_class_uri;
     list_free_with_nodes(uris, NULL);
+    return 0;
 }
 
 int check_answer_type(char *answer_class){
-    if (strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_TEXT)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_SINGLECHOISE)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_MULTIPLECHOISE)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_DICHOTOMOUS)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_BIPOLARQUESTION)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_GUTTMANSCALE)->subject) == 0
-        || strcmp(answer_class,(char *) sslog_class_to_triple (CLASS_LIKERTSCALE)->subject) == 0
-            ){
-        return 0;
-    }else
-        return -1;
+    return (kp_find_answer_type(answer_class) != NULL) ? 0 : -1;
 }
 
-int kp_get_answer_items_by_type(JNIEnv* env, jobject *answer, sslog_node_t *node_ss, sslog_individual_t *answer_ss, char*  subclass_name){
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_SINGLECHOISE)->subject) == 0){
-          kp_get_answer_items(env, answer ,node_ss, answer_ss, "singleItem");
-        return 0;
-    }
-
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_MULTIPLECHOISE)->subject) == 0){
-         kp_get_answer_items(env, answer,node_ss, answer_ss, "multipleItem");
-        return 0;
-    }
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_DICHOTOMOUS)->subject) == 0){
-        kp_get_answer_items(env, answer,node_ss, answer_ss, "dichotomousItem");
-        return 0;
-    }
-
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_GUTTMANSCALE)->subject) == 0){
-        kp_get_answer_items(env, answer,node_ss, answer_ss, "rangingItem");
-        return 0;
-    }
-
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_LIKERTSCALE)->subject) == 0){
-        kp_get_answer_items(env, answer,node_ss, answer_ss, "rangingItem");
+/*
+ * Items are got with properties of the answer type (one lookup in the table)
+ */
+int kp_get_answer_items_by_type(kp_data_t *data, int answer, sslog_node_t *node_ss, sslog_individual_t *answer_ss, char*  subclass_name, list_t *answers){
+    const kp_answer_type_t *answer_type = kp_find_answer_type(subclass_name);
+    if (answer_type == NULL){
         return 0;
     }
 
-    if (strcmp(subclass_name,(char *) sslog_class_to_triple (CLASS_BIPOLARQUESTION)->subject) == 0){
-        kp_get_answer_items(env, answer,node_ss, answer_ss, "leftBipolar");
-        kp_get_answer_items(env, answer,node_ss, answer_ss, "rightBipolar");
-        return 0;
+    for (int i = 0; i < answer_type->items_count; ++i){
+        kp_get_answer_items(data, answer, node_ss, answer_ss, answer_type->items[i], answers);
     }
-
     return 0;
 }
 
 
-int kp_get_answer_items(JNIEnv* env, jobject *answer, sslog_node_t *node_ss, sslog_individual_t *answer_ss, char* answer_type){
+int kp_get_answer_items(kp_data_t *data, int answer, sslog_node_t *node_ss, sslog_individual_t *answer_ss, sslog_property_t *item_property, list_t *answers){
     //__android_log_print(ANDROID_LOG_INFO, TAG, "kp_get_answer_items");
     sslog_triple_t *answer_uri_from_triple = sslog_individual_to_triple (answer_ss);
     char* answer_uri = answer_uri_from_triple->subject;
 
-    char* rdf_property = NULL;
-    char* rdf_ontology = "http://oss.fruct.org/smartcare#";
-    int result = asprintf(&rdf_property, "%s%s", rdf_ontology, answer_type);
-    if (result == -1) rdf_property = NULL;
+    const char* rdf_property = sslog_entity_get_uri(item_property);
 
     sslog_triple_t *req_triple = sslog_new_triple_detached(
             answer_uri,
@@ -313,25 +706,46 @@ int kp_get_answer_items(JNIEnv* env, jobject *answer, sslog_node_t *node_ss, ssl
             SS_RDF_SIB_ANY,
             SS_RDF_TYPE_URI, SS_RDF_TYPE_URI);
 
-    list_t *uris = sslog_node_query_triple(node_ss, req_triple);
+    list_t *uris = kp_query_triple(node_ss, req_triple);
     sslog_free_triple(req_triple);
+    if (uris == NULL){
+        return -1;
+    }
 
     list_head_t *iterator = NULL;
-    char *item_uri;
+    list_t *items = list_new();
+    list_t *missing_items = list_new();
     list_for_each(iterator, &uris->links){
         list_t *list_node = list_entry(iterator, list_t, links);
-        char *_item_uri = (char *) ((sslog_triple_t*) list_node->data)->object;
-        if(_item_uri != NULL){
-            item_uri = _item_uri;
+        char *item_uri = (char *) ((sslog_triple_t*) list_node->data)->object;
+        if (item_uri == NULL){
+            continue;
+        }
+        /* Items that can't be got from the smart space are skipped */
+        sslog_individual_t *item = sslog_get_individual(item_uri);
+        if (item == NULL){
+            item = sslog_node_get_individual_by_uri(node_ss,  item_uri);
+            if (item == NULL){
+                continue;
+            }
+            list_add_data(missing_items, item);
         }
-        sslog_individual_t *item = sslog_node_get_individual_by_uri(node_ss,  item_uri);
-        sslog_node_populate(node_ss, item);
-        add_answer_item(env, answer, node_ss, item,  answer_type);
+        list_add_data(items, item);
+    }
+    /* Properties of all items that are not prefetched are got with one request */
+    if (list_is_empty(missing_items) == false)
+        sslog_node_populate_many(node_ss, missing_items);
+    list_free_with_nodes(missing_items, NULL);
+    list_for_each(iterator, &items->links){
+        list_t *list_node = list_entry(iterator, list_t, links);
+        add_answer_item(data, answer, node_ss, (sslog_individual_t *) list_node->data,  item_property, answers);
     }
+    list_free_with_nodes(items, NULL);
     list_free_with_nodes(uris, NULL);
+    return 0;
 }
 
-int add_answer_item(JNIEnv* env, jobject *answer, sslog_node_t *node_ss, sslog_individual_t *item, char* type){
+int add_answer_item(kp_data_t *data, int answer, sslog_node_t *node_ss, sslog_individual_t *item, sslog_property_t *item_property, list_t *answers){
 
     //__android_log_print(ANDROID_LOG_INFO, TAG, "add_answer_item");
     sslog_triple_t *answer_uri_from_triple = sslog_individual_to_triple (item);
@@ -341,17 +755,11 @@ int add_answer_item(JNIEnv* env, jobject *answer, sslog_node_t *node_ss, sslog_i
     sslog_individual_t *subitem = ( sslog_individual_t *) sslog_get_property(item, PROPERTY_SUBANSWER);
 
     /**************/
-    jobject *answer_item;
-    answer_item = (*env)->NewObject(env, class_answer_item,  item_constructor,
-        (*env)->NewStringUTF(env, answer_item_uri),
-        (*env)->NewStringUTF(env, item_score),
-        (*env)->NewStringUTF(env, item_text));
-
-    (*env)->CallVoidMethod(env, answer, add_answer_item_i, answer_item);
+    int answer_item = kp_data_add(data, KP_RECORD_ITEM, answer, answer_item_uri, item_score, item_text);
     /**************/
      //subanswer
     if (subitem != NULL)
-        kp_get_subanswer(env, answer_item, node_ss, item);
+        kp_get_subanswer(data, answer_item, node_ss, item, answers);
     return 0;
 }
 
@@ -11,24 +11,35 @@ extern "C" {
 #endif //SMARTCARE_VOLUNTEER_AGENT_H
 #include "ontology/smartcare.h"
 #include <jni.h>
+#include "tasks.h"
+#include "marshal.h"
 
 char* generate_uri(char *);
 
-jobject kp_get_next_question(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t *, char* , char** );
-jobject kp_get_first_question(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t *, char** );
+int kp_get_next_question(kp_data_t *, sslog_node_t *, sslog_individual_t *, char* , char**, list_t * );
+int kp_get_first_question(kp_data_t *, sslog_node_t *, sslog_individual_t *, char**, list_t * );
 
+int kp_build_questionnaire(JNIEnv*, sslog_node_t *, kp_data_t *, kp_task_t *);
+int kp_add_questionnaire(JNIEnv*, sslog_node_t *, sslog_individual_t *, kp_data_t *, kp_task_t *, bool);
+int kp_build_questionnaires(JNIEnv*, sslog_node_t *, kp_data_t *, int);
 sslog_individual_t * kp_get_questionnaire(sslog_node_t *node_ss, char**);
-
-int kp_get_answer(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t*);
-int kp_get_subanswer(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t* );
-int get_subclasses(sslog_node_t *, char *, char** );
+int kp_prefetch_questionnaire(sslog_node_t *, sslog_individual_t *);
+int kp_construct_questionnaire(sslog_node_t *, sslog_individual_t *);
+int kp_sync_questionnaire(sslog_node_t *, sslog_individual_t *);
+sslog_individual_t* kp_get_individual(sslog_node_t *, char *);
+sslog_individual_t* kp_get_linked_individual(sslog_node_t *, sslog_individual_t *, sslog_property_t *);
+list_t* kp_query_triple(sslog_node_t *, sslog_triple_t *);
+
+int kp_get_answer(kp_data_t *, int, sslog_node_t *, sslog_individual_t*, list_t * );
+int kp_get_subanswer(kp_data_t *, int, sslog_node_t *, sslog_individual_t*, list_t * );
+int get_subclasses(sslog_node_t *, const char *, char** );
 int check_answer_type(char *);
-int kp_get_answer_items_by_type(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t *, char*  );
-int kp_get_answer_items(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t *, char* );
-int add_answer_item(JNIEnv* , jobject *, sslog_node_t *, sslog_individual_t *, char* );
+int kp_get_answer_items_by_type(kp_data_t *, int, sslog_node_t *, sslog_individual_t *, char*, list_t * );
+int kp_get_answer_items(kp_data_t *, int, sslog_node_t *, sslog_individual_t *, sslog_property_t *, list_t * );
+int add_answer_item(kp_data_t *, int, sslog_node_t *, sslog_individual_t *, sslog_property_t *, list_t * );
 
-long kp_connect_smartspace(char*, char*, int);
-int kp_disconnect_smartpace(long);
+jlong kp_connect_smartspace(const char*, const char*, int);
+int kp_disconnect_smartspace(JNIEnv*, jlong);
 
 #ifdef	__cplusplus
 }
@@ -0,0 +1,85 @@
+//
+// Types of answers with properties of their items.
+//
+#include <stdlib.h>
+#include <string.h>
+
+#include "answer_types.h"
+
+#define KP_ANSWER_TYPES_COUNT 7
+/* Power of two, more than twice of types, so probes are short */
+#define KP_ANSWER_TYPES_SLOTS 16
+
+static kp_answer_type_t answer_types[KP_ANSWER_TYPES_COUNT];
+static kp_answer_type_t *answer_types_table[KP_ANSWER_TYPES_SLOTS];
+
+static unsigned int kp_answer_type_hash(const char *uri);
+static void kp_add_answer_type(int index, sslog_class_t *ont_class, sslog_property_t *first_items, sslog_property_t *second_items);
+
+
+/*
+ * Table is built once after register_ontology, classes and properties
+ * of the ontology are not changed after it
+ */
+void kp_init_answer_types(){
+    memset(answer_types_table, 0, sizeof(answer_types_table));
+
+    kp_add_answer_type(0, CLASS_TEXT, NULL, NULL);
+    kp_add_answer_type(1, CLASS_SINGLECHOISE, PROPERTY_SINGLEITEM, NULL);
+    kp_add_answer_type(2, CLASS_MULTIPLECHOISE, PROPERTY_MULTIPLEITEM, NULL);
+    kp_add_answer_type(3, CLASS_DICHOTOMOUS, PROPERTY_DICHOTOMOUSITEM, NULL);
+    kp_add_answer_type(4, CLASS_GUTTMANSCALE, PROPERTY_RANGINGITEM, NULL);
+    kp_add_answer_type(5, CLASS_LIKERTSCALE, PROPERTY_RANGINGITEM, NULL);
+    kp_add_answer_type(6, CLASS_BIPOLARQUESTION, PROPERTY_LEFTBIPOLAR, PROPERTY_RIGHTBIPOLAR);
+}
+
+/*
+ * Returns the type by URI of the answer class or NULL if the class is not an answer type
+ */
+const kp_answer_type_t* kp_find_answer_type(const char *class_uri){
+    if (class_uri == NULL){
+        return NULL;
+    }
+
+    unsigned int hash = kp_answer_type_hash(class_uri);
+
+    for (unsigned int slot = hash; ; ++slot){
+        kp_answer_type_t *answer_type = answer_types_table[slot & (KP_ANSWER_TYPES_SLOTS - 1)];
+        if (answer_type == NULL){
+            return NULL;
+        }
+        if (answer_type->hash == hash && strcmp(answer_type->class_uri, class_uri) == 0){
+            return answer_type;
+        }
+    }
+}
+
+
+/* FNV-1a */
+static unsigned int kp_answer_type_hash(const char *uri){
+    unsigned int hash = 2166136261u;
+    for (const unsigned char *c = (const unsigned char *) uri; *c != '\0'; ++c){
+        hash = (hash ^ *c) * 16777619u;
+    }
+    return hash;
+}
+
+static void kp_add_answer_type(int index, sslog_class_t *ont_class, sslog_property_t *first_items, sslog_property_t *second_items){
+    kp_answer_type_t *answer_type = &answer_types[index];
+
+    answer_type->class_uri = sslog_entity_get_uri(ont_class);
+    answer_type->hash = kp_answer_type_hash(answer_type->class_uri);
+    answer_type->items_count = 0;
+    if (first_items != NULL){
+        answer_type->items[answer_type->items_count++] = first_items;
+    }
+    if (second_items != NULL){
+        answer_type->items[answer_type->items_count++] = second_items;
+    }
+
+    unsigned int slot = answer_type->hash;
+    while (answer_types_table[slot & (KP_ANSWER_TYPES_SLOTS - 1)] != NULL){
+        ++slot;
+    }
+    answer_types_table[slot & (KP_ANSWER_TYPES_SLOTS - 1)] = answer_type;
+}
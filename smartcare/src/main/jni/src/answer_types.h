@@ -0,0 +1,31 @@
+//
+// Types of answers with properties of their items.
+//
+
+#ifndef SMARTCARE_QUESTIONNAIRE_ANSWER_TYPES_H
+#define SMARTCARE_QUESTIONNAIRE_ANSWER_TYPES_H
+
+#include "ontology/smartcare.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+#define KP_ANSWER_TYPE_MAX_ITEMS 2
+
+typedef struct kp_answer_type_s {
+    const char *class_uri;
+    unsigned int hash;
+    /* Properties that link the answer with items (bipolar question has two) */
+    sslog_property_t *items[KP_ANSWER_TYPE_MAX_ITEMS];
+    int items_count;
+} kp_answer_type_t;
+
+void kp_init_answer_types();
+const kp_answer_type_t* kp_find_answer_type(const char*);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif //SMARTCARE_QUESTIONNAIRE_ANSWER_TYPES_H
@@ -0,0 +1,353 @@
+//
+// Publishing of the feedback (answers of the patient) to the smart space.
+//
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+
+#include <android/log.h>
+
+#include <jni.h>
+
+#include "feedback.h"
+
+#define TAG "SS"
+
+#define RDF_TYPE "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"
+#define KP_NS_URI "http://oss.fruct.org/smartcare#"
+
+/* Methods of the Java model (Feedback, Response, ResponseItem, AnswerItem) */
+typedef struct kp_feedback_methods_s {
+    jmethodID feedback_uri;
+    jmethodID feedback_person_uri;
+    jmethodID feedback_questionnaire_uri;
+    jmethodID feedback_responses;
+    jmethodID response_uri;
+    jmethodID response_question_uri;
+    jmethodID response_items;
+    jmethodID item_uri;
+    jmethodID item_text;
+    jmethodID item_file_uri;
+    jmethodID item_linked_items;
+    jmethodID answer_item_uri;
+    jmethodID list_to_array;
+} kp_feedback_methods_t;
+
+static int kp_feedback_init_methods(JNIEnv *env, kp_feedback_methods_t *methods);
+static int kp_feedback_add_response(JNIEnv *env, kp_feedback_methods_t *methods, list_t *triples,
+                                    const char *feedback_uri, int index, jobject response);
+static int kp_feedback_insert(sslog_node_t *node, list_t *triples);
+static jobjectArray kp_feedback_to_array(JNIEnv *env, kp_feedback_methods_t *methods, jobject object, jmethodID list_method);
+static char* kp_feedback_get_string(JNIEnv *env, jobject object, jmethodID method);
+static char* kp_feedback_get_uri(JNIEnv *env, jobject object, jmethodID method, const char *format, ...);
+static void kp_feedback_add_triple(list_t *triples, const char *subject, const char *predicate,
+                                   const char *object, sslog_rdf_type object_type);
+
+
+/*
+ * Flattens the feedback to triples and inserts them with one transaction
+ * (or with a few chunks for large feedbacks). Empty URIs are generated from
+ * the URI of the feedback, so the tree needs no requests to the smart space.
+ * Returns results of responses (0 - inserted, -1 - error) or NULL if the feedback
+ * itself is not inserted.
+ *
+ * Feedback: (person, hasFeedback, feedback), (feedback, anweredTo, questionnaire),
+ * (feedback, hasResponse, response), (response, respondedTo, question),
+ * (response, hasResponseItem, item), (item, linkedWithItem, answer item),
+ * (item, containsText, text), (text, responseText, "..."),
+ * (item, containsFile, file), (file, responseFileUri, "...").
+ */
+jintArray kp_send_feedback(JNIEnv* env, sslog_node_t *node, jobject feedback){
+    kp_feedback_methods_t methods;
+    if (kp_feedback_init_methods(env, &methods) != 0){
+        return NULL;
+    }
+
+    jobjectArray responses = kp_feedback_to_array(env, &methods, feedback, methods.feedback_responses);
+    if (responses == NULL){
+        return NULL;
+    }
+    jsize responses_count = (*env)->GetArrayLength(env, responses);
+
+    jint *results = (jint *) malloc((responses_count + 1) * sizeof(jint));
+    /* URIs of responses and items are derived from it, so it must be unique on all devices */
+    char *generated_uri = sslog_generate_uri(CLASS_FEEDBACK);
+    char *feedback_uri = (generated_uri == NULL) ? NULL
+                         : kp_feedback_get_uri(env, feedback, methods.feedback_uri, "%s", generated_uri);
+    free(generated_uri);
+    if (results == NULL || feedback_uri == NULL){
+        free(results);
+        free(feedback_uri);
+        (*env)->DeleteLocalRef(env, responses);
+        return NULL;
+    }
+
+    list_t *triples = list_new();
+    kp_feedback_add_triple(triples, feedback_uri, RDF_TYPE, sslog_entity_get_uri(CLASS_FEEDBACK), SSLOG_RDF_TYPE_URI);
+
+    char *person_uri = kp_feedback_get_string(env, feedback, methods.feedback_person_uri);
+    if (person_uri != NULL){
+        kp_feedback_add_triple(triples, person_uri, sslog_entity_get_uri(PROPERTY_HASFEEDBACK), feedback_uri, SSLOG_RDF_TYPE_URI);
+        free(person_uri);
+    }
+
+    char *questionnaire_uri = kp_feedback_get_string(env, feedback, methods.feedback_questionnaire_uri);
+    if (questionnaire_uri != NULL){
+        kp_feedback_add_triple(triples, feedback_uri, sslog_entity_get_uri(PROPERTY_ANWEREDTO), questionnaire_uri, SSLOG_RDF_TYPE_URI);
+        free(questionnaire_uri);
+    }
+
+    /* Triples of the feedback itself are in the first chunk, responses are not sent without them */
+    bool is_feedback_inserted = false;
+    bool is_failed = false;
+    int first_in_chunk = 0;
+
+    for (jsize i = 0; i < responses_count; ++i){
+        jobject response = (*env)->GetObjectArrayElement(env, responses, i);
+        list_t *response_triples = list_new();
+
+        results[i] = kp_feedback_add_response(env, &methods, response_triples, feedback_uri, i, response);
+        (*env)->DeleteLocalRef(env, response);
+
+        if (list_count(triples) + list_count(response_triples) > KP_FEEDBACK_CHUNK_TRIPLES && list_count(triples) > 0){
+            int result = kp_feedback_insert(node, triples);
+            for (int j = first_in_chunk; j < i; ++j){
+                results[j] = (results[j] == 0) ? result : -1;
+            }
+            if (is_feedback_inserted == false && result != 0){
+                sslog_free_triples(response_triples);
+                is_failed = true;
+                break;
+            }
+            is_feedback_inserted = true;
+            first_in_chunk = i;
+        }
+
+        list_add_list(response_triples, triples);
+        list_free(response_triples);
+    }
+
+    jintArray java_results = NULL;
+
+    /* Last chunk always contains triples (the feedback or the last response) */
+    if (is_failed == false){
+        int result = kp_feedback_insert(node, triples);
+        for (int j = first_in_chunk; j < responses_count; ++j){
+            results[j] = (results[j] == 0) ? result : -1;
+        }
+
+        if (is_feedback_inserted == true || result == 0){
+            java_results = (*env)->NewIntArray(env, responses_count);
+            if (java_results != NULL){
+                (*env)->SetIntArrayRegion(env, java_results, 0, responses_count, results);
+            }
+        }
+    }
+
+    sslog_free_triples(triples);
+    free(feedback_uri);
+    free(results);
+    (*env)->DeleteLocalRef(env, responses);
+    return java_results;
+}
+
+
+static int kp_feedback_init_methods(JNIEnv *env, kp_feedback_methods_t *methods){
+    jclass feedback_class = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/Feedback");
+    jclass response_class = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/Response");
+    jclass item_class = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/ResponseItem");
+    jclass answer_item_class = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/AnswerItem");
+    jclass list_class = (*env)->FindClass(env, "java/util/LinkedList");
+
+    if (feedback_class == NULL || response_class == NULL || item_class == NULL
+        || answer_item_class == NULL || list_class == NULL){
+        return -1;
+    }
+
+    methods->feedback_uri = (*env)->GetMethodID(env, feedback_class, "getUri", "()Ljava/lang/String;");
+    methods->feedback_person_uri = (*env)->GetMethodID(env, feedback_class, "getPersonUri", "()Ljava/lang/String;");
+    methods->feedback_questionnaire_uri = (*env)->GetMethodID(env, feedback_class, "getQuestionnaireUri", "()Ljava/lang/String;");
+    methods->feedback_responses = (*env)->GetMethodID(env, feedback_class, "getResponses", "()Ljava/util/LinkedList;");
+    methods->response_uri = (*env)->GetMethodID(env, response_class, "getUri", "()Ljava/lang/String;");
+    methods->response_question_uri = (*env)->GetMethodID(env, response_class, "getQuestionUri", "()Ljava/lang/String;");
+    methods->response_items = (*env)->GetMethodID(env, response_class, "getResponseItems", "()Ljava/util/LinkedList;");
+    methods->item_uri = (*env)->GetMethodID(env, item_class, "getUri", "()Ljava/lang/String;");
+    methods->item_text = (*env)->GetMethodID(env, item_class, "getTextItem", "()Ljava/lang/String;");
+    methods->item_file_uri = (*env)->GetMethodID(env, item_class, "getFileUri", "()Ljava/lang/String;");
+    methods->item_linked_items = (*env)->GetMethodID(env, item_class, "getLinkedItems", "()Ljava/util/LinkedList;");
+    methods->answer_item_uri = (*env)->GetMethodID(env, answer_item_class, "getUri", "()Ljava/lang/String;");
+    methods->list_to_array = (*env)->GetMethodID(env, list_class, "toArray", "()[Ljava/lang/Object;");
+
+    (*env)->DeleteLocalRef(env, feedback_class);
+    (*env)->DeleteLocalRef(env, response_class);
+    (*env)->DeleteLocalRef(env, item_class);
+    (*env)->DeleteLocalRef(env, answer_item_class);
+    (*env)->DeleteLocalRef(env, list_class);
+
+    if (methods->feedback_uri == NULL || methods->feedback_person_uri == NULL
+        || methods->feedback_questionnaire_uri == NULL || methods->feedback_responses == NULL
+        || methods->response_uri == NULL || methods->response_question_uri == NULL
+        || methods->response_items == NULL || methods->item_uri == NULL || methods->item_text == NULL
+        || methods->item_file_uri == NULL || methods->item_linked_items == NULL
+        || methods->answer_item_uri == NULL || methods->list_to_array == NULL){
+        return -1;
+    }
+    return 0;
+}
+
+/* Adds triples of the response with its items, returns -1 if the response is incorrect */
+static int kp_feedback_add_response(JNIEnv *env, kp_feedback_methods_t *methods, list_t *triples,
+                                    const char *feedback_uri, int index, jobject response){
+    char *response_uri = kp_feedback_get_uri(env, response, methods->response_uri,
+                                             "%s_response%d", feedback_uri, index);
+    char *question_uri = kp_feedback_get_string(env, response, methods->response_question_uri);
+    jobjectArray items = kp_feedback_to_array(env, methods, response, methods->response_items);
+
+    if (response_uri == NULL || question_uri == NULL || items == NULL){
+        free(response_uri);
+        free(question_uri);
+        if (items != NULL){
+            (*env)->DeleteLocalRef(env, items);
+        }
+        return -1;
+    }
+
+    kp_feedback_add_triple(triples, response_uri, RDF_TYPE, sslog_entity_get_uri(CLASS_RESPONSE), SSLOG_RDF_TYPE_URI);
+    kp_feedback_add_triple(triples, feedback_uri, sslog_entity_get_uri(PROPERTY_HASRESPONSE), response_uri, SSLOG_RDF_TYPE_URI);
+    kp_feedback_add_triple(triples, response_uri, sslog_entity_get_uri(PROPERTY_RESPONDEDTO), question_uri, SSLOG_RDF_TYPE_URI);
+
+    jsize items_count = (*env)->GetArrayLength(env, items);
+    for (jsize i = 0; i < items_count; ++i){
+        jobject item = (*env)->GetObjectArrayElement(env, items, i);
+        char *item_uri = kp_feedback_get_uri(env, item, methods->item_uri, "%s_item%d", response_uri, i);
+        if (item_uri == NULL){
+            (*env)->DeleteLocalRef(env, item);
+            continue;
+        }
+
+        kp_feedback_add_triple(triples, item_uri, RDF_TYPE, sslog_entity_get_uri(CLASS_RESPONSEITEM), SSLOG_RDF_TYPE_URI);
+        kp_feedback_add_triple(triples, response_uri, sslog_entity_get_uri(PROPERTY_HASRESPONSEITEM), item_uri, SSLOG_RDF_TYPE_URI);
+
+        jobjectArray linked_items = kp_feedback_to_array(env, methods, item, methods->item_linked_items);
+        jsize linked_count = (linked_items != NULL) ? (*env)->GetArrayLength(env, linked_items) : 0;
+        for (jsize j = 0; j < linked_count; ++j){
+            jobject answer_item = (*env)->GetObjectArrayElement(env, linked_items, j);
+            char *answer_item_uri = kp_feedback_get_string(env, answer_item, methods->answer_item_uri);
+            if (answer_item_uri != NULL){
+                kp_feedback_add_triple(triples, item_uri, sslog_entity_get_uri(PROPERTY_LINKEDWITHITEM), answer_item_uri, SSLOG_RDF_TYPE_URI);
+                free(answer_item_uri);
+            }
+            (*env)->DeleteLocalRef(env, answer_item);
+        }
+        if (linked_items != NULL){
+            (*env)->DeleteLocalRef(env, linked_items);
+        }
+
+        char *text = kp_feedback_get_string(env, item, methods->item_text);
+        if (text != NULL){
+            char *text_uri = NULL;
+            if (asprintf(&text_uri, "%s_text", item_uri) != -1){
+                kp_feedback_add_triple(triples, text_uri, RDF_TYPE, sslog_entity_get_uri(CLASS_RESPONSETEXT), SSLOG_RDF_TYPE_URI);
+                kp_feedback_add_triple(triples, item_uri, sslog_entity_get_uri(PROPERTY_CONTAINSTEXT), text_uri, SSLOG_RDF_TYPE_URI);
+                kp_feedback_add_triple(triples, text_uri, sslog_entity_get_uri(PROPERTY_RESPONSETEXT), text, SSLOG_RDF_TYPE_LIT);
+                free(text_uri);
+            }
+            free(text);
+        }
+
+        char *file_uri = kp_feedback_get_string(env, item, methods->item_file_uri);
+        if (file_uri != NULL){
+            char *file_individual_uri = NULL;
+            if (asprintf(&file_individual_uri, "%s_file", item_uri) != -1){
+                kp_feedback_add_triple(triples, file_individual_uri, RDF_TYPE, sslog_entity_get_uri(CLASS_RESPONSEFILE), SSLOG_RDF_TYPE_URI);
+                kp_feedback_add_triple(triples, item_uri, sslog_entity_get_uri(PROPERTY_CONTAINSFILE), file_individual_uri, SSLOG_RDF_TYPE_URI);
+                kp_feedback_add_triple(triples, file_individual_uri, sslog_entity_get_uri(PROPERTY_RESPONSEFILEURI), file_uri, SSLOG_RDF_TYPE_LIT);
+                free(file_individual_uri);
+            }
+            free(file_uri);
+        }
+
+        free(item_uri);
+        (*env)->DeleteLocalRef(env, item);
+    }
+
+    free(response_uri);
+    free(question_uri);
+    (*env)->DeleteLocalRef(env, items);
+    return 0;
+}
+
+/* Inserts the chunk with one transaction and clears it */
+static int kp_feedback_insert(sslog_node_t *node, list_t *triples){
+    int result = sslog_node_insert_triples(node, triples);
+    if (result != SSLOG_ERROR_NO){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Feedback is not inserted: %s", sslog_error_get_last_text());
+    }
+
+    list_del_and_free_nodes(triples, LIST_CAST_TO_FREE_FUNC sslog_free_triple);
+    return (result == SSLOG_ERROR_NO) ? 0 : -1;
+}
+
+static jobjectArray kp_feedback_to_array(JNIEnv *env, kp_feedback_methods_t *methods, jobject object, jmethodID list_method){
+    if (object == NULL){
+        return NULL;
+    }
+
+    jobject list = (*env)->CallObjectMethod(env, object, list_method);
+    if (list == NULL){
+        return NULL;
+    }
+
+    jobjectArray array = (jobjectArray) (*env)->CallObjectMethod(env, list, methods->list_to_array);
+    (*env)->DeleteLocalRef(env, list);
+    return array;
+}
+
+/* Returns a copy of the string or NULL for null and empty strings */
+static char* kp_feedback_get_string(JNIEnv *env, jobject object, jmethodID method){
+    if (object == NULL){
+        return NULL;
+    }
+
+    jstring value = (jstring) (*env)->CallObjectMethod(env, object, method);
+    if (value == NULL){
+        return NULL;
+    }
+
+    char *copy = NULL;
+    const char *value_ = (*env)->GetStringUTFChars(env, value, NULL);
+    if (value_ != NULL){
+        if (value_[0] != '\0'){
+            copy = strdup(value_);
+        }
+        (*env)->ReleaseStringUTFChars(env, value, value_);
+    }
+    (*env)->DeleteLocalRef(env, value);
+    return copy;
+}
+
+/* URI of the Java object or the generated URI if it is empty */
+static char* kp_feedback_get_uri(JNIEnv *env, jobject object, jmethodID method, const char *format, ...){
+    char *uri = kp_feedback_get_string(env, object, method);
+    if (uri != NULL){
+        return uri;
+    }
+
+    va_list args;
+    va_start(args, format);
+    if (vasprintf(&uri, format, args) == -1){
+        uri = NULL;
+    }
+    va_end(args);
+    return uri;
+}
+
+static void kp_feedback_add_triple(list_t *triples, const char *subject, const char *predicate,
+                                   const char *object, sslog_rdf_type object_type){
+    sslog_triple_t *triple = sslog_new_triple_detached(subject, predicate, object, SSLOG_RDF_TYPE_URI, object_type);
+    if (triple != NULL){
+        list_add_data(triples, triple);
+    }
+}
@@ -0,0 +1,27 @@
+//
+// Publishing of the feedback (answers of the patient) to the smart space.
+//
+
+#ifndef SMARTCARE_QUESTIONNAIRE_FEEDBACK_H
+#define SMARTCARE_QUESTIONNAIRE_FEEDBACK_H
+
+#include <jni.h>
+#include "ontology/smartcare.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/*
+ * Triples of the feedback are inserted with chunks of this size,
+ * triples of one response are never split between chunks
+ */
+#define KP_FEEDBACK_CHUNK_TRIPLES 512
+
+jintArray kp_send_feedback(JNIEnv*, sslog_node_t*, jobject);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif //SMARTCARE_QUESTIONNAIRE_FEEDBACK_H
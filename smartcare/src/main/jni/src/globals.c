@@ -12,21 +12,10 @@ JNIEnv *envGlob;
 jclass *GlobalMainActivityClass;
 jclass *GlobalPatientHelpActivityClass;
 jmethodID GlobalGetHelpRequestNotification;
-sslog_node_t *GlobalNode;
-
-jclass *class_question;
-jclass *class_questionnaire;
-jclass *class_answer;
-jclass *class_answer_item;
-
-jmethodID questionnaire_constructor;
-jmethodID add_question;
-jmethodID question_constructor;
-jmethodID answer_constructor;
-jmethodID add_answer;
-jmethodID add_subanswer;
-jmethodID item_constructor;
-jmethodID add_answer_item_i;
+
+jclass *class_questionnaire_data;
+
+jmethodID questionnaire_data_constructor;
 
 
 
@@ -6,9 +6,324 @@
 #include <string.h>
 #include "handlers.h"
 #include <stdbool.h>
+#include <pthread.h>
 #include <android/log.h>
 #include <jni.h>
 #include "globals.h"
+#include "handles.h"
 
 #define TAG "SS"
 
+#define RDF_TYPE "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"
+
+/* All triples of individuals that are reachable from the questionnaire by links */
+#define KP_QUESTIONNAIRE_SELECT \
+    "PREFIX sc: <http://oss.fruct.org/smartcare#> " \
+    "SELECT ?s ?p ?o WHERE { " \
+    "<%s> (sc:firstQuestion|sc:nextQuestion|sc:hasAnswer|sc:singleItem|sc:multipleItem" \
+    "|sc:dichotomousItem|sc:rangingItem|sc:leftBipolar|sc:rightBipolar|sc:subAnswer)* ?s . " \
+    "?s ?p ?o }"
+
+#define KP_QUESTIONNAIRE_SELECT_TEMPLATE "s p o"
+
+struct kp_subscription_s {
+    sslog_subscription_t *subscription;
+    /* Handle of the node, the node is kept until the subscription is freed */
+    jlong node;
+
+    /* Global reference to the QuestionnaireListener */
+    jobject listener;
+    jmethodID on_question_added;
+    jmethodID on_question_removed;
+    jmethodID on_question_text_changed;
+    jmethodID on_item_changed;
+};
+
+/*
+ * Subscription handler gets only the subscription, so listeners are found
+ * in this list. Handlers are called with the lock, so the subscription is not
+ * freed while its changes are passed to Java.
+ */
+static list_t kp_subscriptions = {NULL, LIST_HEAD_INIT(kp_subscriptions.links)};
+static pthread_mutex_t kp_subscriptions_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/* Subscription thread is attached once and detached when it exits */
+static pthread_key_t kp_thread_env_key;
+static pthread_once_t kp_thread_env_once = PTHREAD_ONCE_INIT;
+
+static void kp_subscription_changed(sslog_subscription_t *sbcr);
+static void kp_subscription_free(JNIEnv *env, kp_subscription_t *kp_sbcr);
+static bool kp_is_question(const char *uri, list_t *changed_triples);
+static bool kp_has_question_type(const char *uri, list_t *triples);
+static bool kp_contains_subject(list_t *subjects, const char *uri);
+static JNIEnv* kp_attach_thread();
+static void kp_create_thread_env_key();
+static void kp_detach_thread(void *env);
+static void kp_check_exception(JNIEnv *env);
+
+
+kp_subscription_t* kp_subscribe_questionnaire(JNIEnv* env, jlong node_handle, const char *questionnaire_uri, jobject listener){
+    jclass listener_class = (*env)->GetObjectClass(env, listener);
+    if (listener_class == NULL){
+        return NULL;
+    }
+
+    kp_subscription_t *kp_sbcr = (kp_subscription_t *) calloc(1, sizeof(kp_subscription_t));
+    if (kp_sbcr == NULL){
+        return NULL;
+    }
+
+    kp_sbcr->on_question_added = (*env)->GetMethodID(env, listener_class, "onQuestionAdded", "(Ljava/lang/String;)V");
+    kp_sbcr->on_question_removed = (*env)->GetMethodID(env, listener_class, "onQuestionRemoved", "(Ljava/lang/String;)V");
+    kp_sbcr->on_question_text_changed = (*env)->GetMethodID(env, listener_class, "onQuestionTextChanged", "(Ljava/lang/String;Ljava/lang/String;)V");
+    kp_sbcr->on_item_changed = (*env)->GetMethodID(env, listener_class, "onItemChanged", "(Ljava/lang/String;)V");
+    (*env)->DeleteLocalRef(env, listener_class);
+
+    if (kp_sbcr->on_question_added == NULL || kp_sbcr->on_question_removed == NULL
+        || kp_sbcr->on_question_text_changed == NULL || kp_sbcr->on_item_changed == NULL){
+        free(kp_sbcr);
+        return NULL;
+    }
+
+    sslog_node_t *node = kp_nodes_get(node_handle);
+    if (node == NULL){
+        free(kp_sbcr);
+        return NULL;
+    }
+    kp_sbcr->node = node_handle;
+
+    char *query = NULL;
+    if (asprintf(&query, KP_QUESTIONNAIRE_SELECT, questionnaire_uri) == -1){
+        kp_subscription_free(env, kp_sbcr);
+        return NULL;
+    }
+
+    kp_sbcr->listener = (*env)->NewGlobalRef(env, listener);
+    kp_sbcr->subscription = sslog_new_subscription(node, true);
+
+    if (kp_sbcr->listener == NULL || kp_sbcr->subscription == NULL
+        || sslog_sbcr_add_sparql_select(kp_sbcr->subscription, query, KP_QUESTIONNAIRE_SELECT_TEMPLATE) != SSLOG_ERROR_NO){
+        free(query);
+        kp_subscription_free(env, kp_sbcr);
+        return NULL;
+    }
+    free(query);
+
+    sslog_sbcr_set_changed_handler(kp_sbcr->subscription, kp_subscription_changed);
+
+    /* Handler can be called right after subscribing, so the subscription is registered before */
+    pthread_mutex_lock(&kp_subscriptions_mutex);
+    list_add_data(&kp_subscriptions, kp_sbcr);
+    pthread_mutex_unlock(&kp_subscriptions_mutex);
+
+    if (sslog_sbcr_subscribe(kp_sbcr->subscription) != SSLOG_ERROR_NO){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Can't subscribe: %s", sslog_error_get_last_text());
+        kp_unsubscribe_questionnaire(env, kp_sbcr);
+        return NULL;
+    }
+
+    return kp_sbcr;
+}
+
+/*
+ * The subscription can't be used after this call,
+ * it must not be called from the listener (the handler holds the lock)
+ */
+void kp_unsubscribe_questionnaire(JNIEnv* env, kp_subscription_t *kp_sbcr){
+    if (kp_sbcr == NULL){
+        return;
+    }
+
+    pthread_mutex_lock(&kp_subscriptions_mutex);
+    list_del_and_free_nodes_with_data(&kp_subscriptions, kp_sbcr, NULL);
+    pthread_mutex_unlock(&kp_subscriptions_mutex);
+
+    if (sslog_sbcr_is_active(kp_sbcr->subscription) == true){
+        sslog_sbcr_unsubscribe(kp_sbcr->subscription);
+    }
+    kp_subscription_free(env, kp_sbcr);
+}
+
+
+/*
+ * Changes of the graph are converted to events of questions:
+ * rdf:type triples of questions are added or removed with questions,
+ * new descriptions of existing questions are new texts.
+ * Other changed individuals (answers, items, subanswers) are passed once per indication.
+ */
+static void kp_subscription_changed(sslog_subscription_t *sbcr){
+    pthread_mutex_lock(&kp_subscriptions_mutex);
+
+    kp_subscription_t *kp_sbcr = NULL;
+    list_head_t *iterator = NULL;
+    list_for_each(iterator, &kp_subscriptions.links){
+        list_t *list_node = list_entry(iterator, list_t, links);
+        if (((kp_subscription_t *) list_node->data)->subscription == sbcr){
+            kp_sbcr = (kp_subscription_t *) list_node->data;
+            break;
+        }
+    }
+
+    sslog_sbcr_changes_t *changes = sslog_sbcr_get_changes_last(sbcr);
+    JNIEnv *env = (kp_sbcr != NULL && changes != NULL) ? kp_attach_thread() : NULL;
+    if (env == NULL){
+        pthread_mutex_unlock(&kp_subscriptions_mutex);
+        return;
+    }
+
+    list_t *removed = sslog_sbcr_ch_get_triples(changes, SSLOG_ACTION_REMOVE);
+    list_t *inserted = sslog_sbcr_ch_get_triples(changes, SSLOG_ACTION_INSERT);
+    const char *question_class_uri = sslog_entity_get_uri(CLASS_QUESTION);
+    const char *description_uri = sslog_entity_get_uri(PROPERTY_DESCRIPTION);
+    list_t *changed_items = list_new();
+
+    iterator = NULL;
+    list_for_each(iterator, &removed->links){
+        sslog_triple_t *triple = (sslog_triple_t *) list_entry(iterator, list_t, links)->data;
+        jstring uri = NULL;
+
+        if (strcmp(triple->predicate, RDF_TYPE) == 0 && strcmp(triple->object, question_class_uri) == 0){
+            uri = (*env)->NewStringUTF(env, triple->subject);
+            (*env)->CallVoidMethod(env, kp_sbcr->listener, kp_sbcr->on_question_removed, uri);
+        } else if (kp_is_question(triple->subject, removed) == false
+                   && kp_contains_subject(changed_items, triple->subject) == false){
+            list_add_data(changed_items, triple->subject);
+        }
+
+        if (uri != NULL){
+            (*env)->DeleteLocalRef(env, uri);
+        }
+        kp_check_exception(env);
+    }
+
+    iterator = NULL;
+    list_for_each(iterator, &inserted->links){
+        sslog_triple_t *triple = (sslog_triple_t *) list_entry(iterator, list_t, links)->data;
+        jstring uri = NULL;
+
+        if (strcmp(triple->predicate, RDF_TYPE) == 0 && strcmp(triple->object, question_class_uri) == 0){
+            uri = (*env)->NewStringUTF(env, triple->subject);
+            (*env)->CallVoidMethod(env, kp_sbcr->listener, kp_sbcr->on_question_added, uri);
+        } else if (strcmp(triple->predicate, description_uri) == 0 && kp_is_question(triple->subject, NULL) == true){
+            /* Description of the added question is passed with the question */
+            if (kp_has_question_type(triple->subject, inserted) == false){
+                uri = (*env)->NewStringUTF(env, triple->subject);
+                jstring text = (*env)->NewStringUTF(env, triple->object);
+                (*env)->CallVoidMethod(env, kp_sbcr->listener, kp_sbcr->on_question_text_changed, uri, text);
+                (*env)->DeleteLocalRef(env, text);
+            }
+        } else if (kp_is_question(triple->subject, inserted) == false
+                   && kp_contains_subject(changed_items, triple->subject) == false){
+            list_add_data(changed_items, triple->subject);
+        }
+
+        if (uri != NULL){
+            (*env)->DeleteLocalRef(env, uri);
+        }
+        kp_check_exception(env);
+    }
+
+    iterator = NULL;
+    list_for_each(iterator, &changed_items->links){
+        const char *item_uri = (const char *) list_entry(iterator, list_t, links)->data;
+        jstring uri = (*env)->NewStringUTF(env, item_uri);
+        (*env)->CallVoidMethod(env, kp_sbcr->listener, kp_sbcr->on_item_changed, uri);
+        (*env)->DeleteLocalRef(env, uri);
+        kp_check_exception(env);
+    }
+
+    list_free_with_nodes(changed_items, NULL);
+    list_free_with_nodes(removed, NULL);
+    list_free_with_nodes(inserted, NULL);
+
+    pthread_mutex_unlock(&kp_subscriptions_mutex);
+}
+
+static void kp_subscription_free(JNIEnv *env, kp_subscription_t *kp_sbcr){
+    if (kp_sbcr->subscription != NULL){
+        sslog_free_subscription(kp_sbcr->subscription);
+    }
+    if (kp_sbcr->listener != NULL){
+        (*env)->DeleteGlobalRef(env, kp_sbcr->listener);
+    }
+    if (kp_sbcr->node != 0){
+        kp_handles_put(env, kp_sbcr->node);
+    }
+    free(kp_sbcr);
+}
+
+/*
+ * Individual is a question if the local store contains its type
+ * or its type is in the changed triples (removed questions are not in the store)
+ */
+static bool kp_is_question(const char *uri, list_t *changed_triples){
+    if (changed_triples != NULL && kp_has_question_type(uri, changed_triples) == true){
+        return true;
+    }
+
+    const char *question_class_uri = sslog_entity_get_uri(CLASS_QUESTION);
+    sslog_triple_t *type_template = sslog_new_triple_detached(uri, RDF_TYPE, question_class_uri,
+                                                             SSLOG_RDF_TYPE_URI, SSLOG_RDF_TYPE_URI);
+    list_t *types = sslog_query_triple(type_template);
+    bool is_question = (list_is_null_or_empty(types) == false);
+
+    list_free_with_nodes(types, NULL);
+    sslog_free_triple(type_template);
+    return is_question;
+}
+
+static bool kp_has_question_type(const char *uri, list_t *triples){
+    const char *question_class_uri = sslog_entity_get_uri(CLASS_QUESTION);
+
+    list_head_t *iterator = NULL;
+    list_for_each(iterator, &triples->links){
+        sslog_triple_t *triple = (sslog_triple_t *) list_entry(iterator, list_t, links)->data;
+        if (strcmp(triple->subject, uri) == 0 && strcmp(triple->predicate, RDF_TYPE) == 0
+            && strcmp(triple->object, question_class_uri) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool kp_contains_subject(list_t *subjects, const char *uri){
+    list_head_t *iterator = NULL;
+    list_for_each(iterator, &subjects->links){
+        if (strcmp((const char *) list_entry(iterator, list_t, links)->data, uri) == 0){
+            return true;
+        }
+    }
+    return false;
+}
+
+static JNIEnv* kp_attach_thread(){
+    JNIEnv *env = NULL;
+    if ((*JVM)->GetEnv(JVM, (void **) &env, JNI_VERSION_1_6) == JNI_OK){
+        return env;
+    }
+
+    if ((*JVM)->AttachCurrentThread(JVM, &env, NULL) != JNI_OK){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Can't attach the subscription thread");
+        return NULL;
+    }
+
+    pthread_once(&kp_thread_env_once, kp_create_thread_env_key);
+    pthread_setspecific(kp_thread_env_key, env);
+    return env;
+}
+
+static void kp_create_thread_env_key(){
+    pthread_key_create(&kp_thread_env_key, kp_detach_thread);
+}
+
+static void kp_detach_thread(void *env){
+    (*JVM)->DetachCurrentThread(JVM);
+}
+
+/* Exceptions of listeners are logged, the subscription is continued */
+static void kp_check_exception(JNIEnv *env){
+    if ((*env)->ExceptionCheck(env)){
+        (*env)->ExceptionDescribe(env);
+        (*env)->ExceptionClear(env);
+    }
+}
@@ -10,7 +10,17 @@ extern "C" {
 #endif //SMARTCARE_QUESTIONNAIRE_HANDLERS_H
 
 #include "ontology/smartcare.h"
+#include <jni.h>
+
+/*
+ * Subscription to the questionnaire graph, changes are passed
+ * to the QuestionnaireListener (Java) on the subscription thread
+ */
+typedef struct kp_subscription_s kp_subscription_t;
+
+kp_subscription_t* kp_subscribe_questionnaire(JNIEnv*, jlong, const char*, jobject);
+void kp_unsubscribe_questionnaire(JNIEnv*, kp_subscription_t*);
 
 #ifdef	__cplusplus
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,175 @@
+//
+// Table of objects of Java (nodes, tasks and subscriptions): Java gets handles instead of pointers.
+//
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+#include <jni.h>
+
+#include "handles.h"
+
+typedef struct kp_handle_slot_s {
+    void *object;
+    int kind;
+    kp_handle_free_func free_object;
+    uint32_t generation;
+
+    /* Users of the object, the table is one of them until the handle is removed */
+    int references;
+    bool is_removed;
+
+    /* Records of the last questionnaire that is passed to Java (nodes only) */
+    kp_data_t questionnaire;
+} kp_handle_slot_t;
+
+static kp_handle_slot_t kp_handles[KP_HANDLES_MAX];
+static pthread_mutex_t kp_handles_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static kp_handle_slot_t* kp_handles_find(jlong handle);
+static kp_handle_slot_t* kp_handles_find_used(jlong handle, int kind);
+static void kp_handles_release(JNIEnv *env, kp_handle_slot_t *slot);
+
+
+/* Returns the handle of the object or -1 if there are no free slots */
+jlong kp_handles_add(int kind, void *object, kp_handle_free_func free_object){
+    if (object == NULL){
+        return -1;
+    }
+
+    jlong handle = -1;
+    pthread_mutex_lock(&kp_handles_mutex);
+    for (int i = 0; i < KP_HANDLES_MAX; ++i){
+        if (kp_handles[i].object == NULL){
+            kp_handles[i].object = object;
+            kp_handles[i].kind = kind;
+            kp_handles[i].free_object = free_object;
+            kp_handles[i].references = 1;
+            kp_handles[i].is_removed = false;
+            handle = ((jlong) kp_handles[i].generation << 32) | (jlong) (i + 1);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&kp_handles_mutex);
+    return handle;
+}
+
+/* Returns NULL for unknown and removed handles and for objects of other kinds */
+void* kp_handles_get(jlong handle, int kind){
+    pthread_mutex_lock(&kp_handles_mutex);
+    kp_handle_slot_t *slot = kp_handles_find_used(handle, kind);
+    void *object = NULL;
+    if (slot != NULL){
+        ++slot->references;
+        object = slot->object;
+    }
+    pthread_mutex_unlock(&kp_handles_mutex);
+    return object;
+}
+
+/* Releases the object that is got by kp_handles_get */
+void kp_handles_put(JNIEnv *env, jlong handle){
+    pthread_mutex_lock(&kp_handles_mutex);
+    kp_handles_release(env, kp_handles_find(handle));
+}
+
+/*
+ * Handle is not valid after this call, the object is freed when it is not used.
+ * Returns -1 for unknown and removed handles
+ */
+int kp_handles_remove(JNIEnv *env, jlong handle, int kind){
+    pthread_mutex_lock(&kp_handles_mutex);
+    kp_handle_slot_t *slot = kp_handles_find_used(handle, kind);
+    if (slot == NULL){
+        pthread_mutex_unlock(&kp_handles_mutex);
+        return -1;
+    }
+
+    slot->is_removed = true;
+    kp_handles_release(env, slot);
+    return 0;
+}
+
+sslog_node_t* kp_nodes_get(jlong handle){
+    return (sslog_node_t *) kp_handles_get(handle, KP_HANDLE_NODE);
+}
+
+/* Records are moved to the slot, the data gets previous records of the slot */
+void kp_nodes_set_questionnaire(jlong handle, kp_data_t *data){
+    if (data->is_failed || data->records_count == 0){
+        return;
+    }
+
+    pthread_mutex_lock(&kp_handles_mutex);
+    kp_handle_slot_t *slot = kp_handles_find_used(handle, KP_HANDLE_NODE);
+    if (slot != NULL){
+        kp_data_t questionnaire = slot->questionnaire;
+        slot->questionnaire = *data;
+        *data = questionnaire;
+    }
+    pthread_mutex_unlock(&kp_handles_mutex);
+}
+
+/* Returns -1 for unknown handles or if there is no questionnaire */
+int kp_nodes_save_questionnaire(jlong handle, const char *path){
+    int result = -1;
+
+    pthread_mutex_lock(&kp_handles_mutex);
+    kp_handle_slot_t *slot = kp_handles_find_used(handle, KP_HANDLE_NODE);
+    if (slot != NULL && slot->questionnaire.records_count > 0){
+        result = kp_data_save(&slot->questionnaire, path);
+    }
+    pthread_mutex_unlock(&kp_handles_mutex);
+    return result;
+}
+
+
+/* Slot of the object that is not freed yet (its handle can be removed) */
+static kp_handle_slot_t* kp_handles_find(jlong handle){
+    jlong index = (handle & 0xffffffff) - 1;
+    uint32_t generation = (uint32_t) ((uint64_t) handle >> 32);
+
+    if (handle <= 0 || index < 0 || index >= KP_HANDLES_MAX){
+        return NULL;
+    }
+
+    kp_handle_slot_t *slot = &kp_handles[index];
+    if (slot->object == NULL || slot->generation != generation){
+        return NULL;
+    }
+    return slot;
+}
+
+static kp_handle_slot_t* kp_handles_find_used(jlong handle, int kind){
+    kp_handle_slot_t *slot = kp_handles_find(handle);
+    if (slot == NULL || slot->is_removed || slot->kind != kind){
+        return NULL;
+    }
+    return slot;
+}
+
+/*
+ * Called with the locked table, unlocks it. The last reference frees the slot,
+ * the object is freed without the lock (leaving the smart space takes time)
+ */
+static void kp_handles_release(JNIEnv *env, kp_handle_slot_t *slot){
+    if (slot == NULL || --slot->references > 0){
+        pthread_mutex_unlock(&kp_handles_mutex);
+        return;
+    }
+
+    void *object = slot->object;
+    kp_handle_free_func free_object = slot->free_object;
+
+    slot->object = NULL;
+    slot->free_object = NULL;
+    kp_data_free(&slot->questionnaire);
+    /* Handles stay positive */
+    slot->generation = (slot->generation + 1) & 0x7fffffff;
+    pthread_mutex_unlock(&kp_handles_mutex);
+
+    if (free_object != NULL){
+        free_object(env, object);
+    }
+}
@@ -0,0 +1,55 @@
+//
+// Table of objects of Java (nodes, tasks and subscriptions): Java gets handles instead of pointers.
+//
+
+#ifndef SMARTCARE_QUESTIONNAIRE_HANDLES_H
+#define SMARTCARE_QUESTIONNAIRE_HANDLES_H
+
+#include <jni.h>
+#include "ontology/smartcare.h"
+#include "marshal.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/* Maximum number of objects that are used by Java at the same time */
+#define KP_HANDLES_MAX 64
+
+/* Kinds of objects, the handle of one kind is not valid for others */
+#define KP_HANDLE_NODE 0
+#define KP_HANDLE_TASK 1
+#define KP_HANDLE_SUBSCRIPTION 2
+
+/* Frees the object after its handle is removed and the object is not used */
+typedef void (*kp_handle_free_func)(JNIEnv*, void*);
+
+/*
+ * Handle is the index of the slot and its generation, the generation is changed
+ * when the object is freed, so handles of removed objects are not valid
+ * (also if the slot is used by another object). Handles are never 0 or -1.
+ *
+ * Users of the object get it with a reference and put it when they finish,
+ * the removed object is freed by the last of them (or by kp_handles_remove
+ * if it is not used). The handle is removed once, other calls do nothing.
+ */
+jlong kp_handles_add(int, void*, kp_handle_free_func);
+void* kp_handles_get(jlong, int);
+void kp_handles_put(JNIEnv*, jlong);
+int kp_handles_remove(JNIEnv*, jlong, int);
+
+/* Nodes: kp_nodes_get must be paired with kp_handles_put */
+sslog_node_t* kp_nodes_get(jlong);
+
+/*
+ * Last questionnaire that is passed to Java with the node is kept in its slot
+ * and saved to the snapshot without requests to the smart space
+ */
+void kp_nodes_set_questionnaire(jlong, kp_data_t*);
+int kp_nodes_save_questionnaire(jlong, const char*);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif //SMARTCARE_QUESTIONNAIRE_HANDLES_H
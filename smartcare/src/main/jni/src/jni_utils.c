@@ -8,7 +8,14 @@
 #include "jni_utils.h"
 #include "globals.h"
 
+/*
+ * Global references are created once, several nodes
+ * (and reconnections) use the same references
+ */
 int init_global_instances(JNIEnv* env, jobject obj) {
+    if (class_questionnaire_data != NULL && questionnaire_data_constructor != NULL) {
+        return 0;
+    }
 
     GlobalMainActivityClassObject = (jobject * )(*env)->NewGlobalRef(env, obj);
     if (NULL == GlobalMainActivityClassObject) { return -1; }
@@ -19,51 +26,15 @@ int init_global_instances(JNIEnv* env, jobject obj) {
     if (NULL == GlobalMainActivityClass) { return -1; }
 
 
-    jclass _class_questionnaire = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/Questionnaire");
-    if (_class_questionnaire == NULL) { return -1;  }
-    class_questionnaire = (jclass * )(*env)->NewGlobalRef(env, _class_questionnaire);
-    if (class_questionnaire == NULL) { return -1; }
-
-
-    jclass _class_question = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/Question");
-    if (_class_question == NULL) { return -1; }
-    class_question = (jclass * )(*env)->NewGlobalRef(env, _class_question);
-    if (NULL == class_question) { return -1; }
-
-    jclass _class_answer = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/Answer");
-    if (_class_answer == NULL) { return -1; }
-    class_answer = (jclass * )(*env)->NewGlobalRef(env, _class_answer);
-    if (NULL == class_answer) { return -1; }
-
-    jclass _class_answer_item = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/AnswerItem");
-    if (_class_answer_item == NULL) { return -1; }
-    class_answer_item = (jclass * )(*env)->NewGlobalRef(env, _class_answer_item);
-    if (NULL == class_answer_item) { return -1; }
-
-    questionnaire_constructor = (*env)->GetMethodID(env, class_questionnaire, "<init>", "(Ljava/lang/String;)V");
-    if (questionnaire_constructor == NULL) { return -1; }
-
-    add_question = (*env)->GetMethodID(env, class_questionnaire, "addQuestion", "(Lcom/petrsu/cardiacare/smartcare/Question;)V");
-    if (add_question == NULL) { return -1; }
+    jclass _class_questionnaire_data = (*env)->FindClass(env, "com/petrsu/cardiacare/smartcare/QuestionnaireData");
+    if (_class_questionnaire_data == NULL) { return -1;  }
+    class_questionnaire_data = (jclass * )(*env)->NewGlobalRef(env, _class_questionnaire_data);
+    if (class_questionnaire_data == NULL) { return -1; }
 
-    question_constructor = (*env)->GetMethodID(env, class_question, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-    if (question_constructor == NULL) { return -1; }
-
-    answer_constructor = (*env)->GetMethodID(env, class_answer, "<init>", "(Ljava/lang/String;Ljava/lang/String;)V");
-    if (answer_constructor == NULL) { return -1; }
-
-    add_answer = (*env)->GetMethodID(env, class_question, "setAnswer", "(Lcom/petrsu/cardiacare/smartcare/Answer;)V");
-    if (add_answer == NULL) { return -1; }
-
-    add_subanswer = (*env)->GetMethodID(env, class_answer_item, "addSubAnswer", "(Lcom/petrsu/cardiacare/smartcare/Answer;)V");
-    if (add_subanswer == NULL) { return -1; }
-
-    item_constructor = (*env)->GetMethodID(env, class_answer_item, "<init>", "(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)V");
-    if ( item_constructor == NULL) { return -1; }
-
-    add_answer_item_i = (*env)->GetMethodID(env,  class_answer, "addAnswerItem", "(Lcom/petrsu/cardiacare/smartcare/AnswerItem;)V");
-    if (add_answer_item_i == NULL) { return -1; }
+    questionnaire_data_constructor = (*env)->GetMethodID(env, class_questionnaire_data, "<init>", "([B[I)V");
+    if (questionnaire_data_constructor == NULL) { return -1; }
 
+    return 0;
 }
 int init_JVM_instance(JNIEnv* env){
     if((*env)->GetJavaVM(env, &JVM) != 0){
@@ -23,7 +23,9 @@
 #include <errno.h>
 #include "agent.h"
 
+#include "handles.h"
 #include "handlers.h"
+#include "feedback.h"
 #include "jni_utils.h"
 #include "globals.h"
 
@@ -31,6 +33,28 @@
 #define KP_NS_URI "http://oss.fruct.org/smartcare#"
 #define KP_PREDICATE KP_NS_URI"sendAlarm"
 
+/* Tasks and subscriptions are freed when their handles are removed and they are not used */
+static void kp_free_task(JNIEnv* env, void *task){
+    kp_task_cancel(env, (kp_task_t *) task);
+}
+
+static void kp_free_subscription(JNIEnv* env, void *subscription){
+    kp_unsubscribe_questionnaire(env, (kp_subscription_t *) subscription);
+}
+
+/* Java gets the handle of the task, the task is cancelled if there are no free slots */
+static jlong kp_add_task(JNIEnv* env, kp_task_t *task){
+    if (task == NULL){
+        return -1;
+    }
+
+    jlong handle = kp_handles_add(KP_HANDLE_TASK, task, kp_free_task);
+    if (handle == -1){
+        kp_task_cancel(env, task);
+    }
+    return handle;
+}
+
 /*
  *   Подключаемся к Интелектуальному пространству
  *  SmartSpace node initialization by hostname_, ip_,port
@@ -44,9 +68,13 @@ JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_co
     }
     const char *ip_ = (*env)->GetStringUTFChars(env, ip, NULL);
     if( ip_ == NULL ){
+        (*env)->ReleaseStringUTFChars(env, hostname, hostname_);
         return -1;
     }
-    long node = kp_connect_smartspace( hostname_, ip_, port);
+    jlong node = kp_connect_smartspace( hostname_, ip_, port);
+
+    (*env)->ReleaseStringUTFChars(env, hostname, hostname_);
+    (*env)->ReleaseStringUTFChars(env, ip, ip_);
 
     if (node == -1) {
         __android_log_print(ANDROID_LOG_INFO, TAG, "Can't join to SS");
@@ -69,10 +97,10 @@ JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_co
         return -1;
     }
     /*
-     * Return node descriptor
+     * Return node descriptor (handle, see handles.h)
      * to use it further in subscriptions etc.
      */
-    return (jlong) node;
+    return node;
 
 }
 /*
@@ -81,7 +109,7 @@ JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_co
  */
 JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_disconnectSmartSpace( JNIEnv* env,
                                                   jobject thiz , jlong nodeDescriptor){
-    int result = kp_disconnect_smartspace(nodeDescriptor);
+    int result = kp_disconnect_smartspace(env, nodeDescriptor);
 
     if (result == -1)
         __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
@@ -90,35 +118,223 @@ JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_dis
 }
 
 
-JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnaire
+/*
+ *  Questionnaire is passed as QuestionnaireData (flat arrays) with one call,
+ *  Java objects are built by QuestionnaireBuilder
+ */
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnaireData
         (JNIEnv* env, jobject thiz , jlong nodeDescriptor){
 
-    sslog_node_t *node = (sslog_node_t *) nodeDescriptor;
+    sslog_node_t *node = kp_nodes_get(nodeDescriptor);
+    if (node == NULL ){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
+        return NULL;
+    }
+
+    kp_data_t data;
+    kp_data_init(&data);
+
+    jobject questionnaire_data = NULL;
+    if (kp_build_questionnaire(env, node, &data, NULL) == 0){
+        questionnaire_data = kp_data_to_java(env, &data);
+        kp_nodes_set_questionnaire(nodeDescriptor, &data);
+    }
+
+    kp_data_free(&data);
+    kp_handles_put(env, nodeDescriptor);
+    return questionnaire_data;
+}
+
+/*
+ *  Several questionnaires are passed as one QuestionnaireData,
+ *  each of them starts with its questionnaire record (limit <= 0 - all questionnaires)
+ */
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnairesData
+        (JNIEnv* env, jobject thiz , jlong nodeDescriptor, jint limit){
+
+    sslog_node_t *node = kp_nodes_get(nodeDescriptor);
     if (node == NULL ){
         __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
         return NULL;
     }
-    char* questionnaire_uri;
-    sslog_individual_t *questionnaire_ss =  kp_get_questionnaire(node, &questionnaire_uri);
 
-    /**************/
-    jobject *questionnaire;
-    questionnaire = (*env)->NewObject(env, class_questionnaire, questionnaire_constructor, (*env)->NewStringUTF(env, questionnaire_uri) );
+    kp_data_t data;
+    kp_data_init(&data);
+
+    jobject questionnaires_data = NULL;
+    if (kp_build_questionnaires(env, node, &data, limit) == 0){
+        questionnaires_data = kp_data_to_java(env, &data);
+    }
+
+    kp_data_free(&data);
+    kp_handles_put(env, nodeDescriptor);
+    return questionnaires_data;
+}
+
+/*
+ *  Saves the last questionnaire that is passed to Java with the node (getQuestionnaire
+ *  or the task) to the binary snapshot (see marshal.h), the smartspace is not accessed.
+ *  The snapshot is loaded with loadQuestionnaireSnapshotData without the smartspace
+ */
+JNIEXPORT jint JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_saveQuestionnaireSnapshot
+        (JNIEnv* env, jobject thiz, jlong nodeDescriptor, jstring path){
+
+    const char *path_ = (*env)->GetStringUTFChars(env, path, NULL);
+    if (path_ == NULL){
+        return -1;
+    }
+
+    int result = kp_nodes_save_questionnaire(nodeDescriptor, path_);
+    if (result != 0){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Questionnaire is not saved");
+    }
+
+    (*env)->ReleaseStringUTFChars(env, path, path_);
+    return result;
+}
+
+/*
+ *  Maps the snapshot and passes it as QuestionnaireData, connection is not needed
+ */
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_loadQuestionnaireSnapshotData
+        (JNIEnv* env, jobject thiz, jstring path){
+
+    if (-1 == init_global_instances(env, thiz)){
+        return NULL;
+    }
+
+    const char *path_ = (*env)->GetStringUTFChars(env, path, NULL);
+    if (path_ == NULL){
+        return NULL;
+    }
+
+    jobject questionnaire_data = kp_data_load_to_java(env, path_);
+
+    (*env)->ReleaseStringUTFChars(env, path, path_);
+    return questionnaire_data;
+}
+
+/*
+ *  Connects to smartspace and loads the questionnaire on the worker thread,
+ *  results are passed to the callback
+ */
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_startConnectTask
+        (JNIEnv* env, jobject thiz, jstring hostname, jstring ip, jint port, jobject callback){
+
+    if (-1 == init_global_instances(env, thiz) || -1 == init_JVM_instance(env)) {
+        return -1;
+    }
+
+    const char *hostname_ = (*env)->GetStringUTFChars(env, hostname, NULL);
+    if( hostname_ == NULL) {
+        return -1;
+    }
+    const char *ip_ = (*env)->GetStringUTFChars(env, ip, NULL);
+    if( ip_ == NULL ){
+        (*env)->ReleaseStringUTFChars(env, hostname, hostname_);
+        return -1;
+    }
 
-    char* question_uri;
-    char* next_question_uri;
+    kp_task_t *task = kp_task_start(env, callback, hostname_, ip_, port, 0);
 
-    jobject first_question;
-    first_question = kp_get_first_question(env, questionnaire, node, questionnaire_ss, &next_question_uri);
-    question_uri = next_question_uri;
-    (*env)->CallVoidMethod(env, questionnaire, add_question, first_question);
+    (*env)->ReleaseStringUTFChars(env, hostname, hostname_);
+    (*env)->ReleaseStringUTFChars(env, ip, ip_);
+
+    return kp_add_task(env, task);
+}
+
+/*
+ *  Loads the questionnaire on the worker thread, results are passed to the callback
+ */
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_startQuestionnaireTask
+        (JNIEnv* env, jobject thiz, jlong nodeDescriptor, jobject callback){
+
+    /* The task gets the node by itself, it fails if the node is disconnected before */
+    if (kp_nodes_get(nodeDescriptor) == NULL){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
+        return -1;
+    }
+    kp_handles_put(env, nodeDescriptor);
 
-    jobject next_question;
-    while (next_question_uri != NULL) {
-        next_question = kp_get_next_question(env, questionnaire, node, questionnaire_ss, question_uri, &next_question_uri);
-        (*env)->CallVoidMethod(env, questionnaire, add_question, next_question);
-        question_uri = next_question_uri;
+    if (JVM == NULL){
+        return -1;
     }
-    /**************/
-    return questionnaire;
+
+    kp_task_t *task = kp_task_start(env, callback, NULL, NULL, 0, nodeDescriptor);
+    return kp_add_task(env, task);
+}
+
+/*
+ *  Cancels the task, it must be called for each task (also after its completion),
+ *  next calls with the same descriptor do nothing
+ */
+JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_cancelTask
+        (JNIEnv* env, jobject thiz, jlong taskDescriptor){
+
+    kp_handles_remove(env, taskDescriptor, KP_HANDLE_TASK);
+}
+
+/*
+ *  Subscribes to the questionnaire graph, changes of questions are passed
+ *  to the listener on the subscription thread (see handlers.h)
+ */
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_subscribeQuestionnaire
+        (JNIEnv* env, jobject thiz, jlong nodeDescriptor, jstring uri, jobject listener){
+
+    if (JVM == NULL){
+        return -1;
+    }
+
+    const char *uri_ = (*env)->GetStringUTFChars(env, uri, NULL);
+    if (uri_ == NULL){
+        return -1;
+    }
+
+    /* Subscription keeps the node until it is unsubscribed */
+    kp_subscription_t *subscription = kp_subscribe_questionnaire(env, nodeDescriptor, uri_, listener);
+
+    (*env)->ReleaseStringUTFChars(env, uri, uri_);
+
+    if (subscription == NULL){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
+        return -1;
+    }
+
+    jlong handle = kp_handles_add(KP_HANDLE_SUBSCRIPTION, subscription, kp_free_subscription);
+    if (handle == -1){
+        kp_unsubscribe_questionnaire(env, subscription);
+    }
+    return handle;
+}
+
+/*
+ *  Unsubscribes and frees the subscription, it must not be called from the listener,
+ *  next calls with the same descriptor do nothing
+ */
+JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_unsubscribeQuestionnaire
+        (JNIEnv* env, jobject thiz, jlong subscriptionDescriptor){
+
+    kp_handles_remove(env, subscriptionDescriptor, KP_HANDLE_SUBSCRIPTION);
+}
+
+/*
+ *  Publishes the feedback with all responses (see feedback.h),
+ *  returns results of responses or NULL if the feedback is not inserted
+ */
+JNIEXPORT jintArray JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_sendFeedback
+        (JNIEnv* env, jobject thiz, jlong nodeDescriptor, jobject feedback){
+
+    if (feedback == NULL){
+        return NULL;
+    }
+
+    sslog_node_t *node = kp_nodes_get(nodeDescriptor);
+    if (node == NULL){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Node Error");
+        return NULL;
+    }
+
+    jintArray results = kp_send_feedback(env, node, feedback);
+    kp_handles_put(env, nodeDescriptor);
+    return results;
 }
\ No newline at end of file
@@ -24,9 +24,36 @@ JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_co
 JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_disconnectSmartSpace
   (JNIEnv *, jobject, jlong);
 
-JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnaire
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnaireData
 (JNIEnv *, jobject, jlong);
 
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_getQuestionnairesData
+(JNIEnv *, jobject, jlong, jint);
+
+JNIEXPORT jint JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_saveQuestionnaireSnapshot
+(JNIEnv *, jobject, jlong, jstring);
+
+JNIEXPORT jobject JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_loadQuestionnaireSnapshotData
+(JNIEnv *, jobject, jstring);
+
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_startConnectTask
+(JNIEnv *, jobject, jstring, jstring, jint, jobject);
+
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_startQuestionnaireTask
+(JNIEnv *, jobject, jlong, jobject);
+
+JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_cancelTask
+(JNIEnv *, jobject, jlong);
+
+JNIEXPORT jlong JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_subscribeQuestionnaire
+(JNIEnv *, jobject, jlong, jstring, jobject);
+
+JNIEXPORT void JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_unsubscribeQuestionnaire
+(JNIEnv *, jobject, jlong);
+
+JNIEXPORT jintArray JNICALL Java_com_petrsu_cardiacare_smartcare_SmartCareLibrary_sendFeedback
+(JNIEnv *, jobject, jlong, jobject);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,363 @@
+//
+// Flat representation of the questionnaire that is passed to Java with one call.
+//
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <jni.h>
+
+#include "marshal.h"
+#include "globals.h"
+
+static int kp_data_add_string(kp_data_t *data, const char *string, jint *position);
+static int kp_snapshot_write(int file, const void *buffer, size_t size);
+static int kp_snapshot_check(const char *image, size_t size);
+static int kp_snapshot_check_parent(const jint *records, int index);
+
+
+void kp_data_init(kp_data_t *data){
+    memset(data, 0, sizeof(kp_data_t));
+}
+
+/* Buffers are kept to be used for the next records */
+void kp_data_clear(kp_data_t *data){
+    data->strings_size = 0;
+    data->records_count = 0;
+    data->is_failed = 0;
+}
+
+void kp_data_free(kp_data_t *data){
+    free(data->strings);
+    free(data->records);
+    kp_data_init(data);
+}
+
+/*
+ * Adds the record, returns its index (to be used as a parent) or -1 on error
+ */
+int kp_data_add(kp_data_t *data, int kind, int parent, const char *first, const char *second, const char *third){
+    if (data->is_failed){
+        return -1;
+    }
+
+    if (data->records_count == data->records_capacity){
+        int capacity = (data->records_capacity == 0) ? 64 : data->records_capacity * 2;
+        jint *records = (jint *) realloc(data->records, capacity * KP_RECORD_SIZE * sizeof(jint));
+        if (records == NULL){
+            data->is_failed = 1;
+            return -1;
+        }
+        data->records = records;
+        data->records_capacity = capacity;
+    }
+
+    jint *record = &data->records[data->records_count * KP_RECORD_SIZE];
+    record[0] = kind;
+    record[1] = parent;
+
+    if (kp_data_add_string(data, first, &record[2]) != 0
+        || kp_data_add_string(data, second, &record[4]) != 0
+        || kp_data_add_string(data, third, &record[6]) != 0){
+        data->is_failed = 1;
+        return -1;
+    }
+
+    return data->records_count++;
+}
+
+/*
+ * Appends records of other data (parents and strings are moved to the new positions),
+ * so parts of the questionnaire that are passed by the task make one questionnaire
+ */
+int kp_data_append(kp_data_t *data, const kp_data_t *other){
+    if (data->is_failed || other->is_failed){
+        data->is_failed = 1;
+        return -1;
+    }
+
+    int records_count = data->records_count + other->records_count;
+    int strings_size = data->strings_size + other->strings_size;
+
+    if (records_count > data->records_capacity){
+        jint *records = (jint *) realloc(data->records, records_count * KP_RECORD_SIZE * sizeof(jint));
+        if (records == NULL){
+            data->is_failed = 1;
+            return -1;
+        }
+        data->records = records;
+        data->records_capacity = records_count;
+    }
+    if (strings_size > data->strings_capacity){
+        char *strings = (char *) realloc(data->strings, strings_size);
+        if (strings == NULL){
+            data->is_failed = 1;
+            return -1;
+        }
+        data->strings = strings;
+        data->strings_capacity = strings_size;
+    }
+
+    for (int i = 0; i < other->records_count; ++i){
+        const jint *source = &other->records[i * KP_RECORD_SIZE];
+        jint *record = &data->records[(data->records_count + i) * KP_RECORD_SIZE];
+
+        record[0] = source[0];
+        record[1] = (source[1] == -1) ? -1 : source[1] + data->records_count;
+        for (int j = 0; j < KP_RECORD_STRINGS; ++j){
+            record[2 + 2 * j] = (source[2 + 2 * j] == -1) ? -1 : source[2 + 2 * j] + data->strings_size;
+            record[3 + 2 * j] = source[3 + 2 * j];
+        }
+    }
+    if (other->strings_size > 0){
+        memcpy(data->strings + data->strings_size, other->strings, other->strings_size);
+    }
+
+    data->records_count = records_count;
+    data->strings_size = strings_size;
+    return 0;
+}
+
+/*
+ * Creates QuestionnaireData with two arrays, local references of arrays are deleted
+ */
+jobject kp_data_to_java(JNIEnv* env, kp_data_t *data){
+    if (data->is_failed){
+        return NULL;
+    }
+
+    jbyteArray strings = (*env)->NewByteArray(env, data->strings_size);
+    jintArray records = (*env)->NewIntArray(env, data->records_count * KP_RECORD_SIZE);
+    jobject result = NULL;
+
+    if (strings != NULL && records != NULL){
+        (*env)->SetByteArrayRegion(env, strings, 0, data->strings_size, (const jbyte *) data->strings);
+        (*env)->SetIntArrayRegion(env, records, 0, data->records_count * KP_RECORD_SIZE, data->records);
+        result = (*env)->NewObject(env, class_questionnaire_data, questionnaire_data_constructor, strings, records);
+    }
+
+    if (strings != NULL){
+        (*env)->DeleteLocalRef(env, strings);
+    }
+    if (records != NULL){
+        (*env)->DeleteLocalRef(env, records);
+    }
+    return result;
+}
+
+/*
+ * Writes the snapshot to the temporary file and renames it,
+ * so the previous snapshot is kept on errors. Returns 0 on success or -1
+ */
+int kp_data_save(kp_data_t *data, const char *path){
+    if (data->is_failed){
+        return -1;
+    }
+
+    char *temp_path = (char *) malloc(strlen(path) + 5);
+    if (temp_path == NULL){
+        return -1;
+    }
+    sprintf(temp_path, "%s.tmp", path);
+
+    int file = open(temp_path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (file < 0){
+        free(temp_path);
+        return -1;
+    }
+
+    kp_snapshot_header_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, KP_SNAPSHOT_MAGIC, KP_SNAPSHOT_MAGIC_LEN);
+    header.version = KP_SNAPSHOT_VERSION;
+    header.record_size = KP_RECORD_SIZE;
+    header.records_count = data->records_count;
+    header.strings_size = data->strings_size;
+
+    int result = kp_snapshot_write(file, &header, sizeof(header));
+    if (result == 0){
+        result = kp_snapshot_write(file, data->records, data->records_count * KP_RECORD_SIZE * sizeof(jint));
+    }
+    if (result == 0){
+        result = kp_snapshot_write(file, data->strings, data->strings_size);
+    }
+    if (close(file) != 0){
+        result = -1;
+    }
+
+    if (result == 0 && rename(temp_path, path) != 0){
+        result = -1;
+    }
+    if (result != 0){
+        unlink(temp_path);
+    }
+
+    free(temp_path);
+    return result;
+}
+
+/*
+ * Maps the snapshot and creates QuestionnaireData from it, returns NULL if
+ * there is no file or it is not correct (other version, damaged file)
+ */
+jobject kp_data_load_to_java(JNIEnv* env, const char *path){
+    int file = open(path, O_RDONLY);
+    if (file < 0){
+        return NULL;
+    }
+
+    struct stat file_stat;
+    if (fstat(file, &file_stat) != 0 || file_stat.st_size < (off_t) sizeof(kp_snapshot_header_t)){
+        close(file);
+        return NULL;
+    }
+
+    size_t size = (size_t) file_stat.st_size;
+    void *image = mmap(NULL, size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if (image == MAP_FAILED){
+        return NULL;
+    }
+
+    jobject result = NULL;
+
+    if (kp_snapshot_check((const char *) image, size) == 0){
+        const kp_snapshot_header_t *header = (const kp_snapshot_header_t *) image;
+        const jint *records = (const jint *) ((const char *) image + sizeof(kp_snapshot_header_t));
+        const char *strings = (const char *) (records + header->records_count * KP_RECORD_SIZE);
+
+        jbyteArray strings_array = (*env)->NewByteArray(env, header->strings_size);
+        jintArray records_array = (*env)->NewIntArray(env, header->records_count * KP_RECORD_SIZE);
+
+        if (strings_array != NULL && records_array != NULL){
+            (*env)->SetByteArrayRegion(env, strings_array, 0, header->strings_size, (const jbyte *) strings);
+            (*env)->SetIntArrayRegion(env, records_array, 0, header->records_count * KP_RECORD_SIZE, records);
+            result = (*env)->NewObject(env, class_questionnaire_data, questionnaire_data_constructor,
+                                       strings_array, records_array);
+        }
+
+        if (strings_array != NULL){
+            (*env)->DeleteLocalRef(env, strings_array);
+        }
+        if (records_array != NULL){
+            (*env)->DeleteLocalRef(env, records_array);
+        }
+    }
+
+    munmap(image, size);
+    return result;
+}
+
+
+static int kp_data_add_string(kp_data_t *data, const char *string, jint *position){
+    if (string == NULL){
+        position[0] = -1;
+        position[1] = 0;
+        return 0;
+    }
+
+    int length = strlen(string);
+
+    if (data->strings_size + length > data->strings_capacity){
+        int capacity = (data->strings_capacity == 0) ? 4096 : data->strings_capacity;
+        while (capacity < data->strings_size + length){
+            capacity *= 2;
+        }
+        char *strings = (char *) realloc(data->strings, capacity);
+        if (strings == NULL){
+            return -1;
+        }
+        data->strings = strings;
+        data->strings_capacity = capacity;
+    }
+
+    memcpy(data->strings + data->strings_size, string, length);
+    position[0] = data->strings_size;
+    position[1] = length;
+    data->strings_size += length;
+    return 0;
+}
+
+
+static int kp_snapshot_write(int file, const void *buffer, size_t size){
+    const char *position = (const char *) buffer;
+
+    while (size > 0){
+        ssize_t written = write(file, position, size);
+        if (written <= 0){
+            return -1;
+        }
+        position += written;
+        size -= written;
+    }
+    return 0;
+}
+
+/*
+ * Checks the header, parents and bounds of strings, Java reads arrays without checks
+ */
+static int kp_snapshot_check(const char *image, size_t size){
+    const kp_snapshot_header_t *header = (const kp_snapshot_header_t *) image;
+
+    if (memcmp(header->magic, KP_SNAPSHOT_MAGIC, KP_SNAPSHOT_MAGIC_LEN) != 0
+        || header->version != KP_SNAPSHOT_VERSION || header->record_size != KP_RECORD_SIZE
+        || header->records_count < 0 || header->strings_size < 0){
+        return -1;
+    }
+
+    size_t records_size = (size_t) header->records_count * KP_RECORD_SIZE * sizeof(jint);
+    if (size != sizeof(kp_snapshot_header_t) + records_size + (size_t) header->strings_size){
+        return -1;
+    }
+
+    const jint *records = (const jint *) (image + sizeof(kp_snapshot_header_t));
+
+    for (int i = 0; i < header->records_count; ++i){
+        const jint *record = &records[i * KP_RECORD_SIZE];
+
+        if (kp_snapshot_check_parent(records, i) != 0){
+            return -1;
+        }
+        for (int j = 0; j < KP_RECORD_STRINGS; ++j){
+            jint offset = record[2 + 2 * j];
+            jint length = record[3 + 2 * j];
+
+            if (offset != -1 && (offset < 0 || length < 0 || length > header->strings_size - offset)){
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Parent is one of the previous records: questionnaires and questions have no parents,
+ * answers belong to questions or items (subanswers), items belong to answers
+ */
+static int kp_snapshot_check_parent(const jint *records, int index){
+    jint kind = records[index * KP_RECORD_SIZE];
+    jint parent = records[index * KP_RECORD_SIZE + 1];
+
+    if (parent < -1 || parent >= index){
+        return -1;
+    }
+
+    jint parent_kind = (parent == -1) ? -1 : records[parent * KP_RECORD_SIZE];
+
+    switch (kind){
+        case KP_RECORD_QUESTIONNAIRE:
+        case KP_RECORD_QUESTION:
+            return (parent == -1) ? 0 : -1;
+        case KP_RECORD_ANSWER:
+            return (parent_kind == KP_RECORD_QUESTION || parent_kind == KP_RECORD_ITEM) ? 0 : -1;
+        case KP_RECORD_ITEM:
+            return (parent_kind == KP_RECORD_ANSWER) ? 0 : -1;
+        default:
+            return -1;
+    }
+}
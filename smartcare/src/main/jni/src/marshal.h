@@ -0,0 +1,73 @@
+//
+// Flat representation of the questionnaire that is passed to Java with one call.
+//
+
+#ifndef SMARTCARE_QUESTIONNAIRE_MARSHAL_H
+#define SMARTCARE_QUESTIONNAIRE_MARSHAL_H
+
+#include <jni.h>
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/* Kinds of records, see QuestionnaireData.java */
+#define KP_RECORD_QUESTIONNAIRE 0
+#define KP_RECORD_QUESTION 1
+#define KP_RECORD_ANSWER 2
+#define KP_RECORD_ITEM 3
+
+/*
+ * Record: kind, index of the parent record (-1 - questionnaire or question of the
+ * current questionnaire) and three strings as pairs (offset, length), offset is -1 for NULL
+ */
+#define KP_RECORD_STRINGS 3
+#define KP_RECORD_SIZE (2 + 2 * KP_RECORD_STRINGS)
+
+/*
+ * Strings are stored as UTF-8 bytes, records are stored in the order of the tree
+ * (parent records are before their children)
+ */
+typedef struct kp_data_s {
+    char *strings;
+    int strings_size;
+    int strings_capacity;
+
+    jint *records;
+    int records_count;
+    int records_capacity;
+
+    /* Data is not passed to Java if some record can't be added */
+    int is_failed;
+} kp_data_t;
+
+/*
+ * Snapshot file: header, records and strings as they are passed to Java,
+ * so the file is mapped and copied to the arrays without parsing
+ */
+#define KP_SNAPSHOT_MAGIC "KPQSNAP"
+#define KP_SNAPSHOT_MAGIC_LEN 8
+#define KP_SNAPSHOT_VERSION 1
+
+typedef struct kp_snapshot_header_s {
+    char magic[KP_SNAPSHOT_MAGIC_LEN];
+    jint version;
+    jint record_size;
+    jint records_count;
+    jint strings_size;
+} kp_snapshot_header_t;
+
+void kp_data_init(kp_data_t*);
+void kp_data_clear(kp_data_t*);
+void kp_data_free(kp_data_t*);
+int kp_data_add(kp_data_t*, int, int, const char*, const char*, const char*);
+int kp_data_append(kp_data_t*, const kp_data_t*);
+jobject kp_data_to_java(JNIEnv*, kp_data_t*);
+int kp_data_save(kp_data_t*, const char*);
+jobject kp_data_load_to_java(JNIEnv*, const char*);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif //SMARTCARE_QUESTIONNAIRE_MARSHAL_H
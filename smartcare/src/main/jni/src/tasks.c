@@ -0,0 +1,205 @@
+//
+// Asynchronous loading of the questionnaire on native worker threads.
+//
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include <android/log.h>
+
+#include <jni.h>
+
+#include "tasks.h"
+#include "agent.h"
+#include "handles.h"
+#include "globals.h"
+
+#define TAG "SS"
+
+struct kp_task_s {
+    pthread_t thread;
+
+    /* Global reference to the QuestionnaireTask */
+    jobject callback;
+    jmethodID on_connected;
+    jmethodID on_data;
+    jmethodID on_finished;
+    jmethodID on_error;
+    jmethodID on_cancelled;
+
+    char *hostname;
+    char *ip;
+    int port;
+    /* Handle of the node, 0 - the task connects to the smart space */
+    jlong node;
+
+    /* Parts of the questionnaire that are passed to Java, they are kept with the node */
+    kp_data_t questionnaire;
+
+    volatile int is_cancelled;
+    /* Task is used by the worker thread and by the Java side (until cancelTask) */
+    volatile int references;
+};
+
+static void* kp_task_run(void *data);
+static void kp_task_release(JNIEnv *env, kp_task_t *task);
+static void kp_task_check_exception(JNIEnv *env);
+
+
+kp_task_t* kp_task_start(JNIEnv* env, jobject callback, const char *hostname, const char *ip, int port, jlong node){
+    jclass callback_class = (*env)->GetObjectClass(env, callback);
+    if (callback_class == NULL){
+        return NULL;
+    }
+
+    kp_task_t *task = (kp_task_t *) calloc(1, sizeof(kp_task_t));
+    if (task == NULL){
+        return NULL;
+    }
+
+    task->on_connected = (*env)->GetMethodID(env, callback_class, "onConnected", "(J)V");
+    task->on_data = (*env)->GetMethodID(env, callback_class, "onData", "(Lcom/petrsu/cardiacare/smartcare/QuestionnaireData;)V");
+    task->on_finished = (*env)->GetMethodID(env, callback_class, "onFinished", "()V");
+    task->on_error = (*env)->GetMethodID(env, callback_class, "onError", "(Ljava/lang/String;)V");
+    task->on_cancelled = (*env)->GetMethodID(env, callback_class, "onCancelled", "()V");
+    (*env)->DeleteLocalRef(env, callback_class);
+
+    if (task->on_connected == NULL || task->on_data == NULL || task->on_finished == NULL
+        || task->on_error == NULL || task->on_cancelled == NULL){
+        free(task);
+        return NULL;
+    }
+
+    task->callback = (*env)->NewGlobalRef(env, callback);
+    task->hostname = (hostname != NULL) ? strdup(hostname) : NULL;
+    task->ip = (ip != NULL) ? strdup(ip) : NULL;
+    task->port = port;
+    task->node = node;
+    task->references = 2;
+
+    if (task->callback == NULL || pthread_create(&task->thread, NULL, kp_task_run, task) != 0){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Can't start the task");
+        task->references = 1;
+        kp_task_release(env, task);
+        return NULL;
+    }
+
+    pthread_detach(task->thread);
+    return task;
+}
+
+/*
+ * Network operations are not interrupted, the task stops after the current request.
+ * The task can't be used after this call.
+ */
+void kp_task_cancel(JNIEnv* env, kp_task_t *task){
+    if (task == NULL){
+        return;
+    }
+    __sync_lock_test_and_set(&task->is_cancelled, 1);
+    kp_task_release(env, task);
+}
+
+bool kp_task_is_cancelled(kp_task_t *task){
+    return task != NULL && __sync_fetch_and_add(&task->is_cancelled, 0) != 0;
+}
+
+/*
+ * Passes records of the data with one call and clears the data,
+ * so each call contains records of the next questions
+ */
+void kp_task_notify_data(JNIEnv* env, kp_task_t *task, kp_data_t *data){
+    if (task == NULL){
+        return;
+    }
+    jobject questionnaire_data = kp_data_to_java(env, data);
+    kp_data_append(&task->questionnaire, data);
+    if (questionnaire_data != NULL){
+        (*env)->CallVoidMethod(env, task->callback, task->on_data, questionnaire_data);
+        (*env)->DeleteLocalRef(env, questionnaire_data);
+    }
+    kp_task_check_exception(env);
+    kp_data_clear(data);
+}
+
+
+static void* kp_task_run(void *data){
+    kp_task_t *task = (kp_task_t *) data;
+    JNIEnv *env = NULL;
+
+    if ((*JVM)->AttachCurrentThread(JVM, &env, NULL) != JNI_OK){
+        __android_log_print(ANDROID_LOG_INFO, TAG, "Can't attach the task thread");
+        /* Global reference can't be deleted without JNIEnv, it is left if the task is cancelled already */
+        if (__sync_sub_and_fetch(&task->references, 1) == 0){
+            free(task->hostname);
+            free(task->ip);
+            free(task);
+        }
+        return NULL;
+    }
+
+    if (task->node == 0){
+        jlong node = kp_connect_smartspace(task->hostname, task->ip, task->port);
+        if (node == -1){
+            jstring message = (*env)->NewStringUTF(env, "Can't join to SS");
+            (*env)->CallVoidMethod(env, task->callback, task->on_error, message);
+            kp_task_check_exception(env);
+            kp_task_release(env, task);
+            (*JVM)->DetachCurrentThread(JVM);
+            return NULL;
+        }
+        task->node = node;
+        (*env)->CallVoidMethod(env, task->callback, task->on_connected, node);
+        kp_task_check_exception(env);
+    }
+
+    kp_data_t questionnaire_data;
+    kp_data_init(&questionnaire_data);
+
+    /* Node is kept by the task if it is disconnected meanwhile */
+    int result = -1;
+    sslog_node_t *node = kp_nodes_get(task->node);
+    if (node != NULL){
+        if (kp_task_is_cancelled(task) == false){
+            result = kp_build_questionnaire(env, node, &questionnaire_data, task);
+        }
+        kp_handles_put(env, task->node);
+    }
+
+    if (kp_task_is_cancelled(task) == true){
+        (*env)->CallVoidMethod(env, task->callback, task->on_cancelled);
+    } else if (result == -1){
+        jstring message = (*env)->NewStringUTF(env, "There is no questionnaire");
+        (*env)->CallVoidMethod(env, task->callback, task->on_error, message);
+    } else {
+        kp_nodes_set_questionnaire(task->node, &task->questionnaire);
+        (*env)->CallVoidMethod(env, task->callback, task->on_finished);
+    }
+    kp_task_check_exception(env);
+    kp_data_free(&questionnaire_data);
+    kp_data_free(&task->questionnaire);
+
+    kp_task_release(env, task);
+    (*JVM)->DetachCurrentThread(JVM);
+    return NULL;
+}
+
+static void kp_task_release(JNIEnv *env, kp_task_t *task){
+    if (__sync_sub_and_fetch(&task->references, 1) != 0){
+        return;
+    }
+    if (task->callback != NULL){
+        (*env)->DeleteGlobalRef(env, task->callback);
+    }
+    free(task->hostname);
+    free(task->ip);
+    free(task);
+}
+
+/* Exceptions of callbacks are logged, the task is continued */
+static void kp_task_check_exception(JNIEnv *env){
+    if ((*env)->ExceptionCheck(env)){
+        (*env)->ExceptionDescribe(env);
+        (*env)->ExceptionClear(env);
+    }
+}
@@ -0,0 +1,32 @@
+//
+// Asynchronous loading of the questionnaire on native worker threads.
+//
+
+#ifndef SMARTCARE_QUESTIONNAIRE_TASKS_H
+#define SMARTCARE_QUESTIONNAIRE_TASKS_H
+
+#include <stdbool.h>
+#include <jni.h>
+#include "ontology/smartcare.h"
+#include "marshal.h"
+
+#ifdef	__cplusplus
+extern "C" {
+#endif
+
+/*
+ * Task connects to the smart space (if the handle of the node is 0) and loads the questionnaire,
+ * results are passed to the QuestionnaireTask (Java) on the worker thread
+ */
+typedef struct kp_task_s kp_task_t;
+
+kp_task_t* kp_task_start(JNIEnv*, jobject, const char*, const char*, int, jlong);
+void kp_task_cancel(JNIEnv*, kp_task_t*);
+bool kp_task_is_cancelled(kp_task_t*);
+void kp_task_notify_data(JNIEnv*, kp_task_t*, kp_data_t*);
+
+#ifdef	__cplusplus
+}
+#endif
+
+#endif //SMARTCARE_QUESTIONNAIRE_TASKS_H
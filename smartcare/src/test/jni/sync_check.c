@@ -0,0 +1,172 @@
+//
+// Check of the synchronization of the stored questionnaire (sslog_node_sync):
+// the smart space is replaced by the graph below, so the check runs on the host.
+//
+
+/*
+ * Build from smartcare/src/main/jni (library objects are built as for Android.mk):
+ *   mkdir -p /tmp/sslog && for f in $(grep -o "SmartSlog/[^ ]*\.c" Android.mk); do
+ *       gcc -std=gnu99 -DMTENABLE -DHAVE_EXPAT_CONFIG_H -DHAVE_MEMMOVE -I includes -I includes/expat \
+ *           -I includes/scew -I SmartSlog -c $f -o /tmp/sslog/$(echo $f | tr / _).o; done
+ *   ar rcs /tmp/sslog/libsslog.a $(ls /tmp/sslog/SmartSlog_*.o)
+ *   gcc -std=gnu99 -DMTENABLE -I includes -I SmartSlog -I SmartSlog/utils -I . \
+ *       ../../test/jni/sync_check.c ontology/smartcare.c /tmp/sslog/libsslog.a -lpthread -o /tmp/sync_check
+ *   /tmp/sync_check
+ */
+
+/* Requests to the smart space are answered from the graph */
+#define sslog_kpi_sparql_construct sync_check_construct
+#define sslog_kpi_query_triples sync_check_query
+#include "high_api.c"
+#undef sslog_kpi_sparql_construct
+#undef sslog_kpi_query_triples
+
+#include <stdio.h>
+
+#include "ontology/smartcare.h"
+
+#define SC "http://oss.fruct.org/smartcare#"
+#define RDF_TYPE "http://www.w3.org/1999/02/22-rdf-syntax-ns#type"
+
+typedef struct sync_check_triple_s {
+    const char *subject;
+    const char *predicate;
+    const char *object;
+    int object_type;
+} sync_check_triple_t;
+
+/* Questionnaire with one question, its answer and item */
+static sync_check_triple_t sync_check_graph[] = {
+    {SC "q", RDF_TYPE, SC "Questionnaire", SSLOG_RDF_TYPE_URI},
+    {SC "q", SC "firstQuestion", SC "q1", SSLOG_RDF_TYPE_URI},
+    {SC "q", SC "version", "1", SSLOG_RDF_TYPE_LIT},
+    {SC "q1", RDF_TYPE, SC "Question", SSLOG_RDF_TYPE_URI},
+    {SC "q1", SC "description", "Question", SSLOG_RDF_TYPE_LIT},
+    {SC "q1", SC "hasAnswer", SC "a1", SSLOG_RDF_TYPE_URI},
+    {SC "q1", SC "version", "1", SSLOG_RDF_TYPE_LIT},
+    {SC "a1", RDF_TYPE, SC "SingleChoise", SSLOG_RDF_TYPE_URI},
+    {SC "a1", SC "singleItem", SC "i1", SSLOG_RDF_TYPE_URI},
+    {SC "a1", SC "version", "1", SSLOG_RDF_TYPE_LIT},
+    {SC "i1", RDF_TYPE, SC "Item", SSLOG_RDF_TYPE_URI},
+    {SC "i1", SC "itemText", "Item", SSLOG_RDF_TYPE_LIT},
+    {SC "i1", SC "version", "1", SSLOG_RDF_TYPE_LIT},
+};
+
+/* Version of the item */
+#define SYNC_CHECK_ITEM_VERSION 12
+
+#define SYNC_CHECK_GRAPH_SIZE ((int) (sizeof(sync_check_graph) / sizeof(sync_check_graph[0])))
+
+static int sync_check_errors = 0;
+
+
+static sslog_triple_t *sync_check_new_triple(int index)
+{
+    sync_check_triple_t *triple = &sync_check_graph[index];
+
+    return sslog_new_triple_detached(triple->subject, triple->predicate, triple->object,
+                                     SSLOG_RDF_TYPE_URI, triple->object_type);
+}
+
+/* Fingerprint of the questionnaire: links and versions (classes and data properties are not compared) */
+int sync_check_construct(sslog_kpi_info_t *kpi_info, const char *query, list_t **result_triples)
+{
+    *result_triples = list_new();
+
+    for (int i = 0; i < SYNC_CHECK_GRAPH_SIZE; ++i) {
+        if ((sync_check_graph[i].object_type == SSLOG_RDF_TYPE_URI && strcmp(sync_check_graph[i].predicate, RDF_TYPE) != 0)
+            || strcmp(sync_check_graph[i].predicate, SC "version") == 0) {
+            list_add_data(*result_triples, sync_check_new_triple(i));
+        }
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+/* Changed individuals are got with all triples */
+int sync_check_query(sslog_kpi_info_t *kpi_info, list_t *requested_triples, list_t **returned_triples)
+{
+    *returned_triples = list_new();
+
+    list_head_t *list_walker = NULL;
+
+    list_for_each (list_walker, &requested_triples->links) {
+        sslog_triple_t *request = (sslog_triple_t *) list_entry(list_walker, list_t, links)->data;
+
+        for (int i = 0; i < SYNC_CHECK_GRAPH_SIZE; ++i) {
+            if (strcmp(sync_check_graph[i].subject, request->subject) == 0) {
+                list_add_data(*returned_triples, sync_check_new_triple(i));
+            }
+        }
+    }
+
+    return SSLOG_ERROR_NO;
+}
+
+
+static void sync_check(sslog_node_t *node, list_t *properties, sslog_property_t *version, const char *name,
+                       int expected_result, int expected_count)
+{
+    int changed_count = -1;
+    int result = sslog_node_sync(node, "fingerprint", properties, version, &changed_count);
+
+    if (result != expected_result || changed_count != expected_count) {
+        printf("FAILED %s: result %d instead of %d, %d changed individuals instead of %d\n",
+               name, result, expected_result, changed_count, expected_count);
+        ++sync_check_errors;
+    } else {
+        printf("ok %s\n", name);
+    }
+}
+
+
+int main()
+{
+    if (sslog_init() != SSLOG_ERROR_NO) {
+        printf("FAILED: the library is not initialized\n");
+        return 1;
+    }
+
+    register_ontology();
+
+    sslog_node_t node;
+    memset(&node, 0, sizeof(node));
+    node.session = sslog_session_get_default();
+
+    /* Properties of kp_sync_questionnaire that are used by the graph */
+    list_t *properties = list_new();
+    list_add_data(properties, PROPERTY_FIRSTQUESTION);
+    list_add_data(properties, PROPERTY_HASANSWER);
+    list_add_data(properties, PROPERTY_SINGLEITEM);
+    sslog_property_t *version = sslog_new_property(SC "version", SSLOG_PROPERTY_TYPE_DATA);
+    list_add_data(properties, version);
+
+    /* Questionnaire is constructed with one request */
+    list_t *triples = list_new();
+    for (int i = 0; i < SYNC_CHECK_GRAPH_SIZE; ++i) {
+        list_add_data(triples, sync_check_new_triple(i));
+    }
+    sslog_insert_triples(triples);
+    sslog_free_triples(triples);
+
+    sync_check(&node, properties, version, "constructed questionnaire is not changed", SSLOG_ERROR_NO, 0);
+    sync_check(&node, properties, version, "synchronized questionnaire is not changed", SSLOG_ERROR_NO, 0);
+
+    /* Removed answer removes the link of its question too, both of them are got again */
+    sslog_remove_individual(sslog_get_individual(SC "a1"));
+    sync_check(&node, properties, version, "removed answer is got again", SSLOG_ERROR_NO, 2);
+    sync_check(&node, properties, version, "answer is not changed after synchronization", SSLOG_ERROR_NO, 0);
+
+    sync_check_graph[SYNC_CHECK_ITEM_VERSION].object = "2";
+    sync_check(&node, properties, version, "item with the new version is changed", SSLOG_ERROR_NO, 1);
+    sync_check(&node, properties, version, "item is not changed after synchronization", SSLOG_ERROR_NO, 0);
+
+    /* Item without the version is absent in the fingerprint, its changes are not seen */
+    sync_check_graph[SYNC_CHECK_ITEM_VERSION].predicate = SC "itemVersion";
+    sync_check(&node, properties, version, "item without the version is not synchronized", SSLOG_ERROR_NOT_FOUND, 0);
+
+    list_free_with_nodes(properties, NULL);
+    sslog_shutdown();
+
+    return (sync_check_errors == 0) ? 0 : 1;
+}